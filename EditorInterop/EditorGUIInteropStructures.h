@@ -0,0 +1,66 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include "InteropTypes.h"
+
+#ifdef CUBE_LANGUAGE_CSHARP
+namespace IcarianEditor {
+#endif
+
+// Opcodes for GUICommandBuffer, everything after the opcode is a uint32 argument
+// Strings are an offset and length into the UTF-16 string pool
+// Skip is the command index just past the matching pop, jumped to when the scope is closed
+IOP_CSINTERNAL enum IOP_ENUM_NAME(GUICommand) : IOP_UINT32
+{
+    // String
+    IOP_ENUM_VALUE(GUICommand, Label) = 0,
+    IOP_ENUM_VALUE(GUICommand, SameLine) = 1,
+    IOP_ENUM_VALUE(GUICommand, Separator) = 2,
+    IOP_ENUM_VALUE(GUICommand, Indent) = 3,
+    IOP_ENUM_VALUE(GUICommand, Unindent) = 4,
+    // String
+    IOP_ENUM_VALUE(GUICommand, PushID) = 5,
+    IOP_ENUM_VALUE(GUICommand, PopID) = 6,
+    // String, Result
+    IOP_ENUM_VALUE(GUICommand, Button) = 7,
+    // String, Selected, Result
+    IOP_ENUM_VALUE(GUICommand, Selectable) = 8,
+    // String, Result, Skip
+    IOP_ENUM_VALUE(GUICommand, TreeNode) = 9,
+    IOP_ENUM_VALUE(GUICommand, TreePop) = 10,
+    // String, Column Count, Skip
+    IOP_ENUM_VALUE(GUICommand, BeginTable) = 11,
+    IOP_ENUM_VALUE(GUICommand, TableNextRow) = 12,
+    IOP_ENUM_VALUE(GUICommand, TableNextColumn) = 13,
+    IOP_ENUM_VALUE(GUICommand, EndTable) = 14,
+    IOP_ENUM_VALUE(GUICommand, Last) = 15
+};
+
+#ifdef CUBE_LANGUAGE_CSHARP
+}
+#endif
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -20,6 +20,14 @@
         } \
         Instance->WriteScene(p, (uint32_t)len, data); \
     }, IOP_STRING a_path, IOP_ARRAY(byte[]) a_data) \
+    F(void, IcarianEditor, EditorSceneInterop, WriteSceneCache, \
+    { \
+        mono_unichar4* str = mono_string_to_utf32(a_path); \
+        IDEFER(mono_free(str)); \
+        const std::filesystem::path p = std::filesystem::path(std::u32string((char32_t*)str)); \
+        const uintptr_t len = mono_array_length(a_data); \
+        Instance->WriteParsedCache(p, AssetType_Scene, (uint32_t)len, (const uint8_t*)mono_array_addr(a_data, uint8_t, 0)); \
+    }, IOP_STRING a_path, IOP_ARRAY(byte[]) a_data) \
 
 // MIT License
 // 
@@ -177,9 +177,11 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
         "./src/AppMain.cpp",
         "./src/AssetBrowserWindow.cpp",
         "./src/AssetLibrary.cpp",
+        "./src/AssetSearchIndex.cpp",
         "./src/BuildLoadingTask.cpp",
         "./src/BuildProjectModal.cpp",
         "./src/ConfirmModal.cpp",
+        "./src/ConsoleSearch.cpp",
         "./src/ConsoleWindow.cpp",
         "./src/CopyBuildLibraryLoadingTask.cpp",
         "./src/CreateAssemblyControlModal.cpp",
@@ -190,9 +192,12 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
         "./src/CreateProjectModal.cpp",
         "./src/CreateScriptableModal.cpp",
         "./src/Datastore.cpp",
+        "./src/DirectoryModel.cpp",
+        "./src/DirectoryWatcher.cpp",
         "./src/EditorConfig.cpp",
         "./src/EditorConfigModal.cpp",
         "./src/EditorInputManager.cpp",
+        "./src/EditorProfiler.cpp",
         "./src/EditorWindow.cpp",
         "./src/ErrorModal.cpp",
         "./src/FileDialog.cpp",
@@ -209,13 +214,18 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
         "./src/LoadingModal.cpp",
         "./src/Logger.cpp",
         "./src/main.cpp",
+        "./src/MeshOptimizer.cpp",
         "./src/Modal.cpp",
         "./src/Model.cpp",
+        "./src/ModelCache.cpp",
+        "./src/ModelImporter.cpp",
         "./src/MonoProjectGenerator.cpp",
         "./src/OpenProjectModal.cpp",
+        "./src/ParsedCache.cpp",
         "./src/PixelShader.cpp",
         "./src/ProjectConfigModal.cpp",
         "./src/ProcessManager.cpp",
+        "./src/ProfilerCaptureModal.cpp",
         "./src/ProfilerData.cpp",
         "./src/ProfilerWindow.cpp",
         "./src/Project.cpp",
@@ -229,6 +239,7 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
         "./src/RuntimeStorage.cpp",
         "./src/SceneDefsWindow.cpp",
         "./src/SCPPipe.cpp",
+        "./src/ScratchArena.cpp",
         "./src/SerializeAssetsLoadingTask.cpp",
         "./src/Shader.cpp",
         "./src/ShaderProgram.cpp",
@@ -240,7 +251,10 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
         "./src/SyncRemoteBuildLoadingTask.cpp",
         "./src/TemplateBuilder.cpp",
         "./src/Texture.cpp",
+        "./src/TextureCompressor.cpp",
+        "./src/TextureLoader.cpp",
         "./src/TextureSampler.cpp",
+        "./src/ThumbnailService.cpp",
         "./src/TimelineWindow.cpp",
         "./src/UniformBuffer.cpp",
         "./src/VertexShader.cpp",
@@ -251,6 +265,9 @@ static CUBE_CProject BuildIcarianEditorProject(e_TargetPlatform a_targetPlatform
     // Used for style editor window
     // CUBE_CProject_AppendSource(&project, "../IcarianEngine/deps/imgui/imgui_demo.cpp");
 
+    // Compiles out the editor self profiling instrumentation
+    // CUBE_CProject_AppendDefine(&project, "ICARIANEDITOR_DISABLE_PROFILER");
+
     CUBE_CProject_AppendCFlag(&project, "-std=c++17");
 
     switch (a_configuration)
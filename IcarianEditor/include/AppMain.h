@@ -60,11 +60,13 @@ private:
     std::vector<bool>    m_runtimeModalState;
 
 protected:
+    virtual bool IsActive() const;
 
 public:
     AppMain();
     virtual ~AppMain();
 
+    virtual void Tick();
     virtual void Update(double a_delta, double a_time);
 
     bool GetRuntimeModalState(uint32_t a_index);
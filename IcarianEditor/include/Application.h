@@ -28,8 +28,15 @@ enum e_Cursors
 class Application
 {
 private:
+    // Extra frames after a request so ImGui can settle hover states and the like
+    static constexpr uint32_t RedrawFrameCount = 3;
+    // Still tick while idle so anything that gets polled like IPC or file changes is picked up
+    static constexpr double IdleInterval = 0.25;
+
     bool        m_maximized;
 
+    uint32_t    m_backgroundFrameRate;
+
     int         m_xPosState;
     int         m_yPosState;
 
@@ -37,7 +44,11 @@ private:
 
     GLFWcursor* m_cursors[Cursor_Last];
 
+    double GetFrameInterval() const;
+
 protected:
+    // Focus on anything the application owns, windows other then the main one can override
+    virtual bool IsActive() const;
 
 public:
     Application(uint32_t a_width, uint32_t a_height, const std::string_view& a_title);
@@ -45,6 +56,15 @@ public:
 
     void Run();
 
+    // Safe to call from any thread, wakes the loop if it is waiting
+    static void RequestRedraw(uint32_t a_frames = RedrawFrameCount);
+
+    // Cap when not focused, 0 for uncapped
+    inline void SetBackgroundFrameRate(uint32_t a_frameRate)
+    {
+        m_backgroundFrameRate = a_frameRate;
+    }
+
     bool IsFocused() const;
 
     bool IsMaximized() const;
@@ -66,6 +86,7 @@ public:
     glm::vec2 GetWindowPos() const;
     void SetWindowPos(const glm::vec2& a_pos);
 
+    virtual void Tick() = 0;
     virtual void Update(double a_delta, double a_time) = 0;
 
     inline GLFWwindow* GetWindow() const
@@ -5,6 +5,8 @@
 #pragma once
 
 #include <filesystem>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 class Project;
@@ -47,6 +49,8 @@ struct FileAlias
 struct Asset
 {
     static constexpr uint32_t ForceWriteBit = 0;
+    // Editor changed the contents and they differ from what is on disk
+    static constexpr uint32_t DirtyBit = 1;
 
     std::filesystem::file_time_type ModifiedTime;
     std::filesystem::path Path;
@@ -61,8 +65,13 @@ class AssetLibrary
 private:
     static constexpr uint32_t ForceSerializeBit = 0;
 
-    std::vector<Asset> m_assets;
-    uint8_t            m_flags;
+    std::filesystem::path                     m_cachePath;
+    std::vector<Asset>                        m_assets;
+    // Path to index into the assets for lookups that happen once per asset
+    std::unordered_map<std::string, uint32_t> m_assetLookup;
+    uint8_t                                   m_flags;
+
+    void AddAsset(const Asset& a_asset);
 
 protected:
 
@@ -74,15 +83,18 @@ public:
 
     void WriteDef(const std::filesystem::path& a_path, uint32_t a_size, uint8_t* a_data);
     void WriteScene(const std::filesystem::path& a_path, uint32_t a_size, uint8_t* a_data);
+    void WriteParsedCache(const std::filesystem::path& a_path, e_AssetType a_type, uint32_t a_size, const uint8_t* a_data) const;
 
     bool ShouldRefresh(const std::filesystem::path& a_workingDir) const;
     bool ShouldSerialize();
 
-    void Refresh(const std::filesystem::path& a_workingDir);
+    void Refresh(const Project* a_project);
     void BuildDirectory(const std::filesystem::path& a_path, const Project* a_project) const;
 
     std::vector<std::filesystem::path> GetAssetPathWithExtension(const std::string_view& a_ext);
 
+    static e_AssetType GetAssetTypeFromExtension(const std::string& a_ext);
+
     e_AssetType GetAssetType(const std::filesystem::path& a_path);
     e_AssetType GetAssetType(const std::filesystem::path& a_workingDir, const std::filesystem::path& a_path);
 
@@ -0,0 +1,94 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class DirectoryModel;
+
+struct AssetSearchEntry
+{
+    uint32_t Node;
+    // -1 when the entry is the folder itself
+    uint32_t File;
+    // Lower case path relative to the project
+    std::string Key;
+    uint32_t NameOffset;
+    bool Valid;
+};
+
+struct AssetSearchResult
+{
+    uint32_t Entry;
+    uint32_t Node;
+    uint32_t File;
+    int32_t Score;
+};
+
+// Trigram index over every folder and file in the directory model
+// Kept up to date per directory as the model changes and the last query is cached
+class AssetSearchIndex
+{
+public:
+    static constexpr uint32_t MaxResults = 1024;
+
+private:
+    std::vector<AssetSearchEntry>                         m_entries;
+    std::vector<uint32_t>                                 m_freeEntries;
+    std::unordered_map<uint32_t, std::vector<uint32_t>>   m_nodeEntries;
+    std::unordered_map<uint32_t, std::vector<uint32_t>>   m_trigrams;
+
+    uint32_t                                              m_version;
+
+    std::string                                           m_cachedQuery;
+    uint32_t                                              m_cachedRoot;
+    uint32_t                                              m_cachedVersion;
+    std::vector<AssetSearchResult>                        m_results;
+
+    uint32_t AddEntry(uint32_t a_node, uint32_t a_file, const std::string_view& a_path, uint32_t a_nameOffset);
+    void RemoveNodeEntries(uint32_t a_node);
+    void AddNodeEntries(const DirectoryModel& a_model, uint32_t a_node);
+
+    bool IsUnderNode(const DirectoryModel& a_model, uint32_t a_node, uint32_t a_root) const;
+
+protected:
+
+public:
+    AssetSearchIndex();
+    ~AssetSearchIndex();
+
+    void Build(const DirectoryModel& a_model);
+    // Updates the entries for any nodes the model changed in its last update
+    void Update(const DirectoryModel& a_model);
+
+    // Results are ranked best first and limited to the subtree under a_root
+    const std::vector<AssetSearchResult>& Search(const DirectoryModel& a_model, const std::string_view& a_query, uint32_t a_root);
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
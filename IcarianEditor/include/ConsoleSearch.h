@@ -0,0 +1,75 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Trigram index over the unique console strings
+// Plain queries only verify strings that contain every trigram of the query
+// Regex queries cannot be broken down so they fall back to checking every string
+class ConsoleSearch
+{
+private:
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_trigrams;
+
+    std::string                                         m_query;
+    std::regex                                          m_regex;
+
+    bool                                                m_useRegex;
+    bool                                                m_valid;
+
+protected:
+
+public:
+    ConsoleSearch();
+    ~ConsoleSearch();
+
+    void AddString(uint32_t a_index, const std::string_view& a_string);
+    void RemoveString(uint32_t a_index, const std::string_view& a_string);
+    void Clear();
+
+    bool SetQuery(const std::string_view& a_query, bool a_regex);
+
+    inline bool IsEmpty() const
+    {
+        return m_query.empty();
+    }
+    inline bool IsValid() const
+    {
+        return m_valid;
+    }
+
+    bool Match(const std::string_view& a_string) const;
+
+    // Returns false when the query cannot use the index and every string has to be checked
+    bool GetCandidates(uint32_t a_stringCount, std::vector<uint32_t>* a_candidates) const;
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -8,12 +8,18 @@
 #include <unordered_map>
 
 class Texture;
+class TextureLoader;
 
+// Editor textures show uncompressed straight away and get swapped for the compressed version once a worker is done with it
 class Datastore
 {
 private:
+    static constexpr char CachePath[] = ".cache";
+
     static Datastore* Instance;
 
+    TextureLoader*                            m_textureLoader;
+
     std::unordered_map<std::string, Texture*> m_textures;
 
     Datastore();
@@ -25,6 +31,8 @@ public:
     static void Init();
     static void Destroy();
 
+    static void Update();
+
     static Texture* GetTexture(const std::string_view& a_path);
 };
 
@@ -0,0 +1,128 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DirectoryWatcher.h"
+
+struct DirectoryModelFile
+{
+    std::filesystem::path Path;
+    std::filesystem::path RelativePath;
+    std::string PathString;
+    std::string Name;
+};
+
+struct DirectoryModelNode
+{
+    uint32_t Parent;
+    std::filesystem::path Path;
+    std::string PathString;
+    std::string Name;
+    std::filesystem::file_time_type ModifiedTime;
+    // Both kept sorted by name so drawing can just walk them
+    std::vector<uint32_t> Children;
+    std::vector<DirectoryModelFile> Files;
+    bool Valid;
+};
+
+// Flat cached copy of the project directory tree
+// Only touches the filesystem when building or when the watcher reports a change
+class DirectoryModel
+{
+private:
+    std::filesystem::path                     m_root;
+
+    std::vector<DirectoryModelNode>           m_nodes;
+    std::vector<uint32_t>                     m_freeNodes;
+    std::unordered_map<std::string, uint32_t> m_lookup;
+    std::vector<uint32_t>                     m_changedNodes;
+
+    DirectoryWatcher                          m_watcher;
+
+    uint32_t                                  m_version;
+    bool                                      m_unknownChange;
+
+    uint32_t AddNode(uint32_t a_parent, const std::filesystem::path& a_path);
+    void RemoveNode(uint32_t a_index);
+    
+    void ScanNode(uint32_t a_index);
+
+protected:
+
+public:
+    DirectoryModel();
+    ~DirectoryModel();
+
+    void Build(const std::filesystem::path& a_root);
+    void Clear();
+
+    // Applies any changes picked up by the watcher
+    // Returns true if the model changed
+    bool Update();
+
+    inline uint32_t GetVersion() const
+    {
+        return m_version;
+    }
+    // Nodes that were rescanned or removed by the last update
+    inline const std::vector<uint32_t>& GetChangedNodes() const
+    {
+        return m_changedNodes;
+    }
+    // Watcher fired without saying where so file contents could have changed anywhere
+    inline bool IsUnknownChange() const
+    {
+        return m_unknownChange;
+    }
+
+    inline uint32_t GetNodeCount() const
+    {
+        return (uint32_t)m_nodes.size();
+    }
+    inline bool IsValid(uint32_t a_index) const
+    {
+        return a_index < m_nodes.size() && m_nodes[a_index].Valid;
+    }
+    inline const DirectoryModelNode& GetNode(uint32_t a_index) const
+    {
+        return m_nodes[a_index];
+    }
+    inline bool IsEmpty(uint32_t a_index) const
+    {
+        const DirectoryModelNode& node = m_nodes[a_index];
+
+        return node.Children.empty() && node.Files.empty();
+    }
+
+    uint32_t GetNodeIndex(const std::filesystem::path& a_path) const;
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
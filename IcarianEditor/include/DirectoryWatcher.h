@@ -0,0 +1,66 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#ifdef WIN32
+#include "Core/WindowsHeaders.h"
+#endif
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Reports directories whose contents have changed without having to walk the tree
+// On Linux every directory gets its own inotify watch so changes are reported per directory
+// On Windows a single recursive change notification is used which cannot say where the change happened
+class DirectoryWatcher
+{
+private:
+#ifdef WIN32
+    HANDLE                                     m_handle;
+#else
+    int                                        m_fd;
+    std::unordered_map<int, std::string>       m_watches;
+    std::unordered_map<std::string, int>       m_paths;
+#endif
+
+protected:
+
+public:
+    DirectoryWatcher();
+    ~DirectoryWatcher();
+
+    void Watch(const std::filesystem::path& a_path);
+    void Unwatch(const std::filesystem::path& a_path);
+    void Clear();
+
+    // Returns true if anything changed since the last poll
+    // Changed directories are added to a_directories when known
+    // a_unknown gets set when the platform could not tell which directories changed
+    bool Poll(std::vector<std::filesystem::path>* a_directories, bool* a_unknown);
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
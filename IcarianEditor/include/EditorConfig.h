@@ -10,6 +10,8 @@
 #include <cstdint>
 #include <imgui.h>
 
+#include "TextureCompressor.h"
+
 class RuntimeManager;
 
 enum e_CodeEditor : uint32_t
@@ -49,15 +51,19 @@ class EditorConfig
 private:
     static constexpr char ConfigFile[] = "editorConfig.xml";
 
-    bool         m_useDegrees = false;
+    bool             m_useDegrees = false;
+
+    glm::vec4        m_backgroundColor = glm::vec4(0.1f, 0.1f, 0.1f, 1.0f);
+    float            m_editorMouseSensitivity = 0.01f;
+    // 0 is uncapped
+    uint32_t         m_backgroundFrameRate = 10;
 
-    glm::vec4    m_backgroundColor = glm::vec4(0.1f, 0.1f, 0.1f, 1.0f);
-    float        m_editorMouseSensitivity = 0.01f;
+    e_CodeEditor     m_codeEditor = CodeEditor_Default;
+    e_DefEditor      m_defEditor = DefEditor_Editor;
 
-    e_CodeEditor m_codeEditor = CodeEditor_Default;
-    e_DefEditor  m_defEditor = DefEditor_Editor;
+    e_TextureQuality m_textureQuality = TextureQuality_Normal;
 
-    ImGuiKey     m_keyBinds[KeyBindTarget_End];
+    ImGuiKey         m_keyBinds[KeyBindTarget_End];
 
     EditorConfig();
 
@@ -78,12 +84,18 @@ public:
     static float GetEditorMouseSensitivity();
     static void SetEditorMouseSensitivity(float a_editorMouseSensitivity);
 
+    static uint32_t GetBackgroundFrameRate();
+    static void SetBackgroundFrameRate(uint32_t a_backgroundFrameRate);
+
     static e_CodeEditor GetCodeEditor();
     static void SetCodeEditor(e_CodeEditor a_codeEditor);
 
     static e_DefEditor GetDefEditor();
     static void SetDefEditor(e_DefEditor a_defEditor);
 
+    static e_TextureQuality GetTextureQuality();
+    static void SetTextureQuality(e_TextureQuality a_textureQuality);
+
     static ImGuiKey GetKeyBind(e_KeyBindTarget a_keyBind);
     static const char* GetKeyBindName(e_KeyBindTarget a_keyBind);
     static void SetKeyBind(e_KeyBindTarget a_keyBind, ImGuiKey a_key);
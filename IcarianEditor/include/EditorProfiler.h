@@ -0,0 +1,180 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <glad/glad.h>
+#include <thread>
+
+#include "ProfilerData.h"
+
+// Define ICARIANEDITOR_DISABLE_PROFILER to compile all editor instrumentation out
+#ifndef ICARIANEDITOR_DISABLE_PROFILER
+#define EDITOR_PROFILE_CONCAT_IMPL(a, b) a##b
+#define EDITOR_PROFILE_CONCAT(a, b) EDITOR_PROFILE_CONCAT_IMPL(a, b)
+
+#define EDITOR_PROFILE_SCOPE(name) const EditorProfileScope EDITOR_PROFILE_CONCAT(editorProfileScope, __LINE__)(name)
+#define EDITOR_PROFILE_GPU_SCOPE(name) const EditorProfileGPUScope EDITOR_PROFILE_CONCAT(editorProfileGPUScope, __LINE__)(name)
+#define EDITOR_PROFILE_COUNTER(name, value) EditorProfiler::SetCounter(name, (float)(value))
+#define EDITOR_PROFILE_COUNTER_ADD(name, value) EditorProfiler::AddCounter(name, (float)(value))
+#else
+#define EDITOR_PROFILE_SCOPE(name)
+#define EDITOR_PROFILE_GPU_SCOPE(name)
+#define EDITOR_PROFILE_COUNTER(name, value)
+#define EDITOR_PROFILE_COUNTER_ADD(name, value)
+#endif
+
+#ifndef ICARIANEDITOR_DISABLE_PROFILER
+// Times the editor itself and feeds the results into ProfilerData under its own snapshots
+// Only records from the main thread everything else is ignored
+class EditorProfiler
+{
+private:
+    // GPU queries are read back a few frames late to avoid stalling on the driver
+    static constexpr uint32_t GPUFrameLatency = 4;
+
+    static constexpr char CPUSnapshotName[] = "Editor";
+    static constexpr char GPUSnapshotName[] = "Editor GPU";
+    static constexpr char CounterSnapshotName[] = "Editor Counters";
+
+    struct GPUFrame
+    {
+        ProfileScope Scope;
+        GLuint       Queries[ProfileFrameMax * 2];
+        bool         Pending;
+    };
+
+    static EditorProfiler* Instance;
+
+    std::thread::id                                m_mainThread;
+
+    bool                                           m_frameActive;
+
+    ProfileScope                                   m_cpuScope;
+    std::chrono::high_resolution_clock::time_point m_cpuStart[ProfileFrameMax];
+    uint16_t                                       m_cpuStack[ProfileFrameMax];
+    uint32_t                                       m_cpuDepth;
+
+    GPUFrame                                       m_gpuFrames[GPUFrameLatency];
+    uint32_t                                       m_gpuFrameIndex;
+    uint16_t                                       m_gpuStack[ProfileFrameMax];
+    uint32_t                                       m_gpuDepth;
+
+    ProfileScope                                   m_counterScope;
+
+    EditorProfiler();
+
+    static bool IsProfileThread();
+
+    void ResolveGPUFrame(GPUFrame* a_frame);
+    uint16_t GetCounterIndex(const char* a_name);
+
+protected:
+
+public:
+    ~EditorProfiler();
+
+    static void Init();
+    static void Destroy();
+
+    static void BeginFrame();
+    static void EndFrame();
+
+    static uint16_t BeginScope(const char* a_name);
+    static void EndScope(uint16_t a_index);
+
+    static uint16_t BeginGPUScope(const char* a_name);
+    static void EndGPUScope(uint16_t a_index);
+
+    static void SetCounter(const char* a_name, float a_value);
+    static void AddCounter(const char* a_name, float a_value);
+};
+
+class EditorProfileScope
+{
+private:
+    uint16_t m_index;
+
+protected:
+
+public:
+    inline EditorProfileScope(const char* a_name)
+    {
+        m_index = EditorProfiler::BeginScope(a_name);
+    }
+    inline ~EditorProfileScope()
+    {
+        EditorProfiler::EndScope(m_index);
+    }
+};
+
+class EditorProfileGPUScope
+{
+private:
+    uint16_t m_index;
+
+protected:
+
+public:
+    inline EditorProfileGPUScope(const char* a_name)
+    {
+        m_index = EditorProfiler::BeginGPUScope(a_name);
+    }
+    inline ~EditorProfileGPUScope()
+    {
+        EditorProfiler::EndGPUScope(m_index);
+    }
+};
+#else
+// Frame hooks are still called by the application so leave empty ones, no GL queries or snapshots get made
+class EditorProfiler
+{
+private:
+
+protected:
+
+public:
+    static inline void Init()
+    {
+
+    }
+    static inline void Destroy()
+    {
+
+    }
+
+    static inline void BeginFrame()
+    {
+
+    }
+    static inline void EndFrame()
+    {
+
+    }
+};
+#endif
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
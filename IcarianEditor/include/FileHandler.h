@@ -4,46 +4,55 @@
 
 #pragma once
 
+#define GLM_FORCE_SWIZZLE 
+#include <glm/glm.hpp>
+
 #include <filesystem>
 #include <functional>
 #include <glad/glad.h>
 #include <unordered_map>
 
 class AssetLibrary;
+class Project;
 class RuntimeStorage;
 class Texture;
+class ThumbnailService;
 class Workspace;
 
-#include "EditorFileHandlerInteropStructures.h"
-
 class FileHandler
 {
 public:
     using FileCallback = std::function<void(const std::filesystem::path&, const std::filesystem::path&, uint32_t, const uint8_t*)>;
 
 private:
-    FileTextureHandle                             m_runtimeTexHandle;
-
     AssetLibrary*                                 m_assets;
     RuntimeStorage*                               m_storage;
+    Project*                                      m_project;
+
+    ThumbnailService*                             m_thumbnails;
 
     std::unordered_map<std::string, Texture*>     m_extTex;
     std::unordered_map<std::string, FileCallback> m_extOpenCallback;
     std::unordered_map<std::string, FileCallback> m_extDragCallback;
 
-    FileHandler(AssetLibrary* a_assets, RuntimeStorage* a_storage, Workspace* a_workspace);
+    FileHandler(AssetLibrary* a_assets, RuntimeStorage* a_storage, Project* a_project, Workspace* a_workspace);
     
 protected:
 
 public:
     ~FileHandler();
 
-    static void SetFileHandle(const FileTextureHandle& a_handle);
-
-    static void Init(AssetLibrary* a_assets, RuntimeStorage* a_storage, Workspace* a_workspace);
+    static void Init(AssetLibrary* a_assets, RuntimeStorage* a_storage, Project* a_project, Workspace* a_workspace);
     static void Destroy();
 
-    static void GetFileData(const std::filesystem::path& a_path, FileCallback** a_openCallback, FileCallback** a_dragCallback, GLuint* a_texture);
+    static void Update();
+    static void Clear();
+
+    // Previews for these get regenerated if the file has changed
+    static void InvalidateFile(const std::filesystem::path& a_path);
+    static void InvalidateFiles();
+
+    static void GetFileData(const std::filesystem::path& a_path, FileCallback** a_openCallback, FileCallback** a_dragCallback, GLuint* a_texture, glm::vec2* a_uv0, glm::vec2* a_uv1);
 };
 
 // MIT License
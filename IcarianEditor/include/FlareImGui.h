@@ -158,6 +158,7 @@ namespace FlareImGui
     bool Image(const std::string_view& a_path, const glm::vec2& a_size);
 
     bool ImageButton(const char* a_label, GLuint a_texture, const glm::vec2& a_size, bool a_background = true);
+    bool ImageButton(const char* a_label, GLuint a_texture, const glm::vec2& a_size, const glm::vec2& a_uv0, const glm::vec2& a_uv1, bool a_background = true);
     bool ImageButton(const char* a_label, Texture* a_texture, const glm::vec2& a_size, bool a_background = true);
     bool ImageButton(const char* a_label, const char* a_path, const ImVec2& a_size, bool a_background = true);
     bool ImageButton(const std::string_view& a_label, const std::string_view& a_path, const glm::vec2& a_size, bool a_background = true);
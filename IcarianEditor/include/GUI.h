@@ -5,16 +5,19 @@
 #pragma once
 
 #include <cstdint>
-#include <list>
 #include <string>
 #include <vector>
 
+#include "ScratchArena.h"
+
 class AppMain;
 class AssetLibrary;
 
+struct ImGuiListClipper;
+
 struct PathString
 {
-    std::string IDStr;
+    uint32_t    ID;
     std::string Path;
 };
 
@@ -24,9 +27,18 @@ private:
     AppMain*                m_app;
     AssetLibrary*           m_assets;
     
-    std::list<std::string>  m_id;
+    // Each entry is already combined with the one below it so the top is the full ID
+    std::vector<uint32_t>   m_id;
     std::vector<PathString> m_pathStrings;
 
+    // Labels coming from C# get converted in here instead of going through the heap every call
+    ScratchArena            m_scratch;
+
+    // Stack so a clipped list can sit inside another one
+    std::vector<ImGuiListClipper*> m_clippers;
+    // Scopes a command buffer opened so they can be closed if it stops early
+    std::vector<uint32_t>   m_commandScopes;
+
     float                   m_width;
 
     GUI(AppMain* a_app, AssetLibrary* a_assets);
@@ -37,7 +49,21 @@ public:
     GUI() = delete;
     ~GUI();
 
-    std::string GetID() const;
+    static constexpr uint32_t IDSeed = 2166136261U;
+
+    static uint32_t HashID(const char* a_str, uint32_t a_size, uint32_t a_seed);
+    static uint32_t HashID(const uint16_t* a_str, uint32_t a_size, uint32_t a_seed);
+    static uint32_t HashID(uint32_t a_value, uint32_t a_seed);
+
+    inline uint32_t GetID() const
+    {
+        if (m_id.empty())
+        {
+            return IDSeed;
+        }
+
+        return m_id.back();
+    }
 
     inline float GetWidth() const
     {
@@ -54,15 +80,18 @@ public:
 
     static void SetWidth(float a_width);
 
-    inline void PushID(const std::string_view& a_str)
+    inline void PushID(uint32_t a_id)
     {
-        m_id.push_front(std::string(a_str));
+        m_id.emplace_back(a_id);
     }
     inline void PopID()
     {
-        m_id.pop_front();
+        m_id.pop_back();
     }
 
+    // Only valid until the next frame
+    char* ToScratchUTF8(const uint16_t* a_str, uint32_t a_length);
+
     void OpenAssetPathModal(char* const* a_extensions, uint32_t a_extensionCount);
     inline void PushPathString(const PathString& a_string)
     {
@@ -70,8 +99,16 @@ public:
     }
     std::string GetPathString();
 
+    void BeginListClipper(uint32_t a_count, float a_itemHeight);
+    bool StepListClipper(uint32_t* a_start, uint32_t* a_end);
+    void EndListClipper();
+
+    void ExecuteCommands(const uint32_t* a_commands, uint32_t a_commandCount, const uint16_t* a_strings, uint32_t a_stringLength, uint32_t* a_results, uint32_t a_resultCount);
+
     static void Init(AppMain* a_app, AssetLibrary* a_assets);
     static void Destroy();
+
+    static void NewFrame();
 };
 
 // MIT License
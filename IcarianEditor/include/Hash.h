@@ -0,0 +1,48 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+
+static constexpr uint64_t FNVOffsetBasis = 0xcbf29ce484222325;
+static constexpr uint64_t FNVPrime64 = 0x100000001b3;
+
+// FNV-1a, good enough for cache keys and buckets but not for anything that has to resist tampering
+// Feed the previous result back in as the seed to hash several buffers as one
+inline uint64_t FNVHash(const void* a_data, uint64_t a_size, uint64_t a_seed = FNVOffsetBasis)
+{
+    const uint8_t* data = (const uint8_t*)a_data;
+
+    uint64_t hash = a_seed;
+    for (uint64_t i = 0; i < a_size; ++i)
+    {
+        hash ^= data[i];
+        hash *= FNVPrime64;
+    }
+
+    return hash;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -4,10 +4,18 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <initializer_list>
 #include <string>
 #include <vector>
 
+struct IOWritePart
+{
+    const void* Data;
+    uint32_t    Size;
+};
+
 class IO
 {
 private:
@@ -16,10 +24,16 @@ protected:
 
 public:
     static std::filesystem::path GetHomePath();
+    // Per user directory for things the editor writes about itself like logs
+    static std::filesystem::path GetEditorDataPath();
     static bool ValidatePathName(const std::string_view& a_name);
 
     static std::filesystem::path GetRelativePath(const std::filesystem::path& a_relative, const std::filesystem::path& a_path);
 
+    // Writes the parts out to a temp file unique to the calling thread then renames it over the path
+    // Readers either see the old file or the whole new one even with several workers writing the same path
+    static bool WriteFileAtomic(const std::filesystem::path& a_path, const std::initializer_list<IOWritePart>& a_parts);
+
     static std::filesystem::path GetCSCPath();
 
     static std::vector<std::filesystem::path> GetDrives();
@@ -4,9 +4,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <fstream>
 #include <functional>
+#include <mutex>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 class ConsoleWindow;
 
@@ -17,21 +24,91 @@ enum e_LoggerMessageType : uint32_t
     LoggerMessageType_Error
 };
 
+enum e_LoggerMessageSource : uint32_t
+{
+    LoggerMessageSource_Editor,
+    LoggerMessageSource_Engine,
+    LoggerMessageSource_Script
+};
+
+struct LoggerMessage
+{
+    std::string Message;
+    e_LoggerMessageType Type;
+    e_LoggerMessageSource Source;
+    bool Print;
+};
+
+// Messages get queued from any thread and are written out by a background thread
+// Consoles only receive them in batches when the main thread calls Update
 class Logger
 {
 public:
+    // Log file rolls over once it gets this big with a few old logs kept around
+    static constexpr uint32_t MaxLogFileSize = 1024 * 1024 * 4;
+    static constexpr uint32_t MaxLogFiles = 3;
+    // Editors running at the same time each take their own log, past this they fall back to the process id
+    static constexpr uint32_t MaxLogSlots = 8;
+    // Newest messages that have not been written out yet, what a crash can still save
+    static constexpr uint32_t CrashBufferSize = 1024 * 64;
 
 private:
+    static Logger* Instance;
+
     static std::vector<ConsoleWindow*> Windows;
+
+    std::thread                m_thread;
+    std::mutex                 m_writeLock;
+    std::condition_variable    m_writeSignal;
+    std::vector<LoggerMessage> m_writeQueue;
+    bool                       m_shutdown;
+
+    std::mutex                 m_consoleLock;
+    std::vector<LoggerMessage> m_consoleQueue;
+
+    std::ofstream              m_file;
+    std::string                m_filePath;
+    uint64_t                   m_fileSize;
+    int                        m_lockFile;
+
+    // Read from the signal handler so only atomics and memory that never moves
+    char                       m_crashBuffer[CrashBufferSize];
+    std::atomic<uint64_t>      m_crashQueued;
+    std::atomic<uint64_t>      m_crashWritten;
+    std::atomic<int>           m_crashFile;
+
+    Logger(const std::string_view& a_path);
+
+    static void PushMessage(const std::string_view& a_string, e_LoggerMessageType a_type, e_LoggerMessageSource a_source, bool a_print);
+
+    void AppendCrashBuffer(const std::string_view& a_str);
+
+    void OpenLogFile();
+    void RotateLogFiles();
+    void WriteMessages(const std::vector<LoggerMessage>& a_messages);
+
+    void Run();
+
 protected:
 
 public:
+    ~Logger();
+
+    static void Init(const std::string_view& a_path);
+    static void Destroy();
+
+    // Hands queued messages to the console windows should be called once a frame from the main thread
+    static void Update();
+    // Best effort write for when the process is going down and the writer thread cannot be trusted
+    // Called from a signal handler so only does raw writes from the preallocated buffer
+    static void CrashFlush(int a_signal);
+
     static void AddConsoleWindow(ConsoleWindow* a_window);
     static void RemoveConsoleWindow(ConsoleWindow* a_window);
 
-    static void Message(const std::string_view& a_string, bool a_editor = true, bool a_print = true);
-    static void Warning(const std::string_view& a_string, bool a_editor = true, bool a_print = true);
-    static void Error(const std::string_view& a_string, bool a_editor = true, bool a_print = true);
+    static void Message(const std::string_view& a_string, e_LoggerMessageSource a_source = LoggerMessageSource_Editor, bool a_print = true);
+    static void Warning(const std::string_view& a_string, e_LoggerMessageSource a_source = LoggerMessageSource_Editor, bool a_print = true);
+    static void Error(const std::string_view& a_string, e_LoggerMessageSource a_source = LoggerMessageSource_Editor, bool a_print = true);
 };
 
 // MIT License
@@ -4,31 +4,39 @@
 
 #pragma once
 
-#include "InteropTypes.h"
+#include "Modals/Modal.h"
 
-#ifdef CUBE_LANGUAGE_CSHARP
-namespace IcarianEditor {
-#endif
+class AppMain;
+class FileDialogBlock;
 
-IOP_CSINTERNAL enum IOP_ENUM_NAME(FileTextureMode) : IOP_UINT16
+enum e_ProfilerCaptureMode
 {
-    IOP_ENUM_VALUE(FileTextureMode, Null) = IOP_UINT16_MAX,
-    IOP_ENUM_VALUE(FileTextureMode, Texture) = 0,
+    ProfilerCaptureMode_ExportTrace,
+    ProfilerCaptureMode_Save,
+    ProfilerCaptureMode_Load
 };
 
-IOP_PACKED IOP_CSINTERNAL struct FileTextureHandle
+class ProfilerCaptureModal : public Modal
 {
-    IOP_CSPUBLIC IOP_UINT32 Addr;
-    IOP_CSPUBLIC IOP_ENUM_NAME(FileTextureMode) Mode;
-};
+private:
+    AppMain*              m_app;
+
+    FileDialogBlock*      m_fileDialogBlock;
+
+    e_ProfilerCaptureMode m_mode;
 
-#ifdef CUBE_LANGUAGE_CSHARP
-}
-#endif
+protected:
+
+public:
+    ProfilerCaptureModal(AppMain* a_app, e_ProfilerCaptureMode a_mode);
+    virtual ~ProfilerCaptureModal();
+
+    virtual bool Update();
+};
 
 // MIT License
 // 
-// Copyright (c) 2024 River Govers
+// Copyright (c) 2025 River Govers
 // 
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
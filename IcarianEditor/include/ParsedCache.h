@@ -0,0 +1,67 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+enum e_ParsedCacheType : uint32_t
+{
+    ParsedCacheType_Def,
+    ParsedCacheType_Scene
+};
+
+// Payload is whatever the managed side wrote, this only guards it
+// Source hash ties it to the xml it came from and the payload hash catches truncated or corrupt files
+struct ParsedCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Type;
+    uint32_t PayloadSize;
+    uint64_t SourceHash;
+    uint64_t PayloadHash;
+};
+
+// Parsed defs and scenes kept in the project cache so opening a project does not have to go through all the xml again
+// Files are named off the asset path so an edited file replaces its old entry instead of piling up
+// The xml is always the source of truth, anything that does not check out just gets parsed again
+class ParsedCache
+{
+public:
+    static constexpr uint32_t Magic = 0x53504349; // ICPS
+    // Bump when the container changes, the payload carries its own version for the managed side
+    static constexpr uint32_t Version = 1;
+
+    static uint64_t HashSource(const std::filesystem::path& a_path, const uint8_t* a_data, uint64_t a_size);
+    static std::filesystem::path GetCacheFile(const std::filesystem::path& a_cachePath, const std::filesystem::path& a_path, e_ParsedCacheType a_type);
+
+    static bool Read(const std::filesystem::path& a_path, e_ParsedCacheType a_type, uint64_t a_sourceHash, std::vector<uint8_t>* a_payload);
+    static bool Write(const std::filesystem::path& a_path, e_ParsedCacheType a_type, uint64_t a_sourceHash, const uint8_t* a_payload, uint32_t a_size);
+};
+
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,20 @@ static constexpr int ProfileNameMax = 16;
 static constexpr int ProfileFrameMax = 64;
 static constexpr int ProfileMaxScopes = 2048;
 
+static constexpr uint16_t ProfileNoParent = UINT16_MAX;
+
+// Log spaced buckets from 1us to 1s which keeps percentile error to roughly 5%
+static constexpr int ProfileHistogramBuckets = 128;
+static constexpr float ProfileHistogramMinTime = 0.001f;
+static constexpr float ProfileHistogramMaxTime = 1000.0f;
+
+// Counters share the scope layout but hold plain values rather then times
+enum e_ProfileUnit : uint32_t
+{
+    ProfileUnit_Milliseconds = 0,
+    ProfileUnit_Count = 1
+};
+
 struct ProfileFrame
 {
     char Name[ProfileNameMax];
@@ -26,13 +41,44 @@ struct ProfileScope
     ProfileFrame Frames[ProfileFrameMax];
 };
 
+// Parent/child lookup for the frames of a scope
+// Children of a frame are stored contiguously in Children starting at ChildStart
+struct ProfileHierarchy
+{
+    uint16_t FrameCount;
+    uint16_t Parents[ProfileFrameMax];
+    uint16_t ChildStart[ProfileFrameMax];
+    uint16_t ChildCount[ProfileFrameMax];
+    uint16_t Children[ProfileFrameMax];
+};
+
+// Rolling statistics over the frames currently held in a snapshot
+// Updated as scopes are pushed and evicted so nothing needs to be rescanned to draw
+struct ProfileStatistics
+{
+    char Name[ProfileNameMax];
+    uint32_t Count;
+    float Min;
+    float Max;
+    double Sum;
+    uint16_t Buckets[ProfileHistogramBuckets];
+};
+
 struct ProfileSnapshot
 {
     uint32_t Index;
     uint32_t StartIndex;
     uint32_t Count;
+    e_ProfileUnit Unit;
     std::string Name;
+    ProfileHierarchy Hierarchy;
+    ProfileStatistics Statistics[ProfileFrameMax];
     ProfileScope Scopes[ProfileMaxScopes];
+
+    inline const ProfileScope& GetLatestScope() const
+    {
+        return Scopes[(Index + ProfileMaxScopes - 1) % ProfileMaxScopes];
+    }
 };
 
 class ProfilerData
@@ -42,6 +88,9 @@ private:
 
     std::vector<ProfileSnapshot> m_snapshots;
 
+    static void AddStatistics(ProfileSnapshot* a_snapshot, const ProfileScope& a_scope);
+    static void RemoveStatistics(ProfileSnapshot* a_snapshot, const ProfileScope& a_scope);
+
     ProfilerData();
 protected:
 
@@ -53,8 +102,18 @@ public:
 
     static void Clear();
 
-    static void PushData(const ProfileScope& a_scope);
-    static std::vector<ProfileSnapshot> GetSnapshots();
+    static void PushData(const ProfileScope& a_scope, e_ProfileUnit a_unit = ProfileUnit_Milliseconds);
+    static const std::vector<ProfileSnapshot>& GetSnapshots();
+
+    static void BuildHierarchy(const ProfileScope& a_scope, ProfileHierarchy* a_hierarchy);
+
+    static uint32_t GetHistogramBucket(float a_time);
+    static float GetHistogramBucketTime(uint32_t a_bucket);
+    static float GetQuantile(const ProfileStatistics& a_statistics, float a_quantile);
+
+    static bool ExportChromeTrace(const std::filesystem::path& a_path);
+    static bool SaveCapture(const std::filesystem::path& a_path);
+    static bool LoadCapture(const std::filesystem::path& a_path);
 };
 
 // MIT License
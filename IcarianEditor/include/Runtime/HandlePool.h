@@ -0,0 +1,223 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Slot storage for runtime resources handed out to the engine as uint32 addresses
+// Values sit contiguously and freed slots go on a free list so allocating and freeing is O(1)
+// Handles carry a generation in the upper bits so an address that outlives its resource is caught instead of aliasing whatever reused the slot
+template<typename T>
+class HandlePool
+{
+private:
+    static constexpr uint32_t IndexBits = 24;
+    static constexpr uint32_t IndexMask = (1U << IndexBits) - 1;
+    static constexpr uint32_t GenerationMask = 0xFF;
+    // Slots are never handed out again once they reach this so a stale handle cannot wrap around and alias a new value
+    static constexpr uint32_t RetiredGeneration = GenerationMask;
+    // Top index is never used so a handle can never end up as -1
+    static constexpr uint32_t MaxSlots = IndexMask;
+
+    std::vector<T>        m_values;
+    std::vector<uint8_t>  m_generations;
+    std::vector<bool>     m_alive;
+    std::vector<uint32_t> m_freeList;
+
+    uint32_t              m_aliveCount;
+
+    static constexpr uint32_t GetIndex(uint32_t a_handle)
+    {
+        return a_handle & IndexMask;
+    }
+    static constexpr uint32_t GetGeneration(uint32_t a_handle)
+    {
+        return a_handle >> IndexBits;
+    }
+    inline uint32_t MakeHandle(uint32_t a_index) const
+    {
+        return ((uint32_t)m_generations[a_index] << IndexBits) | a_index;
+    }
+
+    // Bumping the generation is what invalidates any handles still floating around
+    // Returns false when the slot got retired and should not go back on the free list
+    bool ReleaseSlot(uint32_t a_index, const T& a_empty)
+    {
+        const uint32_t generation = (uint32_t)m_generations[a_index] + 1;
+
+        m_values[a_index] = a_empty;
+        m_generations[a_index] = (uint8_t)generation;
+        m_alive[a_index] = false;
+
+        return generation < RetiredGeneration;
+    }
+    inline bool IsRetired(uint32_t a_index) const
+    {
+        return !m_alive[a_index] && m_generations[a_index] == RetiredGeneration;
+    }
+
+protected:
+
+public:
+    HandlePool()
+    {
+        m_aliveCount = 0;
+    }
+    ~HandlePool()
+    {
+
+    }
+
+    inline uint32_t GetAliveCount() const
+    {
+        return m_aliveCount;
+    }
+    inline uint32_t GetCapacity() const
+    {
+        return (uint32_t)m_values.size();
+    }
+
+    // Returns -1 when out of slots
+    uint32_t Allocate(const T& a_value)
+    {
+        uint32_t index;
+        if (!m_freeList.empty())
+        {
+            index = m_freeList.back();
+            m_freeList.pop_back();
+
+            m_values[index] = a_value;
+        }
+        else
+        {
+            index = (uint32_t)m_values.size();
+            if (index >= MaxSlots)
+            {
+                return -1;
+            }
+
+            m_values.emplace_back(a_value);
+            m_generations.emplace_back(0);
+            m_alive.emplace_back(false);
+        }
+
+        m_alive[index] = true;
+        ++m_aliveCount;
+
+        return MakeHandle(index);
+    }
+    bool Free(uint32_t a_handle, const T& a_empty = T())
+    {
+        if (!IsValid(a_handle))
+        {
+            return false;
+        }
+
+        const uint32_t index = GetIndex(a_handle);
+
+        --m_aliveCount;
+
+        if (ReleaseSlot(index, a_empty))
+        {
+            m_freeList.emplace_back(index);
+        }
+
+        return true;
+    }
+
+    inline bool IsValid(uint32_t a_handle) const
+    {
+        const uint32_t index = GetIndex(a_handle);
+
+        return index < m_values.size() && m_alive[index] && m_generations[index] == GetGeneration(a_handle);
+    }
+
+    inline T Get(uint32_t a_handle, const T& a_default = T()) const
+    {
+        if (!IsValid(a_handle))
+        {
+            return a_default;
+        }
+
+        return m_values[GetIndex(a_handle)];
+    }
+    inline bool Set(uint32_t a_handle, const T& a_value)
+    {
+        if (!IsValid(a_handle))
+        {
+            return false;
+        }
+
+        m_values[GetIndex(a_handle)] = a_value;
+
+        return true;
+    }
+
+    // Calls the functor with every live value, used for tearing down what the pool owns
+    template<typename F>
+    void ForEach(F a_func) const
+    {
+        const uint32_t count = (uint32_t)m_values.size();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (m_alive[i])
+            {
+                a_func(m_values[i]);
+            }
+        }
+    }
+
+    // Generations are kept so handles from before the clear stay stale
+    void Clear(const T& a_empty = T())
+    {
+        const uint32_t count = (uint32_t)m_values.size();
+
+        m_freeList.clear();
+        m_freeList.reserve(count);
+        // Reverse so the low slots get handed out first again
+        for (uint32_t i = count; i > 0; --i)
+        {
+            const uint32_t index = i - 1;
+            if (m_alive[index])
+            {
+                if (!ReleaseSlot(index, a_empty))
+                {
+                    continue;
+                }
+            }
+            else if (IsRetired(index))
+            {
+                continue;
+            }
+
+            m_freeList.emplace_back(index);
+        }
+
+        m_aliveCount = 0;
+    }
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+struct MeshOptimizerStats
+{
+    uint32_t VertexCountBefore;
+    uint32_t VertexCountAfter;
+    float    ACMRBefore;
+    float    ACMRAfter;
+};
+
+// Import time pass to get meshes into a GPU friendly order before they get uploaded and cached
+// Works on raw vertex bytes so it does not care about the vertex layout beyond where the position is
+class MeshOptimizer
+{
+public:
+    // Modelled post transform cache size used for Tipsify and the ACMR numbers
+    static constexpr uint32_t CacheSize = 16;
+    // Overdraw ordering is thrown out if it costs more then this much vertex cache efficiency
+    static constexpr float OverdrawThreshold = 1.05f;
+
+    // Average cache miss ratio, vertex shader invocations per triangle with a FIFO cache
+    static float GetACMR(const uint32_t* a_indices, uint32_t a_indexCount, uint32_t a_vertexCount);
+
+    // Merges byte identical vertices and returns the new vertex count
+    static uint32_t Deduplicate(uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t* a_indices, uint32_t a_indexCount);
+    // Tipsify triangle ordering, outputs the first triangle of each cluster for the overdraw pass
+    static void OptimizeVertexCache(uint32_t* a_indices, uint32_t a_indexCount, uint32_t a_vertexCount, std::vector<uint32_t>* a_clusters);
+    // Sorts clusters so outward facing geometry is drawn first
+    static void OptimizeOverdraw(uint32_t* a_indices, uint32_t a_indexCount, const uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t a_positionOffset, const std::vector<uint32_t>& a_clusters);
+    // Reorders vertices into first use order and returns the new vertex count
+    static uint32_t OptimizeVertexFetch(uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t* a_indices, uint32_t a_indexCount);
+
+    static MeshOptimizerStats Optimize(uint8_t* a_vertices, uint32_t* a_vertexCount, uint32_t a_vertexStride, uint32_t a_positionOffset, uint32_t* a_indices, uint32_t a_indexCount);
+
+    template<typename T>
+    static MeshOptimizerStats Optimize(std::vector<T>* a_vertices, std::vector<uint32_t>* a_indices, uint32_t a_positionOffset)
+    {
+        uint32_t vertexCount = (uint32_t)a_vertices->size();
+
+        const MeshOptimizerStats stats = Optimize((uint8_t*)a_vertices->data(), &vertexCount, (uint32_t)sizeof(T), a_positionOffset, a_indices->data(), (uint32_t)a_indices->size());
+        a_vertices->resize(vertexCount);
+
+        return stats;
+    }
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
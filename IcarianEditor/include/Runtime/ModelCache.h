@@ -0,0 +1,135 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#ifdef WIN32
+#include "Core/WindowsHeaders.h"
+#endif
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum e_ModelCacheType : uint32_t
+{
+    ModelCacheType_Mesh,
+    ModelCacheType_SkinnedMesh,
+    ModelCacheType_Bones
+};
+
+// Layout of a cache file is the header followed by the vertices, indices, bones and then the bone names
+// Every section is kept 16 byte aligned so it can be used straight out of the mapping
+struct ModelCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Type;
+    uint32_t ImportFlags;
+    uint64_t SourceHash;
+    uint32_t VertexStride;
+    uint32_t VertexCount;
+    uint32_t IndexCount;
+    uint32_t BoneCount;
+    uint32_t NameSize;
+    float    RadiusSqr;
+    uint64_t VertexOffset;
+    uint64_t IndexOffset;
+    uint64_t BoneOffset;
+    uint64_t NameOffset;
+};
+
+struct ModelCacheBone
+{
+    float    BindPose[16];
+    uint32_t Parent;
+    uint32_t NameOffset;
+    uint32_t NameLength;
+    uint32_t Padding;
+};
+
+// Read only memory mapping of a cache file
+// Only hands out pointers once the header has been checked against what the caller asked for
+class ModelCacheFile
+{
+private:
+#ifdef WIN32
+    HANDLE         m_file;
+    HANDLE         m_mapping;
+#endif
+
+    const uint8_t* m_data;
+    uint64_t       m_size;
+
+    bool Validate(e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash) const;
+
+protected:
+
+public:
+    ModelCacheFile();
+    ~ModelCacheFile();
+
+    bool Open(const std::filesystem::path& a_path, e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash);
+    void Close();
+
+    inline const ModelCacheHeader* GetHeader() const
+    {
+        return (const ModelCacheHeader*)m_data;
+    }
+    inline const void* GetVertices() const
+    {
+        return m_data + GetHeader()->VertexOffset;
+    }
+    inline const uint32_t* GetIndices() const
+    {
+        return (const uint32_t*)(m_data + GetHeader()->IndexOffset);
+    }
+    inline const ModelCacheBone* GetBones() const
+    {
+        return (const ModelCacheBone*)(m_data + GetHeader()->BoneOffset);
+    }
+    inline std::string_view GetBoneName(const ModelCacheBone& a_bone) const
+    {
+        return std::string_view((const char*)(m_data + GetHeader()->NameOffset + a_bone.NameOffset), a_bone.NameLength);
+    }
+};
+
+// Imported model data keyed by the source file contents, import flags and mesh index
+// Saves running assimp over the source file every time a project is loaded
+class ModelCache
+{
+public:
+    static constexpr uint32_t Magic = 0x444D4349; // ICMD
+    // Bump when the import code changes what ends up in the file
+    static constexpr uint32_t Version = 2;
+
+    static std::filesystem::path GetCacheFile(const std::filesystem::path& a_cachePath, uint64_t a_sourceHash, e_ModelCacheType a_type, uint32_t a_importFlags, uint32_t a_index);
+
+    static bool WriteMesh(const std::filesystem::path& a_path, e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash, const void* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, const uint32_t* a_indices, uint32_t a_indexCount, float a_radiusSqr);
+    static bool WriteBones(const std::filesystem::path& a_path, uint32_t a_importFlags, uint64_t a_sourceHash, const std::vector<ModelCacheBone>& a_bones, const std::vector<std::string>& a_names);
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
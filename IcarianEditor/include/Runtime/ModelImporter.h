@@ -0,0 +1,139 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#define GLM_FORCE_SWIZZLE 
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Runtime/ModelCache.h"
+
+namespace Assimp
+{
+    class Importer;
+}
+
+enum e_ModelImportType : uint32_t
+{
+    ModelImportType_Mesh,
+    ModelImportType_SkinnedMesh,
+    ModelImportType_Bones,
+    ModelImportType_Animation
+};
+
+enum e_ModelImportTarget : uint32_t
+{
+    ModelImportTarget_Translation,
+    ModelImportTarget_Rotation,
+    ModelImportTarget_Scale
+};
+
+struct ModelImportFrame
+{
+    float     Time;
+    glm::vec4 Data;
+};
+
+struct ModelImportChannel
+{
+    std::string                   Name;
+    e_ModelImportTarget           Target;
+    std::vector<ModelImportFrame> Frames;
+};
+
+// Plain data only, anything touching GL or Mono has to be built from this on the main thread
+struct ModelImportResult
+{
+    bool                            Valid = false;
+
+    uint16_t                        VertexStride = 0;
+    uint32_t                        VertexCount = 0;
+    std::vector<uint8_t>            Vertices;
+    std::vector<uint32_t>           Indices;
+
+    std::vector<ModelCacheBone>     Bones;
+    std::vector<std::string>        BoneNames;
+
+    std::vector<ModelImportChannel> Channels;
+};
+
+// Runs assimp imports on worker threads, each worker keeps its own importer to reuse between jobs
+// Checks the model cache first and writes back anything it had to import
+class ModelImporter
+{
+private:
+    struct ImportJob
+    {
+        e_ModelImportType                Type;
+        uint32_t                         Index;
+        std::filesystem::path            Path;
+        std::filesystem::path            CachePath;
+        std::vector<uint8_t>             Data;
+        std::promise<ModelImportResult>  Promise;
+    };
+
+    std::vector<std::thread> m_workers;
+    std::mutex               m_jobLock;
+    std::condition_variable  m_jobSignal;
+    std::deque<ImportJob>    m_jobs;
+    bool                     m_shutdown;
+
+    std::mutex               m_immediateLock;
+    Assimp::Importer*        m_immediateImporter;
+
+    void Run();
+
+    static void RunJob(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result);
+
+    static void ImportMesh(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result);
+    static void ImportSkinnedMesh(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result);
+    static void ImportBones(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result);
+    static void ImportAnimation(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result);
+
+protected:
+
+public:
+    ModelImporter();
+    ~ModelImporter();
+
+    // Copies the data so the asset library can be refreshed while the job is queued
+    std::future<ModelImportResult> Import(e_ModelImportType a_type, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, uint32_t a_index, const std::filesystem::path& a_cachePath);
+    // Runs on the calling thread for callers that would only block on the future anyway
+    // Saves waiting behind whatever is already queued
+    ModelImportResult ImportImmediate(e_ModelImportType a_type, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, uint32_t a_index, const std::filesystem::path& a_cachePath);
+    // Queued jobs resolve with an invalid result rather then leaving their futures hanging
+    void Clear();
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
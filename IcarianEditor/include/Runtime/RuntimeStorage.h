@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <future>
 #include <mono/metadata/object.h>
 #include <unordered_map>
 #include <vector>
@@ -13,33 +14,43 @@
 class AssetLibrary;
 class Model;
 class PixelShader;
+class Project;
 class Texture;
+class TextureLoader;
 class VertexShader;
 
+#include "Runtime/HandlePool.h"
+#include "Runtime/ModelImporter.h"
+
 #include "EngineMaterialInteropStructures.h"
+#include "EngineSkeletonInteropStructures.h"
 #include "EngineTextureSamplerInteropStructures.h"
 
 class RuntimeStorage
 {
 private:
-    AssetLibrary*                                m_assets;
+    AssetLibrary*                                                  m_assets;
+    Project*                                                       m_project;
+    ModelImporter*                                                 m_modelImporter;
+    TextureLoader*                                                 m_textureLoader;
      
-    std::vector<Model*>                          m_models;
-    std::vector<Texture*>                        m_textures;
-    std::vector<TextureSamplerBuffer>            m_samplers;
+    HandlePool<Model*>                                             m_models;
+    std::unordered_map<uint32_t, std::future<ModelImportResult>>   m_pendingModels;
+    HandlePool<Texture*>                                           m_textures;
+    HandlePool<TextureSamplerBuffer>                               m_samplers;
 
-    std::unordered_map<std::string, std::string> m_vertexImports;
-    std::unordered_map<std::string, std::string> m_pixelImports;
+    std::unordered_map<std::string, std::string>                   m_vertexImports;
+    std::unordered_map<std::string, std::string>                   m_pixelImports;
 
-    std::vector<VertexShader*>                   m_vertexShaders;
-    std::vector<PixelShader*>                    m_pixelShaders;
+    HandlePool<VertexShader*>                                      m_vertexShaders;
+    HandlePool<PixelShader*>                                       m_pixelShaders;
 
-    std::vector<RenderProgram>                   m_renderPrograms;
+    HandlePool<RenderProgram>                                      m_renderPrograms;
 
 protected:
 
 public:
-    RuntimeStorage(AssetLibrary* a_assets);
+    RuntimeStorage(AssetLibrary* a_assets, Project* a_project);
     ~RuntimeStorage();
 
     inline AssetLibrary* GetLibrary() const
@@ -47,12 +58,14 @@ public:
         return m_assets;
     }
 
+    std::filesystem::path GetCachePath() const;
+
     uint32_t GenerateVertexShader(const std::filesystem::path& a_path);
     void AddVertexImport(const std::string_view& a_key, const std::string_view& a_value);
     void DestroyVertexShader(uint32_t a_addr);
     inline VertexShader* GetVertexShader(uint32_t a_addr) const
     {
-        return m_vertexShaders[a_addr];
+        return m_vertexShaders.Get(a_addr);
     }
 
     uint32_t GeneratePixelShader(const std::filesystem::path& a_path);
@@ -60,45 +73,49 @@ public:
     void DestroyPixelShader(uint32_t a_addr);
     inline PixelShader* GetPixelShader(uint32_t a_addr) const
     {
-        return m_pixelShaders[a_addr];
+        return m_pixelShaders.Get(a_addr);
     }
 
     uint32_t GenerateRenderProgram(const RenderProgram& a_program);
     void SetProgramTexture(uint32_t a_addr, uint32_t a_slot, uint32_t a_textureAddr);
     void DestroyRenderProgram(uint32_t a_addr);
-    inline RenderProgram GetRenderProgram(uint32_t a_addr) const
-    {
-        return m_renderPrograms[a_addr];
-    }
-    inline void SetRenderProgram(uint32_t a_addr, const RenderProgram& a_program) 
-    {
-        m_renderPrograms[a_addr] = a_program;
-    }
+    RenderProgram GetRenderProgram(uint32_t a_addr) const;
+    void SetRenderProgram(uint32_t a_addr, const RenderProgram& a_program);
 
     uint32_t GenerateModel(const void* a_vertices, uint32_t a_vertexCount, const uint32_t* a_indices, uint32_t a_indexCount, uint16_t a_vertexStride);
+    // Returns straight away with the address while the import runs on a worker, the model is null until it lands
+    uint32_t GenerateModelFromFile(const std::filesystem::path& a_path, uint32_t a_index, bool a_skinned);
     void DestroyModel(uint32_t a_addr);
     inline Model* GetModel(uint32_t a_addr) const
     {
-        return m_models[a_addr];
+        return m_models.Get(a_addr);
+    }
+    inline bool IsModelPending(uint32_t a_addr) const
+    {
+        return m_pendingModels.find(a_addr) != m_pendingModels.end();
     }
     
     uint32_t GenerateTexture(uint32_t a_width, uint32_t a_height, const unsigned char* a_data);
     uint32_t GenerateTextureFromHandle(uint32_t a_handle);
+    // Returns straight away with a placeholder while the file is decoded and uploaded in the background
+    uint32_t GenerateTextureFromFile(const std::filesystem::path& a_path);
     void DestroyTexture(uint32_t a_addr);
     inline Texture* GetTexture(uint32_t a_addr) const
     {
-        return m_textures[a_addr];
+        return m_textures.Get(a_addr);
     }
 
     uint32_t GenerateTextureSampler(uint32_t a_texture, e_TextureFilter a_filter, e_TextureAddress a_address);
     void DestroyTextureSampler(uint32_t a_addr);
     inline TextureSamplerBuffer GetSamplerBuffer(uint32_t a_addr) const
     {
-        return m_samplers[a_addr];
+        return m_samplers.Get(a_addr);
     }
 
+    RuntimeImportBoneData LoadBoneData(const std::filesystem::path& a_path);
     MonoArray* LoadExternalAnimationClip(const std::filesystem::path& a_path);
 
+    void Update();
     void Clear();
 };
 
@@ -0,0 +1,69 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Bump allocator for data that only has to live until the next reset
+// Blocks are kept across resets so once it has grown to fit a frame allocating is just moving an offset
+class ScratchArena
+{
+private:
+    struct Block
+    {
+        char*    Data;
+        uint32_t Size;
+    };
+
+    std::vector<Block> m_blocks;
+
+    uint32_t           m_blockSize;
+    uint32_t           m_block;
+    uint32_t           m_offset;
+    uint32_t           m_used;
+
+protected:
+
+public:
+    ScratchArena(uint32_t a_blockSize);
+    ~ScratchArena();
+
+    // Never fails, oversized requests get a block of their own
+    void* Allocate(uint32_t a_size);
+    // Everything handed out since the last reset is invalid afterwards
+    void Reset();
+
+    inline uint32_t GetBlockCount() const
+    {
+        return (uint32_t)m_blocks.size();
+    }
+    inline uint32_t GetUsed() const
+    {
+        return m_used;
+    }
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -0,0 +1,70 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+enum e_TextureQuality : uint32_t
+{
+    TextureQuality_Uncompressed,
+    TextureQuality_Fast,
+    TextureQuality_Normal,
+    TextureQuality_High,
+    TextureQuality_End
+};
+
+struct TextureLevel
+{
+    uint32_t Width;
+    uint32_t Height;
+    uint64_t Offset;
+    uint64_t Size;
+};
+
+// Compresses RGBA8 images to BC7 with a full mip chain
+// Slow enough that it is only meant to be called from worker threads with the result cached on disk
+class TextureCompressor
+{
+public:
+    // Bump when the output changes so stale cache entries are ignored
+    static constexpr uint32_t CacheVersion = 1;
+
+    // Appends the rest of the mip chain for RGBA8 data that only has the base level
+    static void GenerateMips(std::vector<TextureLevel>* a_levels, std::vector<uint8_t>* a_data);
+
+    // Outputs a ktx2 file holding the BC7 levels
+    static bool Compress(uint32_t a_width, uint32_t a_height, const uint8_t* a_pixels, e_TextureQuality a_quality, std::vector<uint8_t>* a_ktx);
+
+    // Cache entries are keyed by the source file contents and quality so edits and setting changes both miss
+    static std::filesystem::path GetCacheFile(const std::filesystem::path& a_cachePath, const uint8_t* a_data, uint64_t a_size, e_TextureQuality a_quality);
+    static bool ReadCache(const std::filesystem::path& a_path, std::vector<uint8_t>* a_ktx);
+    static void WriteCache(const std::filesystem::path& a_path, const std::vector<uint8_t>& a_ktx);
+
+    static const char* GetQualityName(e_TextureQuality a_quality);
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -0,0 +1,136 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <glad/glad.h>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "TextureCompressor.h"
+
+// Decodes textures on worker threads and streams them into their GL texture over a few frames
+// The texture exists straight away with a placeholder image so the handle can be used immediately
+// Loads are keyed by the GL handle so the owner has to cancel before deleting the texture
+class TextureLoader
+{
+public:
+    static constexpr uint32_t StagingBufferCount = 4;
+    // Time in milliseconds the main thread is allowed to spend uploading each frame
+    static constexpr double UploadBudget = 4.0;
+
+private:
+    struct TextureJob
+    {
+        GLuint Handle;
+        uint64_t Ticket;
+        e_TextureQuality Quality;
+        std::filesystem::path Path;
+        std::filesystem::path CachePath;
+        std::vector<uint8_t> Data;
+    };
+
+    struct TextureResult
+    {
+        GLuint Handle;
+        uint64_t Ticket;
+        GLenum InternalFormat;
+        GLenum Format;
+        GLenum Type;
+        bool Compressed;
+        std::vector<TextureLevel> Levels;
+        std::vector<uint8_t> Data;
+    };
+
+    struct StagingBuffer
+    {
+        GLuint Buffer;
+        uint64_t Size;
+        GLsync Fence;
+    };
+
+    std::vector<std::thread>               m_workers;
+    std::mutex                             m_jobLock;
+    std::condition_variable                m_jobSignal;
+    std::deque<TextureJob>                 m_jobs;
+    bool                                   m_shutdown;
+
+    std::mutex                             m_resultLock;
+    std::deque<TextureResult>              m_results;
+
+    std::unordered_map<GLuint, uint64_t>   m_pending;
+    uint64_t                               m_nextTicket;
+
+    // Tracked from the level sizes so GPU memory use can be read without asking the driver
+    std::unordered_map<GLuint, uint64_t>   m_residentSize;
+    uint64_t                               m_residentTotal;
+
+    StagingBuffer                          m_stagingBuffers[StagingBufferCount];
+    uint32_t                               m_stagingIndex;
+
+    void Run();
+
+    static bool DecodeKTX(const uint8_t* a_data, uint64_t a_size, TextureResult* a_result);
+    static bool DecodePNG(const TextureJob& a_job, TextureResult* a_result);
+    static bool Decode(const TextureJob& a_job, TextureResult* a_result);
+
+    bool Upload(const TextureResult& a_result);
+
+protected:
+
+public:
+    TextureLoader();
+    ~TextureLoader();
+
+    // Queues the decode for a texture that already exists
+    // Pngs get compressed at the given quality with the result kept under a_cachePath
+    void Load(GLuint a_handle, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, const std::filesystem::path& a_cachePath, e_TextureQuality a_quality);
+    // Drops any pending load so it cannot land on a destroyed or reused texture
+    // Needs to be called before the texture is deleted
+    void Cancel(GLuint a_handle);
+    void Clear();
+
+    // Records the size of a texture created outside of the loader so it shows up in the memory counter
+    void SetResidentSize(GLuint a_handle, uint64_t a_size);
+
+    // Uploads finished textures should be called once a frame from the main thread
+    void Update();
+
+    inline uint32_t GetPendingCount() const
+    {
+        return (uint32_t)m_pending.size();
+    }
+    inline uint64_t GetResidentSize() const
+    {
+        return m_residentTotal;
+    }
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
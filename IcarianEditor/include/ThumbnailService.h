@@ -0,0 +1,133 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#pragma once
+
+#define GLM_FORCE_SWIZZLE 
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <glad/glad.h>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+enum e_ThumbnailType
+{
+    ThumbnailType_Texture,
+    ThumbnailType_Model
+};
+
+// Generates small previews for textures and models on worker threads
+// Previews are saved in the project cache keyed by path, write time and size and packed into shared atlas textures
+// Atlas space is capped and the least recently drawn previews get evicted when it runs out
+class ThumbnailService
+{
+public:
+    static constexpr uint32_t ThumbnailSize = 128;
+    static constexpr uint32_t AtlasSize = 2048;
+    static constexpr uint32_t AtlasCells = AtlasSize / ThumbnailSize;
+    static constexpr uint32_t AtlasSlots = AtlasCells * AtlasCells;
+    static constexpr uint32_t MaxAtlases = 4;
+    static constexpr uint32_t MaxSlots = AtlasSlots * MaxAtlases;
+    // Keeps uploads from spiking the frame when a big folder is opened
+    static constexpr uint32_t MaxUploadsPerFrame = 8;
+
+private:
+    using Key = std::filesystem::path::string_type;
+
+    struct ThumbnailEntry
+    {
+        // -1 while pending or when generation failed
+        uint32_t Slot;
+        // Only valid while holding a slot
+        std::list<Key>::iterator LRU;
+        bool Queued;
+        bool Stale;
+    };
+
+    struct ThumbnailJob
+    {
+        std::filesystem::path Path;
+        std::filesystem::path CachePath;
+        e_ThumbnailType Type;
+        uint32_t Generation;
+    };
+
+    struct ThumbnailResult
+    {
+        Key Path;
+        std::vector<uint8_t> Pixels;
+        uint32_t Generation;
+    };
+
+    std::vector<std::thread>                 m_workers;
+    std::mutex                               m_jobLock;
+    std::condition_variable                  m_jobSignal;
+    std::deque<ThumbnailJob>                 m_jobs;
+    bool                                     m_shutdown;
+
+    std::mutex                               m_resultLock;
+    std::vector<ThumbnailResult>             m_results;
+
+    std::unordered_map<Key, ThumbnailEntry>  m_entries;
+    // Paths holding a slot with the least recently drawn at the front
+    std::list<Key>                           m_lru;
+    std::vector<uint32_t>                    m_freeSlots;
+    std::vector<GLuint>                      m_atlases;
+    uint32_t                                 m_nextSlot;
+    uint32_t                                 m_generation;
+
+    void Run();
+
+    uint32_t AllocateSlot();
+    void ReleaseSlot(ThumbnailEntry* a_entry);
+
+    static bool GenerateThumbnail(const ThumbnailJob& a_job, std::vector<uint8_t>* a_pixels);
+
+protected:
+
+public:
+    ThumbnailService();
+    ~ThumbnailService();
+
+    // Uploads finished thumbnails should be called once a frame from the main thread
+    void Update();
+    // Drops all thumbnails, previews already in the disk cache get picked back up cheaply
+    void Clear();
+
+    // Marks a preview to be checked again next time it is drawn, the old one is shown until the new one is ready
+    void Invalidate(const std::filesystem::path& a_path);
+    void InvalidateAll();
+
+    // Returns true and the atlas region when the thumbnail is ready otherwise queues it
+    bool GetThumbnail(const std::filesystem::path& a_path, const std::filesystem::path& a_cachePath, e_ThumbnailType a_type, GLuint* a_texture, glm::vec2* a_uv0, glm::vec2* a_uv1);
+};
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
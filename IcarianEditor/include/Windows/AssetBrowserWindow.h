@@ -7,25 +7,20 @@
 #include "Windows/Window.h"
 
 #include <filesystem>
-#include <list>
 #include <vector>
 
+#include "AssetSearchIndex.h"
+#include "DirectoryModel.h"
+
 class AppMain;
 class AssetLibrary;
 class Project;
 
-struct DirectoryNode
-{
-    uint32_t Parent;
-    std::filesystem::path Path;
-    std::list<std::filesystem::path> Files;
-    std::list<uint32_t> Children;
-};
-
 class AssetBrowserWindow : public Window
 {
 private:
     static constexpr uint32_t ItemWidth = 128;
+    static constexpr float ItemHeight = 170.0f;
     static constexpr uint32_t SearchBufferSize = 2048;
 
     char                       m_searchBuffer[SearchBufferSize];
@@ -33,17 +28,22 @@ private:
     AssetLibrary*              m_assetLibrary;
     Project*                   m_project;
 
-    std::vector<DirectoryNode> m_fileTree;
+    DirectoryModel             m_directoryModel;
+    AssetSearchIndex           m_searchIndex;
+    // Node slots get reused by the model so the path is what identifies the current folder
+    std::filesystem::path      m_curPath;
     uint32_t                   m_curIndex;
 
+    void SetCurrentFolder(uint32_t a_index);
+    void ResolveCurrentFolder();
+
     bool ShowFolder(bool a_context, uint32_t a_index);
-    bool ShowAsset(bool a_context, const std::filesystem::path& a_path, const std::filesystem::path& a_workingPath);
+    bool ShowAsset(bool a_context, const DirectoryModelFile& a_file);
 
-    void MakeDirectoryNode(uint32_t a_parent, const std::filesystem::path& a_path);
     void TraverseFolderTree(uint32_t a_index);
 
-    bool ShowBaseAssetList(const DirectoryNode& a_node);
-    bool ShowSearchAssetList(const DirectoryNode& a_node, const std::string_view& a_filter);
+    bool ShowBaseAssetList(const DirectoryModelNode& a_node, uint32_t a_columnCount);
+    bool ShowSearchAssetList(const std::string_view& a_filter, uint32_t a_columnCount);
 
     void BaseMenu(const std::filesystem::path& a_path, const std::filesystem::path& a_assetPath);
     void AssetMenu(const std::filesystem::path& a_path, const std::filesystem::path& a_assetPath);
@@ -55,6 +55,7 @@ public:
     virtual ~AssetBrowserWindow();
     
     virtual void Refresh();
+    virtual void Tick();
     virtual void Update(double a_delta);
 };
 
@@ -6,30 +6,99 @@
 
 #include "Window.h"
 
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ConsoleSearch.h"
 #include "Logger.h"
 
-struct ConsoleMessage
+// Unique message text shared by every record that logged it
+struct ConsoleString
 {
     std::string Message;
+    uint32_t RefCount;
+    bool Match;
+};
+
+// Every string, type and source has at most one record which counts every time it was logged
+struct ConsoleMessage
+{
+    uint32_t String;
+    uint32_t Count;
+    // Oldest to newest, repeats get moved to the newest end
+    uint32_t Prev;
+    uint32_t Next;
+    e_LoggerMessageType Type;
+    e_LoggerMessageSource Source;
+};
+
+// Run of visible messages drawn as one or more rows
+// Collapsed groups merge neighbouring messages with the same text otherwise each group is a single message
+struct ConsoleGroup
+{
+    uint32_t String;
     uint32_t Count;
+    uint32_t MessageCount;
     e_LoggerMessageType Type;
-    bool Editor;
+    uint64_t RowEnd;
 };
 
 class ConsoleWindow : public Window
 {
 private:
-    constexpr static int MaxMessages = 2048;
+    constexpr static uint32_t MaxMessages = 2048;
+    constexpr static uint32_t SearchBufferSize = 256;
 
     constexpr static int DisplayMessageBit = 0;
     constexpr static int DisplayWarningBit = 1;
     constexpr static int DisplayErrorBit = 2;
     constexpr static int DisplayEditorBit = 3;
     constexpr static int CollapseBit = 4;
+    constexpr static int DisplayEngineBit = 5;
+    constexpr static int DisplayScriptBit = 6;
+    constexpr static int RegexBit = 7;
+
+    ConsoleMessage                                  m_messages[MaxMessages];
+    uint32_t                                        m_messageHead;
+    uint32_t                                        m_messageTail;
+    uint32_t                                        m_messageCount;
+
+    std::vector<ConsoleString>                      m_strings;
+    std::vector<uint32_t>                           m_freeStrings;
+    std::unordered_map<std::string_view, uint32_t>  m_stringLookup;
+    // Keyed by string, type and source to the slot of its record
+    std::unordered_map<uint64_t, uint32_t>          m_recordLookup;
+
+    ConsoleSearch                                   m_search;
+    char                                            m_searchBuffer[SearchBufferSize];
+
+    std::deque<ConsoleGroup>                        m_groups;
+    uint64_t                                        m_rowStart;
+    bool                                            m_groupsDirty;
+
+    unsigned char                                   m_flags;
+
+    static uint64_t GetRecordKey(uint32_t a_string, e_LoggerMessageType a_type, e_LoggerMessageSource a_source);
+
+    uint32_t InternString(const std::string_view& a_message);
+    void ReleaseString(uint32_t a_string);
+
+    bool IsVisible(const ConsoleMessage& a_message) const;
+    uint64_t GetGroupRows(const ConsoleGroup& a_group) const;
+
+    void LinkMessage(uint32_t a_slot);
+    void UnlinkMessage(uint32_t a_slot);
+
+    void PushGroup(const ConsoleMessage& a_message, uint32_t a_count);
+    void PopGroup(const ConsoleMessage& a_message);
+    void RebuildGroups();
 
-    std::vector<ConsoleMessage> m_messages;
+    void UpdateSearch();
 
-    unsigned char               m_flags;
+    void ClearMessages();
 
 protected:
 
@@ -37,7 +106,7 @@ public:
     ConsoleWindow();
     virtual ~ConsoleWindow();
 
-    void AddMessage(const std::string_view& a_message, bool a_editor, e_LoggerMessageType a_type);
+    void AddMessage(const std::string_view& a_message, e_LoggerMessageSource a_source, e_LoggerMessageType a_type);
     
     virtual void Update(double a_delta);
 };
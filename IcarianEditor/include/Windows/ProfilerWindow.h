@@ -10,26 +10,37 @@
 #include <string>
 #include <vector>
 
+class AppMain;
+
 struct ProfileSnapshot;
 
 class ProfilerWindow : public Window
 {
 private:
+    static constexpr float FlameGraphRowHeight = 20.0f;
+
     struct ProfileFrameSelection
     {
         std::string SnapshotName;
         std::string FrameName;
     };
 
+    AppMain*                           m_app;
+
     std::vector<ProfileFrameSelection> m_selections;
+    ProfileFrameSelection              m_statisticsSelection;
 
     uint32_t GetFrameIndex(const ProfileSnapshot& a_snapshot) const;
     void SetFrameIndex(const std::string_view& a_snapshotName, const std::string_view& a_frameName);
 
+    void PlotView(const std::vector<ProfileSnapshot>& a_snapshots);
+    void FlameGraphView(const std::vector<ProfileSnapshot>& a_snapshots);
+    void StatisticsView(const std::vector<ProfileSnapshot>& a_snapshots);
+
 protected:
 
 public:
-    ProfilerWindow();
+    ProfilerWindow(AppMain* a_app);
     ~ProfilerWindow();
 
     virtual void Update(double a_delta);
@@ -24,6 +24,8 @@ public:
     bool Display(double a_delta);
 
     virtual void Refresh() { }
+    // Called every wake even when nothing is drawn so polling does not wait on a redraw
+    virtual void Tick() { }
     virtual void Update(double a_delta) = 0;
 };
 
@@ -19,6 +19,7 @@
 #include "Datastore.h"
 #include "EditorConfig.h"
 #include "EditorInputManager.h"
+#include "EditorProfiler.h"
 #include "FileHandler.h"
 #include "FlareImGui.h"
 #include "Gizmos.h"
@@ -208,6 +209,7 @@ AppMain::AppMain() : Application(1280, 720, "IcarianEditor")
     
     Datastore::Init();
     ProfilerData::Init();
+    EditorProfiler::Init();
 
     m_process = new ProcessManager();
     RuntimeManager::Init();
@@ -217,17 +219,18 @@ AppMain::AppMain() : Application(1280, 720, "IcarianEditor")
     EditorConfig::Init();
 
     m_assets = new AssetLibrary();
-    m_rStorage = new RuntimeStorage(m_assets);
 
     m_workspace = new Workspace();
 
     m_project = new Project(this, m_assets, m_workspace);
 
+    m_rStorage = new RuntimeStorage(m_assets, m_project);
+
     RenderCommand::Init(m_rStorage);
     Gizmos::Init();
     GUI::Init(this, m_assets);
 
-    FileHandler::Init(m_assets, m_rStorage, m_workspace);
+    FileHandler::Init(m_assets, m_rStorage, m_project, m_workspace);
     
     m_windows.emplace_back(new ConsoleWindow());
     m_windows.emplace_back(new EditorWindow(m_workspace));
@@ -275,6 +278,7 @@ AppMain::~AppMain()
 
     EditorInputManager::Destroy();
 
+    EditorProfiler::Destroy();
     ProfilerData::Destroy();
 
     FileHandler::Destroy();
@@ -292,21 +296,98 @@ AppMain::~AppMain()
     EditorConfig::Destroy();
 }
 
+bool AppMain::IsActive() const
+{
+    // Detached ImGui windows are their own GLFW windows so focus on any of them counts
+    const ImGuiPlatformIO& platformIO = ImGui::GetPlatformIO();
+    if (platformIO.Platform_GetWindowFocus != nullptr)
+    {
+        for (ImGuiViewport* viewport : platformIO.Viewports)
+        {
+            if (platformIO.Platform_GetWindowFocus(viewport))
+            {
+                return true;
+            }
+        }
+    }
+
+    return IsFocused();
+}
+
+// Anything ImGui is still reacting to has to keep frames coming otherwise the loop is free to idle
+static bool ImGuiWantsRedraw(const ImGuiIO& a_io)
+{
+    if (a_io.MouseDelta.x != 0.0f || a_io.MouseDelta.y != 0.0f || a_io.MouseWheel != 0.0f || a_io.MouseWheelH != 0.0f)
+    {
+        return true;
+    }
+
+    // Text fields need the cursor to blink
+    if (a_io.InputQueueCharacters.Size > 0 || a_io.WantTextInput || ImGui::IsAnyMouseDown())
+    {
+        return true;
+    }
+
+    for (uint32_t i = ImGuiKey_NamedKey_BEGIN; i < ImGuiKey_NamedKey_END; ++i)
+    {
+        if (ImGui::IsKeyDown((ImGuiKey)i))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static bool InBounds(const glm::vec2& a_point, const glm::vec2& a_min, const glm::vec2& a_max)
 {
     return a_point.x > a_min.x && a_point.x < a_max.x && a_point.y > a_min.y && a_point.y < a_max.y;
 }
 
+void AppMain::Tick()
+{
+    // Consoles get everything logged since the last tick in one go
+    Logger::Update();
+    FileHandler::Update();
+    m_rStorage->Update();
+    Datastore::Update();
+
+    {
+        EDITOR_PROFILE_SCOPE("ProcessUpdate");
+
+        m_process->Update();
+    }
+
+    // Game frames and IPC traffic come in whenever so just keep going while it is running
+    if (m_process->IsRunning())
+    {
+        RequestRedraw();
+    }
+
+    for (Window* wind : m_windows)
+    {
+        wind->Tick();
+    }
+}
 void AppMain::Update(double a_delta, double a_time)
 {    
+    SetBackgroundFrameRate(EditorConfig::GetBackgroundFrameRate());
+
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
     ImGuizmo::BeginFrame();
 
+    GUI::NewFrame();
+
     const ImGuiIO& io = ImGui::GetIO();
     const ImGuiStyle& style = ImGui::GetStyle();
 
+    if (ImGuiWantsRedraw(io))
+    {
+        RequestRedraw();
+    }
+
     e_Cursors cursor = Cursor_Arrow;
     const glm::vec2 cursorPos = GetCursorPos();
 
@@ -347,13 +428,16 @@ void AppMain::Update(double a_delta, double a_time)
 
     m_focused = focusState;
 
+    if (refresh)
+    {
+        RequestRedraw();
+    }
+
     if (io.ConfigFlags & ImGuiConfigFlags_DockingEnable)
     {
         ImGui::DockSpaceOverViewport(ImGui::GetMainViewport());
     }
 
-    m_process->Update();
-
     const int fps = (int)(1.0 / a_delta);
 
     {
@@ -470,7 +554,7 @@ void AppMain::Update(double a_delta, double a_time)
 
                     if (ImGui::MenuItem("Profiler"))
                     {
-                        m_windows.emplace_back(new ProfilerWindow());
+                        m_windows.emplace_back(new ProfilerWindow(this));
                     }
                 }
             }
@@ -623,6 +707,9 @@ void AppMain::Update(double a_delta, double a_time)
 
     if (validProject)
     {
+        EDITOR_PROFILE_SCOPE("Windows");
+        EDITOR_PROFILE_COUNTER("Windows", m_windows.size());
+
         for (auto iter = m_windows.begin(); iter != m_windows.end(); ++iter)
         {
             if (!(*iter)->Display(a_delta))
@@ -728,10 +815,19 @@ void AppMain::Update(double a_delta, double a_time)
         }
     }
 
-    RuntimeManager::Update(a_delta);
+    {
+        EDITOR_PROFILE_SCOPE("RuntimeUpdate");
+
+        RuntimeManager::Update(a_delta);
+    }
+
+    {
+        EDITOR_PROFILE_SCOPE("ImGuiRender");
+        EDITOR_PROFILE_GPU_SCOPE("ImGuiRender");
 
-    ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        ImGui::Render();
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
 
     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
     {
@@ -754,30 +850,52 @@ void AppMain::Update(double a_delta, double a_time)
 
     if (m_assets->ShouldSerialize())
     {
+        EDITOR_PROFILE_SCOPE("Serialize");
+
         m_assets->Serialize(m_project);
     }
 
     if (refresh)
     {
+        EDITOR_PROFILE_SCOPE("Refresh");
+
         Logger::Message("Refreshing Project");
         m_project->SetRefresh(false);
 
         RenderCommand::Clear();
+        FileHandler::Clear();
 
         const std::filesystem::path path = m_project->GetPath(); 
         const std::filesystem::path cachePath = m_project->GetCachePath();
         const std::string pathStr = path.string();
         const std::string projectName = m_project->GetName();
 
-        if (RuntimeManager::Build(pathStr, projectName))
+        bool built;
         {
+            EDITOR_PROFILE_SCOPE("RuntimeBuild");
+
+            built = RuntimeManager::Build(pathStr, projectName);
+        }
+
+        if (built)
+        {
+            EDITOR_PROFILE_SCOPE("RuntimeStart");
+
             RuntimeManager::Start(pathStr, projectName);
         }
 
         m_rStorage->Clear();
 
-        m_assets->Refresh(path);
-        m_assets->BuildDirectory(cachePath, m_project);
+        {
+            EDITOR_PROFILE_SCOPE("AssetRefresh");
+
+            m_assets->Refresh(m_project);
+        }
+        {
+            EDITOR_PROFILE_SCOPE("BuildDirectory");
+
+            m_assets->BuildDirectory(cachePath, m_project);
+        }
 
         for (Window* wind : m_windows)
         {
@@ -4,12 +4,26 @@
 
 #include "Application.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
 #include <stb_image.h>
+#include <thread>
 
 #include "Core/IcarianAssert.h"
 #include "Core/IcarianDefer.h"
+#include "EditorProfiler.h"
 #include "Logger.h"
 
+static std::atomic<uint32_t> RedrawFrames = 0;
+// Set by the first request from another thread since the main thread last woke so bursts only post once
+static std::atomic<bool> WakePending = false;
+// Guards posting against the window going away as glfwPostEmptyEvent is not safe during or after glfwTerminate
+static std::mutex WindowLock;
+static bool WindowCreated = false;
+static std::thread::id MainThread;
+
 static void ErrorCallback(int a_error, const char* a_description)
 {
     Logger::Error(a_description);
@@ -20,6 +34,7 @@ Application::Application(uint32_t a_width, uint32_t a_height, const std::string_
 {
     // TODO: Do some glfw hacks relating to the titlebar
     m_maximized = false;
+    m_backgroundFrameRate = 0;
 
 #ifndef WIN32
     // Wayland is weird so prefer run under XWayland for the editor for the time being
@@ -92,9 +107,21 @@ Application::Application(uint32_t a_width, uint32_t a_height, const std::string_
     ICARIAN_ASSERT_R(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress));
 
     glfwSwapInterval(1);
+
+    // Start with a few frames so there is something on screen before the first request
+    RedrawFrames = RedrawFrameCount;
+
+    MainThread = std::this_thread::get_id();
+
+    const std::unique_lock l = std::unique_lock(WindowLock);
+    WindowCreated = true;
 }
 Application::~Application()
 {
+    // Held until terminated so a request from another thread cannot post in the middle of it
+    const std::unique_lock l = std::unique_lock(WindowLock);
+    WindowCreated = false;
+
     for (uint32_t i = 0; i < Cursor_Last; ++i)
     {
         glfwDestroyCursor(m_cursors[i]);
@@ -143,6 +170,55 @@ bool Application::IsFocused() const
 {
     return glfwGetWindowAttrib(m_window, GLFW_FOCUSED) != GLFW_FALSE;
 }
+bool Application::IsActive() const
+{
+    return IsFocused();
+}
+
+void Application::RequestRedraw(uint32_t a_frames)
+{
+    uint32_t frames = RedrawFrames.load();
+    while (frames < a_frames && !RedrawFrames.compare_exchange_weak(frames, a_frames));
+
+    // Main thread only requests during the frame so it is never waiting when it does
+    if (std::this_thread::get_id() == MainThread)
+    {
+        return;
+    }
+
+    if (WakePending.exchange(true))
+    {
+        return;
+    }
+
+    const std::unique_lock l = std::unique_lock(WindowLock);
+    if (WindowCreated)
+    {
+        glfwPostEmptyEvent();
+    }
+}
+
+double Application::GetFrameInterval() const
+{
+    if (glfwGetWindowAttrib(m_window, GLFW_ICONIFIED) != GLFW_FALSE)
+    {
+        return IdleInterval;
+    }
+
+    const bool redraw = RedrawFrames > 0;
+    if (m_backgroundFrameRate == 0 || IsActive())
+    {
+        return redraw ? 0.0 : IdleInterval;
+    }
+
+    const double interval = 1.0 / m_backgroundFrameRate;
+    if (redraw)
+    {
+        return interval;
+    }
+
+    return std::max(interval, IdleInterval);
+}
 
 bool Application::IsMaximized() const
 {
@@ -276,26 +352,101 @@ void Application::SetWindowPos(const glm::vec2& a_pos)
 void Application::Run()
 {
     const double startTime = glfwGetTime();
+    // Last wake is used for when to wake next and last frame for the delta as idle wakes do not draw
     double prevTime = startTime;
+    double frameTime = startTime;
+
+#ifndef ICARIANEDITOR_DISABLE_PROFILER
+    // Only used to work out how many frames went undrawn, no monitor means guess
+    double refreshRate = 60.0;
+    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+    if (monitor != NULL)
+    {
+        const GLFWvidmode* mode = glfwGetVideoMode(monitor);
+        if (mode != NULL && mode->refreshRate > 0)
+        {
+            refreshRate = (double)mode->refreshRate;
+        }
+    }
+#endif
 
     while (!glfwWindowShouldClose(m_window))
     {
         // ImGui resets context so need to set
         glfwMakeContextCurrent(m_window);
 
-        glfwPollEvents();
+        // Sleep until the next frame is due instead of drawing the same thing at vsync rate
+        // Interval gets worked out again every wake as focus or a request can change it
+        while (true)
+        {
+            const double waitStart = glfwGetTime();
+            const double remaining = prevTime + GetFrameInterval() - waitStart;
+            if (remaining <= 0.0)
+            {
+                glfwPollEvents();
+
+                break;
+            }
+
+            glfwWaitEventsTimeout(remaining);
+
+            if (glfwWindowShouldClose(m_window))
+            {
+                break;
+            }
+
+            // Woke before the timeout so something came in, input on any window or a request from another thread
+            if (glfwGetTime() - waitStart < remaining)
+            {
+                RequestRedraw();
+            }
+        }
+
+        // Cleared before the tick so anything asked for from here on wakes the next wait
+        // Frames are set before the flag is checked so a request that missed posting still gets drawn
+        WakePending = false;
+
+        const double time = glfwGetTime();
+        prevTime = time;
+
+        EditorProfiler::BeginFrame();
+
+        {
+            EDITOR_PROFILE_SCOPE("Tick");
+
+            // Polling happens every wake so IPC and file changes still get picked up when nothing is being drawn
+            Tick();
+        }
+
+        // Checked after the tick as anything it picked up can ask for a redraw
+        uint32_t frames = RedrawFrames.load();
+        if (frames == 0)
+        {
+            // Nothing changed so what is on screen is still correct
+            EditorProfiler::EndFrame();
+
+            continue;
+        }
+
+        // Failing means someone just asked for more so leave it be
+        RedrawFrames.compare_exchange_strong(frames, frames - 1);
 
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
         glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
 
-        const double time = glfwGetTime();
+#ifndef ICARIANEDITOR_DISABLE_PROFILER
+        const double skipped = std::floor((time - frameTime) * refreshRate) - 1.0;
+        EDITOR_PROFILE_COUNTER("Frames Skipped", std::max(skipped, 0.0));
+#endif
+
+        Update(time - frameTime, time - startTime);
 
-        Update(time - prevTime, time - startTime);
+        EditorProfiler::EndFrame();
 
         // ???? Seem to get stuck here ever since I implemented DMA are they interacting and interfering with each other?
         glfwSwapBuffers(m_window);
 
-        prevTime = time;
+        frameTime = time;
     }
 }
 
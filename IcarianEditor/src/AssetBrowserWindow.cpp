@@ -4,6 +4,7 @@
 
 #include "Windows/AssetBrowserWindow.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <imgui.h>
 
@@ -34,7 +35,6 @@ AssetBrowserWindow::AssetBrowserWindow(AppMain* a_app, Project* a_project, Asset
     m_assetLibrary = a_assetLibrary;
     m_project = a_project;
 
-    m_fileTree.clear();
     m_curIndex = -1;
 
     m_searchBuffer[0] = 0;
@@ -44,47 +44,15 @@ AssetBrowserWindow::~AssetBrowserWindow()
 
 }
 
-void AssetBrowserWindow::MakeDirectoryNode(uint32_t a_parent, const std::filesystem::path& a_path)
-{
-    DirectoryNode node;
-    node.Parent = a_parent;
-    node.Path = a_path;
-
-    std::list<std::filesystem::path> childPaths;
-
-    for (const auto iter : std::filesystem::directory_iterator(a_path, std::filesystem::directory_options::skip_permission_denied))
-    {
-        if (iter.is_regular_file())
-        {
-            node.Files.emplace_back(iter.path());
-        }
-        else if (iter.is_directory())
-        {
-            childPaths.emplace_back(iter.path());   
-        }
-    }
-
-    const uint32_t index = (uint32_t)m_fileTree.size();
-    m_fileTree.emplace_back(node);
-
-    for (const std::filesystem::path& child : childPaths)
-    {
-        node.Children.emplace_back((uint32_t)m_fileTree.size());
-
-        MakeDirectoryNode(index, child);
-    }
-
-    m_fileTree[index] = node;
-}
 void AssetBrowserWindow::TraverseFolderTree(uint32_t a_index)
 {
-    const DirectoryNode& node = m_fileTree[a_index];
+    const DirectoryModelNode& node = m_directoryModel.GetNode(a_index);
 
     const uint32_t count = (uint32_t)node.Children.size();
 
     const std::string strID = "##" + std::to_string(a_index);
     const std::string buttonID = strID + "Button";
-    const std::string fileName = node.Path.filename().string();
+    const std::string& fileName = node.Name;
 
     bool open = false;
     if (count > 0)
@@ -122,7 +90,7 @@ void AssetBrowserWindow::TraverseFolderTree(uint32_t a_index)
 
     if (ImGui::Selectable(fileName.c_str()))
     {
-        m_curIndex = a_index;
+        SetCurrentFolder(a_index);
     }
 
     if (open)
@@ -134,36 +102,58 @@ void AssetBrowserWindow::TraverseFolderTree(uint32_t a_index)
     }
 }
 
-void AssetBrowserWindow::Refresh()
+void AssetBrowserWindow::SetCurrentFolder(uint32_t a_index)
 {
-    std::filesystem::path curPath;
-    if (m_curIndex != -1)
+    m_curIndex = a_index;
+
+    m_curPath.clear();
+    if (m_directoryModel.IsValid(a_index))
     {
-        ICARIAN_ASSERT(m_curIndex < m_fileTree.size());
-        
-        curPath = m_fileTree[m_curIndex].Path;
+        m_curPath = m_directoryModel.GetNode(a_index).Path;
     }
+}
+void AssetBrowserWindow::ResolveCurrentFolder()
+{
+    // Current folder may have been removed so walk back up to one that still exists
+    // Goes off the path as the old index may now belong to a different folder
+    std::filesystem::path path = m_curPath;
+    while (!path.empty())
+    {
+        const uint32_t index = m_directoryModel.GetNodeIndex(path);
+        if (index != -1)
+        {
+            SetCurrentFolder(index);
 
-    const std::filesystem::path projectPath = m_project->GetProjectPath();
-
-    m_fileTree.clear(); 
+            return;
+        }
 
-    m_curIndex = 0;
+        const std::filesystem::path parentPath = path.parent_path();
+        if (parentPath == path)
+        {
+            break;
+        }
 
-    MakeDirectoryNode(-1, projectPath);
+        path = parentPath;
+    }
 
-    const uint32_t count = (uint32_t)m_fileTree.size();
-    for (uint32_t i = 0; i < count; ++i)
+    if (m_directoryModel.IsValid(0))
     {
-        const DirectoryNode& node = m_fileTree[i];
+        SetCurrentFolder(0);
+    }
+    else
+    {
+        SetCurrentFolder(-1);
+    }
+}
 
-        if (node.Path == curPath)
-        {
-            m_curIndex = i;
+void AssetBrowserWindow::Refresh()
+{
+    const std::filesystem::path projectPath = m_project->GetProjectPath();
 
-            break;
-        }
-    }
+    m_directoryModel.Build(projectPath);
+    m_searchIndex.Build(m_directoryModel);
+
+    ResolveCurrentFolder();
 }
 
 class DeleteAssetData : public ConfirmModalData
@@ -366,22 +356,32 @@ void AssetBrowserWindow::AssetMenu(const std::filesystem::path& a_path, const st
     }
 }
 
+static void PadItem(float a_startYPos, float a_height)
+{
+    const float used = ImGui::GetCursorScreenPos().y - a_startYPos;
+    if (used < a_height)
+    {
+        ImGui::Dummy(ImVec2(0.0f, a_height - used));
+    }
+}
+
 bool AssetBrowserWindow::ShowFolder(bool a_context, uint32_t a_index)
 {
     bool ret = false;
 
-    const DirectoryNode& cNode = m_fileTree[a_index];
+    const DirectoryModelNode& cNode = m_directoryModel.GetNode(a_index);
 
     const std::filesystem::path& path = cNode.Path;
 
+    const float startYPos = ImGui::GetCursorScreenPos().y;
+
     ImGui::BeginGroup();
 
-    const std::filesystem::path filenamePath = path.filename();
-    const std::string filename = filenamePath.string();
+    const std::string& filename = cNode.Name;
 
     Texture* tex;
 
-    if (std::filesystem::is_empty(path))
+    if (m_directoryModel.IsEmpty(a_index))
     {
         tex = Datastore::GetTexture("Textures/FileIcons/FileIcon_FolderEmpty.png");
     }
@@ -393,7 +393,7 @@ bool AssetBrowserWindow::ShowFolder(bool a_context, uint32_t a_index)
     FlareImGui::ImageButton(filename.c_str(), tex, glm::vec2((float)ItemWidth), false);
     if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(0))
     {
-        m_curIndex = a_index;
+        SetCurrentFolder(a_index);
     }
 
     if (!a_context && ImGui::BeginPopupContextItem()) 
@@ -411,28 +411,24 @@ bool AssetBrowserWindow::ShowFolder(bool a_context, uint32_t a_index)
 
     ImGui::Text("%s", filename.c_str());
 
-    ImGui::EndGroup();
+    PadItem(startYPos, ItemHeight);
 
-    ImGui::NextColumn();
+    ImGui::EndGroup();
 
     return ret;
 }
-bool AssetBrowserWindow::ShowAsset(bool a_context, const std::filesystem::path& a_path, const std::filesystem::path& a_workingPath)
+bool AssetBrowserWindow::ShowAsset(bool a_context, const DirectoryModelFile& a_file)
 {
     bool ret = false;
 
-    const ImGuiStyle& style = ImGui::GetStyle();
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     const ImVec2 curPos = ImGui::GetCursorScreenPos();
-    const ImVec2 spacing = style.ItemSpacing;
 
     const float startXPos = curPos.x;
     const float startYPos = curPos.y;
 
-    const float width = ImGui::GetColumnWidth() - spacing.x;
-    const float height = 170.0f + spacing.y;
-
-    IDEFER(ImGui::NextColumn());
+    const float width = ImGui::GetContentRegionAvail().x;
+    const float height = ItemHeight;
 
     ImGui::BeginGroup();
 
@@ -440,17 +436,19 @@ bool AssetBrowserWindow::ShowAsset(bool a_context, const std::filesystem::path&
 
     drawList->AddRectFilled(ImVec2(startXPos, startYPos), ImVec2(startXPos + width, startYPos + height), rectColor, 2.0f);
 
-    const std::filesystem::path filenamePath = a_path.stem();
-    const std::string filename = filenamePath.string();
-    const std::filesystem::path rPath = IO::GetRelativePath(a_workingPath, a_path);
-    const std::string pathStr = a_path.string();
+    const std::filesystem::path& a_path = a_file.Path;
+    const std::string& filename = a_file.Name;
+    const std::filesystem::path& rPath = a_file.RelativePath;
+    const std::string& pathStr = a_file.PathString;
 
     FileHandler::FileCallback* openCallback;
     FileHandler::FileCallback* dragCallback;
     GLuint tex;
-    FileHandler::GetFileData(rPath, &openCallback, &dragCallback, &tex);
+    glm::vec2 uv0;
+    glm::vec2 uv1;
+    FileHandler::GetFileData(a_path, &openCallback, &dragCallback, &tex, &uv0, &uv1);
 
-    FlareImGui::ImageButton(pathStr.c_str(), tex, glm::vec2((float)ItemWidth), false);
+    FlareImGui::ImageButton(pathStr.c_str(), tex, glm::vec2((float)ItemWidth), uv0, uv1, false);
 
     uint32_t size;
     const uint8_t* data;
@@ -508,161 +506,123 @@ bool AssetBrowserWindow::ShowAsset(bool a_context, const std::filesystem::path&
         ImGui::Text("%s", AssetTypeStrings[type]);
     }
 
+    PadItem(startYPos, ItemHeight);
+
     ImGui::EndGroup();
 
     return ret;
 }
 
-bool AssetBrowserWindow::ShowBaseAssetList(const DirectoryNode& a_node)
+// Items are padded to the same height so the clipper can step over whole rows
+template<typename T>
+static bool ShowItemRows(uint32_t a_itemCount, uint32_t a_columnCount, const T& a_showItem)
 {
     bool contextCaptured = false;
 
-    std::list<uint32_t> folders;
+    const uint32_t rowCount = (a_itemCount + a_columnCount - 1) / a_columnCount;
 
-    // Sort folders by name
-    for (const uint32_t index : a_node.Children)
+    // Clipper is table aware so it measures the first row and skips the rest that are off screen
+    ImGuiListClipper clipper;
+    clipper.Begin((int)rowCount);
+    while (clipper.Step())
     {
-        const DirectoryNode& cNode = m_fileTree[index];
-
-        if (!std::filesystem::exists(cNode.Path))
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
         {
-            continue;
-        }
+            ImGui::TableNextRow();
 
-        for (auto iter = folders.begin(); iter != folders.end(); ++iter)
-        {
-            const DirectoryNode& pNode = m_fileTree[*iter];
+            const uint32_t start = (uint32_t)row * a_columnCount;
+            const uint32_t end = glm::min(start + a_columnCount, a_itemCount);
 
-            if (pNode.Path > cNode.Path)
+            for (uint32_t i = start; i < end; ++i)
             {
-                folders.insert(iter, index);
+                ImGui::TableNextColumn();
 
-                goto NextFolder;
+                if (a_showItem(i, contextCaptured))
+                {
+                    contextCaptured = true;
+                }
             }
         }
-
-        folders.emplace_back(index);
-
-        NextFolder:;
     }
 
-    for (const uint32_t index : folders)
-    {
-        const DirectoryNode& cNode = m_fileTree[index];
+    return contextCaptured;
+}
 
-        if (!std::filesystem::exists(cNode.Path))
-        {
-            continue;
-        }
+bool AssetBrowserWindow::ShowBaseAssetList(const DirectoryModelNode& a_node, uint32_t a_columnCount)
+{
+    const uint32_t folderCount = (uint32_t)a_node.Children.size();
+    const uint32_t itemCount = folderCount + (uint32_t)a_node.Files.size();
 
-        if (ShowFolder(contextCaptured, index))
+    // Model keeps everything sorted and up to date so can just draw the rows that are on screen
+    return ShowItemRows(itemCount, a_columnCount, [&](uint32_t a_index, bool a_context) -> bool
+    {
+        if (a_index < folderCount)
         {
-            contextCaptured = true;
+            return ShowFolder(a_context, a_node.Children[a_index]);
         }
-    }
 
-    std::list<std::filesystem::path> files;
+        return ShowAsset(a_context, a_node.Files[a_index - folderCount]);
+    });
+}
+bool AssetBrowserWindow::ShowSearchAssetList(const std::string_view& a_filter, uint32_t a_columnCount)
+{
+    // Index caches the results so this only does work when the query or the project changes
+    const std::vector<AssetSearchResult>& results = m_searchIndex.Search(m_directoryModel, a_filter, m_curIndex);
 
-    // Sort files by name
-    for (const std::filesystem::path& path : a_node.Files)
+    return ShowItemRows((uint32_t)results.size(), a_columnCount, [&](uint32_t a_index, bool a_context) -> bool
     {
-        if (!std::filesystem::exists(path))
+        const AssetSearchResult& result = results[a_index];
+        if (result.File == -1)
         {
-            continue;
+            return ShowFolder(a_context, result.Node);
         }
 
-        for (auto iter = files.begin(); iter != files.end(); ++iter)
-        {
-            if (*iter > path)
-            {
-                files.insert(iter, path);
-
-                goto NextFile;
-            }
-        }
+        const DirectoryModelNode& node = m_directoryModel.GetNode(result.Node);
 
-        files.emplace_back(path);
+        return ShowAsset(a_context, node.Files[result.File]);
+    });
+}
 
-        NextFile:;
+void AssetBrowserWindow::Tick()
+{
+    if (m_curIndex == -1)
+    {
+        return;
     }
 
-    const std::filesystem::path workingPath = m_project->GetProjectPath();
-
-    for (const std::filesystem::path& path : files)
+    if (!m_directoryModel.Update())
     {
-        // Failsafe for when a file is deleted
-        if (!std::filesystem::exists(path))
-        {
-            continue;
-        }
-
-        if (ShowAsset(contextCaptured, path, workingPath))
-        {
-            contextCaptured = true;
-        }
+        return;
     }
 
-    return contextCaptured;
-}
-bool AssetBrowserWindow::ShowSearchAssetList(const DirectoryNode& a_node, const std::string_view& a_filter)
-{
-    bool contextCaptured = false;
-
-    Texture* folderTex = Datastore::GetTexture("Textures/FileIcons/FileIcon_Folder.png");
-    Texture* emptyFolderTex = Datastore::GetTexture("Textures/FileIcons/FileIcon_FolderEmpty.png");
+    m_searchIndex.Update(m_directoryModel);
 
-    for (uint32_t index : a_node.Children)
+    // Files could have been written to so previews need checking again
+    // Unchanged files only cost a stat as the thumbnail cache is keyed off the write time
+    if (m_directoryModel.IsUnknownChange())
     {
-        const DirectoryNode& cNode = m_fileTree[index];
-
-        const std::filesystem::path& p = cNode.Path;
-
-        // Failsafe for when a folder is deleted
-        if (!std::filesystem::exists(p))
-        {
-            continue;
-        }
-
-        if (ShowSearchAssetList(cNode, a_filter))
-        {
-            contextCaptured = true;
-        }
-
-        const std::string pString = p.string();
-        if (pString.find(a_filter) == std::string::npos)
-        {
-            continue;
-        }
-
-        if (ShowFolder(contextCaptured, index))
-        {
-            contextCaptured = true;
-        }
+        FileHandler::InvalidateFiles();
     }
-
-    for (const std::filesystem::path& path : a_node.Files)
+    else
     {
-        // Failsafe for when a file is deleted
-        if (!std::filesystem::exists(path))
-        {
-            continue;
-        }
-
-        const std::string pString = path.string();
-        if (pString.find(a_filter) == std::string::npos)
+        for (const uint32_t index : m_directoryModel.GetChangedNodes())
         {
-            continue;
-        }
+            if (!m_directoryModel.IsValid(index))
+            {
+                continue;
+            }
 
-        if (ShowAsset(contextCaptured, path, m_project->GetProjectPath()))
-        {
-            contextCaptured = true;
+            for (const DirectoryModelFile& file : m_directoryModel.GetNode(index).Files)
+            {
+                FileHandler::InvalidateFile(file.Path);
+            }
         }
     }
 
-    return contextCaptured;
-}
+    ResolveCurrentFolder();
 
+    Application::RequestRedraw();
+}
 void AssetBrowserWindow::Update(double a_delta)
 {
     if (m_curIndex == -1)
@@ -670,16 +630,17 @@ void AssetBrowserWindow::Update(double a_delta)
         return;
     }
 
-    const DirectoryNode& node = m_fileTree[m_curIndex];
-    std::list<uint32_t> breadcrumbs; 
+    const DirectoryModelNode& node = m_directoryModel.GetNode(m_curIndex);
+    std::vector<uint32_t> breadcrumbs; 
     uint32_t pIndex = node.Parent;
-    breadcrumbs.emplace_front(m_curIndex);
+    breadcrumbs.emplace_back(m_curIndex);
     while (pIndex != -1)
     {
-        breadcrumbs.emplace_front(pIndex);
+        breadcrumbs.emplace_back(pIndex);
 
-        pIndex = m_fileTree[pIndex].Parent;
+        pIndex = m_directoryModel.GetNode(pIndex).Parent;
     }
+    std::reverse(breadcrumbs.begin(), breadcrumbs.end());
 
     if (ImGui::BeginChild("##FolderView", { 200.0f, 0.0f }))
     {
@@ -718,15 +679,15 @@ void AssetBrowserWindow::Update(double a_delta)
 
     for (const uint32_t index : breadcrumbs)
     {
-        const DirectoryNode& node = m_fileTree[index];
+        const DirectoryModelNode& node = m_directoryModel.GetNode(index);
 
-        const std::string fileName = node.Path.filename().string();
+        const std::string& fileName = node.Name;
 
         if (index == 0)
         {
             if (FlareImGui::ImageButton("Project", "Textures/Icons/Icon_Home.png", { 16.0f, 16.0f }))
             {
-                m_curIndex = index;
+                SetCurrentFolder(index);
             }
 
             if (m_curIndex != index)
@@ -743,7 +704,7 @@ void AssetBrowserWindow::Update(double a_delta)
         {
             if (ImGui::Button(fileName.c_str()))
             {
-                m_curIndex = index;
+                SetCurrentFolder(index);
             }
 
             ImGui::SameLine();
@@ -760,19 +721,21 @@ void AssetBrowserWindow::Update(double a_delta)
     if (ImGui::BeginChild("##Explorer"))
     {
         const float width = ImGui::GetWindowWidth();
+        const int columnCount = glm::max(1, (int)(width / (ItemWidth + 20.0f)));
 
-        ImGui::Columns(glm::max(1, (int)(width / (ItemWidth + 20.0f))));
-
-        if (m_searchBuffer[0] == 0)
-        {
-            contextCaptured = ShowBaseAssetList(node);
-        }
-        else 
+        if (ImGui::BeginTable("##Assets", columnCount))
         {
-            contextCaptured = ShowSearchAssetList(node, m_searchBuffer);
-        }     
+            if (m_searchBuffer[0] == 0)
+            {
+                contextCaptured = ShowBaseAssetList(node, (uint32_t)columnCount);
+            }
+            else 
+            {
+                contextCaptured = ShowSearchAssetList(m_searchBuffer, (uint32_t)columnCount);
+            }     
 
-        ImGui::Columns();
+            ImGui::EndTable();
+        }
     }
 
     if (!contextCaptured && ImGui::BeginPopupContextWindow())
@@ -5,6 +5,7 @@
 #include "AssetLibrary.h"
 
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <glad/glad.h>
 #include <mono/metadata/appdomain.h>
@@ -19,9 +20,11 @@
 #include "Core/IcarianError.h"
 #include "Core/StringUtils.h"
 #include "EditorConfig.h"
+#include "EditorProfiler.h"
 #include "IO.h"
 #include "KtxHelpers.h"
 #include "Logger.h"
+#include "ParsedCache.h"
 #include "Project.h"
 #include "Runtime/RuntimeManager.h"
 
@@ -177,83 +180,10 @@ static void TraverseTree(std::vector<Asset>* a_assets, const std::filesystem::pa
 
             const std::string extStr = ext.string();
 
-            switch (StringHash<uint32_t>(extStr.c_str())) 
+            asset.AssetType = AssetLibrary::GetAssetTypeFromExtension(extStr);
+            if (asset.AssetType == AssetType_Other && name == "about.xml")
             {
-            case StringHash<uint32_t>(".cs"):
-            {
-                asset.AssetType = AssetType_Script;
-
-                break;
-            }
-            case StringHash<uint32_t>(".fvert"):
-            case StringHash<uint32_t>(".fpix"):
-            case StringHash<uint32_t>(".ffrag"):
-            {
-                asset.AssetType = AssetType_Shader;
-
-                break;
-            }
-            case StringHash<uint32_t>(".dll"):
-            case StringHash<uint32_t>(".so"):
-            {
-                asset.AssetType = AssetType_Assembly;
-
-                break;
-            }
-            case StringHash<uint32_t>(".def"):
-            {
-                asset.AssetType = AssetType_Def;
-
-                break;
-            }
-            case StringHash<uint32_t>(".ui"):
-            {
-                asset.AssetType = AssetType_UI;
-
-                break;
-            }
-            case StringHash<uint32_t>(".scrb"):
-            {
-                asset.AssetType = AssetType_Scribe;
-
-                break;
-            }
-            case StringHash<uint32_t>(".iscene"):
-            {
-                asset.AssetType = AssetType_Scene;
-
-                break;
-            }
-            case StringHash<uint32_t>(".png"):
-            case StringHash<uint32_t>(".ktx2"):
-            {
-                asset.AssetType = AssetType_Texture;
-
-                break;
-            }
-            case StringHash<uint32_t>(".obj"):
-            case StringHash<uint32_t>(".dae"):
-            case StringHash<uint32_t>(".fbx"):
-            case StringHash<uint32_t>(".glb"):
-            case StringHash<uint32_t>(".gltf"):
-            {
-                asset.AssetType = AssetType_Model;
-
-                break;
-            }
-            default:
-            {
-                if (name == "about.xml")
-                {
-                    asset.AssetType = AssetType_About;
-                }
-                else
-                {
-                    asset.AssetType = AssetType_Other;
-                }
-
-                break;
-            }
+                asset.AssetType = AssetType_About;
             }
 
             a_assets->emplace_back(asset);
@@ -293,6 +223,13 @@ static void ReadAssets(std::vector<Asset>* a_assets, const std::filesystem::path
     }
 }
 
+void AssetLibrary::AddAsset(const Asset& a_asset)
+{
+    m_assetLookup[a_asset.Path.string()] = (uint32_t)m_assets.size();
+
+    m_assets.emplace_back(a_asset);
+}
+
 void AssetLibrary::CreateDef(const std::filesystem::path& a_path, uint32_t a_size, uint8_t* a_data)
 {
     const Asset asset = 
@@ -305,11 +242,34 @@ void AssetLibrary::CreateDef(const std::filesystem::path& a_path, uint32_t a_siz
         .Flags = 0b1 << Asset::ForceWriteBit
     };
 
-    m_assets.emplace_back(asset);
+    AddAsset(asset);
 
     ISETBIT(m_flags, ForceSerializeBit);
 }
 
+// Takes ownership of the data, anything that serializes to the same bytes is dropped so it does not get written
+static bool SetAssetData(Asset* a_asset, uint32_t a_size, uint8_t* a_data)
+{
+    if (a_asset->Size == a_size && (a_size == 0 || memcmp(a_asset->Data, a_data, (size_t)a_size) == 0))
+    {
+        delete[] a_data;
+
+        return false;
+    }
+
+    if (a_asset->Data != nullptr)
+    {
+        delete[] a_asset->Data;
+    }
+
+    a_asset->Data = a_data;
+    a_asset->Size = a_size;
+    a_asset->ModifiedTime = std::filesystem::file_time_type::clock::now();
+    ISETBIT(a_asset->Flags, Asset::DirtyBit);
+
+    return true;
+}
+
 void AssetLibrary::WriteDef(const std::filesystem::path& a_path, uint32_t a_size, uint8_t* a_data)
 {
     for (Asset& a : m_assets)
@@ -321,14 +281,7 @@ void AssetLibrary::WriteDef(const std::filesystem::path& a_path, uint32_t a_size
 
         if (a.Path == a_path)
         {
-            if (a.Data != nullptr)
-            {
-                delete[] a.Data;
-            }
-
-            a.Data = a_data;
-            a.Size = a_size;
-            a.ModifiedTime = std::filesystem::file_time_type::clock::now();
+            SetAssetData(&a, a_size, a_data);
 
             return;
         }
@@ -347,14 +300,7 @@ void AssetLibrary::WriteScene(const std::filesystem::path& a_path, uint32_t a_si
 
         if (a.Path == a_path)
         {
-            if (a.Data != nullptr)
-            {
-                delete[] a.Data;
-            }
-
-            a.Data = a_data;
-            a.Size = a_size;
-            a.ModifiedTime = std::filesystem::file_time_type::clock::now();
+            SetAssetData(&a, a_size, a_data);
 
             return;
         }
@@ -362,6 +308,35 @@ void AssetLibrary::WriteScene(const std::filesystem::path& a_path, uint32_t a_si
 
     ICARIAN_ASSERT_MSG(0, "Scene not found");
 }
+void AssetLibrary::WriteParsedCache(const std::filesystem::path& a_path, e_AssetType a_type, uint32_t a_size, const uint8_t* a_data) const
+{
+    if (m_cachePath.empty())
+    {
+        return;
+    }
+
+    // Managed side writes these back one asset at a time while loading so avoid walking every asset each time
+    const auto iter = m_assetLookup.find(a_path.string());
+    if (iter == m_assetLookup.end())
+    {
+        return;
+    }
+
+    const Asset& a = m_assets[iter->second];
+    if (a.AssetType != a_type)
+    {
+        return;
+    }
+
+    const e_ParsedCacheType type = a_type == AssetType_Scene ? ParsedCacheType_Scene : ParsedCacheType_Def;
+
+    // Keyed off what is in memory which is what the managed side just parsed
+    const uint64_t sourceHash = ParsedCache::HashSource(a.Path, a.Data, a.Size);
+    if (!ParsedCache::Write(ParsedCache::GetCacheFile(m_cachePath, a.Path, type), type, sourceHash, a_data, a_size))
+    {
+        Logger::Warning("Failed writing parsed cache: " + a.Path.string());
+    }
+}
 
 bool AssetLibrary::ShouldRefresh(const std::filesystem::path& a_workingDir) const
 {
@@ -397,7 +372,56 @@ bool AssetLibrary::ShouldSerialize()
     return IISBITSET(m_flags, ForceSerializeBit);
 }
 
-void AssetLibrary::Refresh(const std::filesystem::path& a_workingDir)
+static MonoArray* CreateByteArray(MonoDomain* a_domain, const uint8_t* a_data, uint32_t a_size)
+{
+    MonoArray* arr = mono_array_new(a_domain, mono_get_byte_class(), (uintptr_t)a_size);
+    if (a_size > 0)
+    {
+        memcpy(mono_array_addr(arr, mono_byte, 0), a_data, (size_t)a_size);
+    }
+
+    return arr;
+}
+
+// Managed side gets the xml, the path and the cached parse if there is a valid one
+// Xml still gets passed along so it can fall back if it does not like the cached payload
+static void BuildLoadArgs(const std::vector<const Asset*>& a_assets, const std::filesystem::path& a_cachePath, e_ParsedCacheType a_type, void* a_args[3], uint32_t* a_cacheHits)
+{
+    MonoDomain* editorDomain = RuntimeManager::GetEditorDomain();
+
+    MonoClass* stringClass = mono_get_string_class();
+    MonoClass* arrayClass = mono_get_array_class();
+
+    const uint32_t count = (uint32_t)a_assets.size();
+
+    MonoArray* dataArray = mono_array_new(editorDomain, arrayClass, (uintptr_t)count);
+    MonoArray* pathArray = mono_array_new(editorDomain, stringClass, (uintptr_t)count);
+    MonoArray* cacheArray = mono_array_new(editorDomain, arrayClass, (uintptr_t)count);
+
+    std::vector<uint8_t> payload;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const Asset* asset = a_assets[i];
+
+        mono_array_set(dataArray, MonoArray*, i, CreateByteArray(editorDomain, asset->Data, asset->Size));
+        mono_array_set(pathArray, MonoString*, i, mono_string_from_utf32((mono_unichar4*)asset->Path.u32string().c_str()));
+
+        const uint64_t sourceHash = ParsedCache::HashSource(asset->Path, asset->Data, asset->Size);
+        const std::filesystem::path cacheFile = ParsedCache::GetCacheFile(a_cachePath, asset->Path, a_type);
+        if (ParsedCache::Read(cacheFile, a_type, sourceHash, &payload))
+        {
+            mono_array_set(cacheArray, MonoArray*, i, CreateByteArray(editorDomain, payload.data(), (uint32_t)payload.size()));
+
+            ++*a_cacheHits;
+        }
+    }
+
+    a_args[0] = dataArray;
+    a_args[1] = pathArray;
+    a_args[2] = cacheArray;
+}
+
+void AssetLibrary::Refresh(const Project* a_project)
 {
     // TODO: Naive wiping the assets should be smarter about it
     for (const Asset& asset : m_assets)
@@ -409,24 +433,28 @@ void AssetLibrary::Refresh(const std::filesystem::path& a_workingDir)
     }
 
     m_assets.clear();
+    m_assetLookup.clear();
 
-    const std::filesystem::path p = a_workingDir / "Project";
+    const std::filesystem::path p = a_project->GetProjectPath();
+    m_cachePath = a_project->GetCachePath();
 
     TraverseTree(&m_assets, p, p);
     ReadAssets(&m_assets, p);
 
+    const uint32_t assetCount = (uint32_t)m_assets.size();
+    m_assetLookup.reserve(assetCount);
+    for (uint32_t i = 0; i < assetCount; ++i)
+    {
+        m_assetLookup.emplace(m_assets[i].Path.string(), i);
+    }
+
     if (!RuntimeManager::IsBuilt() || !RuntimeManager::IsRunning())
     {
         return;
     }
 
-    std::vector<const uint8_t*> defAssets;
-    std::vector<uint32_t> defSizes;
-    std::vector<std::filesystem::path> defPaths;
-
-    std::vector<const uint8_t*> sceneAssets;
-    std::vector<uint32_t> sceneSizes;
-    std::vector<std::filesystem::path> scenePaths;
+    std::vector<const Asset*> defAssets;
+    std::vector<const Asset*> sceneAssets;
 
     for (const Asset& asset : m_assets)
     {
@@ -434,17 +462,13 @@ void AssetLibrary::Refresh(const std::filesystem::path& a_workingDir)
         {
         case AssetType_Def:
         {
-            defAssets.emplace_back(asset.Data);
-            defSizes.emplace_back((uint32_t)asset.Size);
-            defPaths.emplace_back(asset.Path);
+            defAssets.emplace_back(&asset);
 
             break;
         }
         case AssetType_Scene:
         {
-            sceneAssets.emplace_back(asset.Data);
-            sceneSizes.emplace_back((uint32_t)asset.Size);
-            scenePaths.emplace_back(asset.Path);
+            sceneAssets.emplace_back(&asset);
 
             break;
         }
@@ -455,60 +479,20 @@ void AssetLibrary::Refresh(const std::filesystem::path& a_workingDir)
         }
     }
 
-    MonoDomain* editorDomain = RuntimeManager::GetEditorDomain();
-
-    MonoClass* stringClass = mono_get_string_class();
-    MonoClass* byteClass = mono_get_byte_class();
-    MonoClass* arrayClass = mono_get_array_class();
-
-    const uint32_t defSize = (uint32_t)defAssets.size();
-
-    MonoArray* defDataArray = mono_array_new(editorDomain, arrayClass, (uintptr_t)defSize);
-    MonoArray* defPathArray = mono_array_new(editorDomain, stringClass, (uintptr_t)defSize);
-    for (uint32_t i = 0; i < defSize; ++i)
-    {
-        MonoArray* data = mono_array_new(editorDomain, byteClass, defSizes[i]);
-        for (uint32_t j = 0; j < defSizes[i]; ++j)
-        {
-            mono_array_set(data, mono_byte, j, (mono_byte)defAssets[i][j]);
-        }
-
-        mono_array_set(defDataArray, MonoArray*, i, data);
-        mono_array_set(defPathArray, MonoString*, i, mono_string_from_utf32((mono_unichar4*)defPaths[i].u32string().c_str()));
-    }
-
-    void* defArgs[] = 
-    {
-        defDataArray,
-        defPathArray
-    };
-
-    RuntimeManager::ExecFunction("IcarianEditor", "EditorDefLibrary", ":Load(byte[][],string[])", defArgs);
+    uint32_t cacheHits = 0;
 
-    const uint32_t sceneSize = (uint32_t)sceneAssets.size();
+    void* defArgs[3];
+    BuildLoadArgs(defAssets, m_cachePath, ParsedCacheType_Def, defArgs, &cacheHits);
 
-    MonoArray* sceneDataArray = mono_array_new(editorDomain, arrayClass, (uintptr_t)sceneSize);
-    MonoArray* scenePathArray = mono_array_new(editorDomain, stringClass, (uintptr_t)sceneSize);
+    RuntimeManager::ExecFunction("IcarianEditor", "EditorDefLibrary", ":Load(byte[][],string[],byte[][])", defArgs);
 
-    for (uint32_t i = 0; i < sceneSize; ++i)
-    {
-        MonoArray* data = mono_array_new(editorDomain, byteClass, sceneSizes[i]);
-        for (uint32_t j = 0; j < sceneSizes[i]; ++j)
-        {
-            mono_array_set(data, mono_byte, j, (mono_byte)sceneAssets[i][j]);
-        }
+    void* sceneArgs[3];
+    BuildLoadArgs(sceneAssets, m_cachePath, ParsedCacheType_Scene, sceneArgs, &cacheHits);
 
-        mono_array_set(sceneDataArray, MonoArray*, i, data);
-        mono_array_set(scenePathArray, MonoString*, i, mono_string_from_utf32((mono_unichar4*)scenePaths[i].u32string().c_str()));
-    }
+    RuntimeManager::ExecFunction("IcarianEditor", "EditorScene", ":LoadScenes(byte[][],string[],byte[][])", sceneArgs);
 
-    void* sceneArgs[] =
-    {
-        sceneDataArray,
-        scenePathArray
-    };
-
-    RuntimeManager::ExecFunction("IcarianEditor", "EditorScene", ":LoadScenes(byte[][],string[])", sceneArgs);
+    EDITOR_PROFILE_COUNTER("Parsed Cache Hits", cacheHits);
+    EDITOR_PROFILE_COUNTER("Parsed Cache Misses", (defAssets.size() + sceneAssets.size()) - cacheHits);
 }
 
 static bool ShouldWriteFile(const std::filesystem::path& a_path, const std::filesystem::file_time_type& a_modifiedTime)
@@ -802,6 +786,62 @@ std::vector<std::filesystem::path> AssetLibrary::GetAssetPathWithExtension(const
     return paths;
 }
 
+e_AssetType AssetLibrary::GetAssetTypeFromExtension(const std::string& a_ext)
+{
+    switch (StringHash<uint32_t>(a_ext.c_str()))
+    {
+    case StringHash<uint32_t>(".cs"):
+    {
+        return AssetType_Script;
+    }
+    case StringHash<uint32_t>(".fvert"):
+    case StringHash<uint32_t>(".fpix"):
+    case StringHash<uint32_t>(".ffrag"):
+    {
+        return AssetType_Shader;
+    }
+    case StringHash<uint32_t>(".dll"):
+    case StringHash<uint32_t>(".so"):
+    {
+        return AssetType_Assembly;
+    }
+    case StringHash<uint32_t>(".def"):
+    {
+        return AssetType_Def;
+    }
+    case StringHash<uint32_t>(".ui"):
+    {
+        return AssetType_UI;
+    }
+    case StringHash<uint32_t>(".scrb"):
+    {
+        return AssetType_Scribe;
+    }
+    case StringHash<uint32_t>(".iscene"):
+    {
+        return AssetType_Scene;
+    }
+    case StringHash<uint32_t>(".png"):
+    case StringHash<uint32_t>(".ktx2"):
+    {
+        return AssetType_Texture;
+    }
+    case StringHash<uint32_t>(".obj"):
+    case StringHash<uint32_t>(".dae"):
+    case StringHash<uint32_t>(".fbx"):
+    case StringHash<uint32_t>(".glb"):
+    case StringHash<uint32_t>(".gltf"):
+    {
+        return AssetType_Model;
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return AssetType_Other;
+}
 e_AssetType AssetLibrary::GetAssetType(const std::filesystem::path& a_path)
 {
     for (const Asset& a : m_assets)
@@ -860,7 +900,7 @@ void AssetLibrary::WriteAsset(const std::filesystem::path& a_path, uint32_t a_si
 
     ISETBIT(asset.Flags, Asset::ForceWriteBit);
 
-    m_assets.emplace_back(asset);
+    AddAsset(asset);
 
     ISETBIT(m_flags, ForceSerializeBit);
 }
@@ -912,37 +952,18 @@ void AssetLibrary::Serialize(const Project* a_project)
 
         const e_AssetType type = a.AssetType;
 
+        // Files only go out when something asked for it or the editor changed what is in them
         if (!IISBITSET(a.Flags, Asset::ForceWriteBit))
         {
-            switch (type) 
-            {
-            // Editor does not touch theses files so if there is not a force write just skip
-            case AssetType_Assembly:
-            case AssetType_Script:
-            case AssetType_Shader:
-            case AssetType_Model:
-            case AssetType_Texture:
-            // Not at this point but may change
-            case AssetType_About:
-            case AssetType_Scribe:
-            case AssetType_UI:
+            if (!IISBITSET(a.Flags, Asset::DirtyBit))
             {
                 continue;
             }
-            // Editor only writes theses files if the Editor is the Def editor
-            case AssetType_Def:
-            {
-                if (defEditor != DefEditor_Editor)
-                {
-                    continue;
-                }
 
-                break;
-            }
-            default:
+            // Editor only writes def edits if the Editor is the Def editor
+            if (type == AssetType_Def && defEditor != DefEditor_Editor)
             {
-                break;
-            }
+                continue;
             }
         }
         
@@ -964,6 +985,9 @@ void AssetLibrary::Serialize(const Project* a_project)
 
         a.ModifiedTime = std::filesystem::file_time_type::clock::now();
         ICLEARBIT(a.Flags, Asset::ForceWriteBit);
+        ICLEARBIT(a.Flags, Asset::DirtyBit);
+
+        EDITOR_PROFILE_COUNTER_ADD("Serialized Assets", 1);
     }
 }
 
@@ -0,0 +1,421 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "AssetSearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "DirectoryModel.h"
+
+static constexpr uint32_t TrigramSize = 3;
+
+static std::string ToLower(const std::string_view& a_string)
+{
+    std::string str = std::string(a_string);
+    for (char& c : str)
+    {
+        c = (char)std::tolower((unsigned char)c);
+    }
+
+    return str;
+}
+
+static std::vector<uint32_t> GetTrigrams(const std::string_view& a_string)
+{
+    std::vector<uint32_t> trigrams;
+    if (a_string.size() < TrigramSize)
+    {
+        return trigrams;
+    }
+
+    const uint32_t count = (uint32_t)a_string.size() - (TrigramSize - 1);
+    trigrams.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const char* str = a_string.data() + i;
+
+        trigrams.emplace_back(((uint32_t)(uint8_t)str[0] << 16) | ((uint32_t)(uint8_t)str[1] << 8) | (uint32_t)(uint8_t)str[2]);
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+    return trigrams;
+}
+
+// Higher is better, negative means it does not match at all
+static int32_t ScoreEntry(const AssetSearchEntry& a_entry, const std::string_view& a_query, uint32_t a_trigramHits)
+{
+    const std::string_view key = a_entry.Key;
+    const std::string_view name = key.substr(a_entry.NameOffset);
+
+    int32_t score = (int32_t)a_trigramHits * 8;
+
+    const std::size_t namePos = name.find(a_query);
+    if (namePos != std::string_view::npos)
+    {
+        score += 1000;
+        if (namePos == 0)
+        {
+            score += 500;
+        }
+
+        if (name.size() == a_query.size())
+        {
+            score += 500;
+        }
+    }
+    else if (key.find(a_query) != std::string_view::npos)
+    {
+        score += 400;
+    }
+    else
+    {
+        // Fall back to an in order match of the characters, tighter is better
+        uint32_t queryIndex = 0;
+        uint32_t gaps = 0;
+        uint32_t lastMatch = 0;
+        const uint32_t keySize = (uint32_t)key.size();
+        const uint32_t querySize = (uint32_t)a_query.size();
+        for (uint32_t i = 0; i < keySize && queryIndex < querySize; ++i)
+        {
+            if (key[i] == a_query[queryIndex])
+            {
+                if (queryIndex > 0)
+                {
+                    gaps += i - lastMatch - 1;
+                }
+
+                lastMatch = i;
+                ++queryIndex;
+            }
+        }
+
+        if (queryIndex == querySize)
+        {
+            score += 200 - (int32_t)std::min(gaps, 199U);
+        }
+        else if (a_trigramHits == 0)
+        {
+            return -1;
+        }
+    }
+
+    // Prefer shorter paths when everything else is equal
+    score -= (int32_t)std::min((uint32_t)key.size(), 64U);
+
+    return score;
+}
+
+AssetSearchIndex::AssetSearchIndex()
+{
+    m_version = 0;
+
+    m_cachedRoot = -1;
+    m_cachedVersion = -1;
+}
+AssetSearchIndex::~AssetSearchIndex()
+{
+
+}
+
+uint32_t AssetSearchIndex::AddEntry(uint32_t a_node, uint32_t a_file, const std::string_view& a_path, uint32_t a_nameOffset)
+{
+    uint32_t index;
+    if (!m_freeEntries.empty())
+    {
+        index = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    }
+    else
+    {
+        index = (uint32_t)m_entries.size();
+        m_entries.emplace_back();
+    }
+
+    AssetSearchEntry& entry = m_entries[index];
+    entry.Node = a_node;
+    entry.File = a_file;
+    entry.Key = ToLower(a_path);
+    entry.NameOffset = a_nameOffset;
+    entry.Valid = true;
+
+    const std::vector<uint32_t> trigrams = GetTrigrams(entry.Key);
+    for (const uint32_t trigram : trigrams)
+    {
+        m_trigrams[trigram].emplace_back(index);
+    }
+
+    return index;
+}
+void AssetSearchIndex::RemoveNodeEntries(uint32_t a_node)
+{
+    const auto iter = m_nodeEntries.find(a_node);
+    if (iter == m_nodeEntries.end())
+    {
+        return;
+    }
+
+    for (const uint32_t index : iter->second)
+    {
+        AssetSearchEntry& entry = m_entries[index];
+
+        const std::vector<uint32_t> trigrams = GetTrigrams(entry.Key);
+        for (const uint32_t trigram : trigrams)
+        {
+            const auto tIter = m_trigrams.find(trigram);
+            if (tIter == m_trigrams.end())
+            {
+                continue;
+            }
+
+            // Order does not matter so swap remove
+            std::vector<uint32_t>& postings = tIter->second;
+            const auto pIter = std::find(postings.begin(), postings.end(), index);
+            if (pIter != postings.end())
+            {
+                *pIter = postings.back();
+                postings.pop_back();
+            }
+
+            if (postings.empty())
+            {
+                m_trigrams.erase(tIter);
+            }
+        }
+
+        entry.Key.clear();
+        entry.Valid = false;
+
+        m_freeEntries.emplace_back(index);
+    }
+
+    m_nodeEntries.erase(iter);
+}
+void AssetSearchIndex::AddNodeEntries(const DirectoryModel& a_model, uint32_t a_node)
+{
+    const DirectoryModelNode& node = a_model.GetNode(a_node);
+    const std::string_view rootPath = a_model.GetNode(0).PathString;
+
+    // Search against the project relative path so the project location does not affect results
+    const auto getRelative = [rootPath](const std::string_view& a_path) -> std::string_view
+    {
+        if (a_path.size() <= rootPath.size())
+        {
+            return std::string_view();
+        }
+
+        return a_path.substr(rootPath.size() + 1);
+    };
+    const auto getNameOffset = [](const std::string_view& a_path) -> uint32_t
+    {
+        const std::size_t pos = a_path.find_last_of("/\\");
+        if (pos == std::string_view::npos)
+        {
+            return 0;
+        }
+
+        return (uint32_t)pos + 1;
+    };
+
+    std::vector<uint32_t>& entries = m_nodeEntries[a_node];
+    entries.reserve(node.Files.size() + 1);
+
+    // Root folder is not worth searching for
+    if (node.Parent != -1)
+    {
+        const std::string_view path = getRelative(node.PathString);
+
+        entries.emplace_back(AddEntry(a_node, -1, path, getNameOffset(path)));
+    }
+
+    const uint32_t fileCount = (uint32_t)node.Files.size();
+    for (uint32_t i = 0; i < fileCount; ++i)
+    {
+        const std::string_view path = getRelative(node.Files[i].PathString);
+
+        entries.emplace_back(AddEntry(a_node, i, path, getNameOffset(path)));
+    }
+}
+
+bool AssetSearchIndex::IsUnderNode(const DirectoryModel& a_model, uint32_t a_node, uint32_t a_root) const
+{
+    uint32_t index = a_node;
+    while (index != -1)
+    {
+        if (index == a_root)
+        {
+            return true;
+        }
+
+        index = a_model.GetNode(index).Parent;
+    }
+
+    return false;
+}
+
+void AssetSearchIndex::Build(const DirectoryModel& a_model)
+{
+    m_entries.clear();
+    m_freeEntries.clear();
+    m_nodeEntries.clear();
+    m_trigrams.clear();
+
+    const uint32_t count = a_model.GetNodeCount();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (a_model.IsValid(i))
+        {
+            AddNodeEntries(a_model, i);
+        }
+    }
+
+    ++m_version;
+}
+void AssetSearchIndex::Update(const DirectoryModel& a_model)
+{
+    std::vector<uint32_t> nodes = a_model.GetChangedNodes();
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+    for (const uint32_t node : nodes)
+    {
+        RemoveNodeEntries(node);
+
+        if (a_model.IsValid(node))
+        {
+            AddNodeEntries(a_model, node);
+        }
+    }
+
+    ++m_version;
+}
+
+const std::vector<AssetSearchResult>& AssetSearchIndex::Search(const DirectoryModel& a_model, const std::string_view& a_query, uint32_t a_root)
+{
+    const std::string query = ToLower(a_query);
+    if (query == m_cachedQuery && a_root == m_cachedRoot && m_version == m_cachedVersion)
+    {
+        return m_results;
+    }
+
+    m_cachedQuery = query;
+    m_cachedRoot = a_root;
+    m_cachedVersion = m_version;
+    m_results.clear();
+
+    if (query.empty())
+    {
+        return m_results;
+    }
+
+    const uint32_t entryCount = (uint32_t)m_entries.size();
+    std::vector<uint32_t> hits = std::vector<uint32_t>(entryCount, 0);
+
+    const std::vector<uint32_t> trigrams = GetTrigrams(query);
+    const uint32_t trigramCount = (uint32_t)trigrams.size();
+    if (trigramCount > 0)
+    {
+        for (const uint32_t trigram : trigrams)
+        {
+            const auto iter = m_trigrams.find(trigram);
+            if (iter == m_trigrams.end())
+            {
+                continue;
+            }
+
+            for (const uint32_t index : iter->second)
+            {
+                ++hits[index];
+            }
+        }
+    }
+
+    // Allow for a few typos by only needing half the trigrams to line up
+    const uint32_t minHits = std::max(1U, trigramCount / 2);
+
+    for (uint32_t i = 0; i < entryCount; ++i)
+    {
+        const AssetSearchEntry& entry = m_entries[i];
+        if (!entry.Valid)
+        {
+            continue;
+        }
+
+        // Short queries have no trigrams so every entry has to be scored
+        if (trigramCount > 0 && hits[i] < minHits)
+        {
+            continue;
+        }
+
+        const int32_t score = ScoreEntry(entry, query, hits[i]);
+        if (score < 0)
+        {
+            continue;
+        }
+
+        if (a_root != 0 && !IsUnderNode(a_model, entry.Node, a_root))
+        {
+            continue;
+        }
+
+        // Folder is the node itself so should not show when searching inside it
+        if (entry.File == -1 && entry.Node == a_root)
+        {
+            continue;
+        }
+
+        m_results.emplace_back(AssetSearchResult{ i, entry.Node, entry.File, score });
+    }
+
+    const auto compare = [this](const AssetSearchResult& a_lhs, const AssetSearchResult& a_rhs)
+    {
+        if (a_lhs.Score != a_rhs.Score)
+        {
+            return a_lhs.Score > a_rhs.Score;
+        }
+
+        return m_entries[a_lhs.Entry].Key < m_entries[a_rhs.Entry].Key;
+    };
+
+    if (m_results.size() > MaxResults)
+    {
+        std::partial_sort(m_results.begin(), m_results.begin() + MaxResults, m_results.end(), compare);
+        m_results.resize(MaxResults);
+    }
+    else
+    {
+        std::sort(m_results.begin(), m_results.end(), compare);
+    }
+
+    return m_results;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
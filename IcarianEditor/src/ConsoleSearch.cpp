@@ -0,0 +1,191 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "ConsoleSearch.h"
+
+#include <algorithm>
+#include <cctype>
+
+static constexpr uint32_t TrigramSize = 3;
+
+static char ToLower(char a_char)
+{
+    return (char)std::tolower((unsigned char)a_char);
+}
+
+static uint32_t GetTrigram(const char* a_str)
+{
+    return ((uint32_t)(uint8_t)ToLower(a_str[0]) << 16) | ((uint32_t)(uint8_t)ToLower(a_str[1]) << 8) | (uint32_t)(uint8_t)ToLower(a_str[2]);
+}
+
+static std::vector<uint32_t> GetTrigrams(const std::string_view& a_string)
+{
+    std::vector<uint32_t> trigrams;
+    if (a_string.size() < TrigramSize)
+    {
+        return trigrams;
+    }
+
+    const uint32_t count = (uint32_t)a_string.size() - (TrigramSize - 1);
+    trigrams.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        trigrams.emplace_back(GetTrigram(a_string.data() + i));
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+
+    return trigrams;
+}
+
+ConsoleSearch::ConsoleSearch()
+{
+    m_useRegex = false;
+    m_valid = true;
+}
+ConsoleSearch::~ConsoleSearch()
+{
+
+}
+
+void ConsoleSearch::AddString(uint32_t a_index, const std::string_view& a_string)
+{
+    const std::vector<uint32_t> trigrams = GetTrigrams(a_string);
+    for (const uint32_t trigram : trigrams)
+    {
+        m_trigrams[trigram].emplace_back(a_index);
+    }
+}
+void ConsoleSearch::RemoveString(uint32_t a_index, const std::string_view& a_string)
+{
+    const std::vector<uint32_t> trigrams = GetTrigrams(a_string);
+    for (const uint32_t trigram : trigrams)
+    {
+        const auto iter = m_trigrams.find(trigram);
+        if (iter == m_trigrams.end())
+        {
+            continue;
+        }
+
+        // Order does not matter so swap remove
+        std::vector<uint32_t>& postings = iter->second;
+        const auto postIter = std::find(postings.begin(), postings.end(), a_index);
+        if (postIter != postings.end())
+        {
+            *postIter = postings.back();
+            postings.pop_back();
+        }
+
+        if (postings.empty())
+        {
+            m_trigrams.erase(iter);
+        }
+    }
+}
+void ConsoleSearch::Clear()
+{
+    m_trigrams.clear();
+}
+
+bool ConsoleSearch::SetQuery(const std::string_view& a_query, bool a_regex)
+{
+    m_query = std::string(a_query);
+    m_useRegex = a_regex;
+    m_valid = true;
+
+    if (m_useRegex && !m_query.empty())
+    {
+        // std::regex only reports bad patterns through exceptions
+        try
+        {
+            m_regex = std::regex(m_query, std::regex::ECMAScript | std::regex::icase | std::regex::optimize);
+        }
+        catch (const std::regex_error&)
+        {
+            m_valid = false;
+        }
+    }
+
+    return m_valid;
+}
+
+bool ConsoleSearch::Match(const std::string_view& a_string) const
+{
+    if (m_query.empty())
+    {
+        return true;
+    }
+
+    if (!m_valid)
+    {
+        return false;
+    }
+
+    if (m_useRegex)
+    {
+        return std::regex_search(a_string.begin(), a_string.end(), m_regex);
+    }
+
+    const auto iter = std::search(a_string.begin(), a_string.end(), m_query.begin(), m_query.end(), [](char a_lhs, char a_rhs)
+    {
+        return ToLower(a_lhs) == ToLower(a_rhs);
+    });
+
+    return iter != a_string.end();
+}
+
+bool ConsoleSearch::GetCandidates(uint32_t a_stringCount, std::vector<uint32_t>* a_candidates) const
+{
+    if (m_useRegex || m_query.size() < TrigramSize)
+    {
+        return false;
+    }
+
+    const std::vector<uint32_t> trigrams = GetTrigrams(m_query);
+    const uint32_t trigramCount = (uint32_t)trigrams.size();
+
+    // A string is only a candidate if it appears in the postings of every query trigram
+    std::vector<uint32_t> hits = std::vector<uint32_t>(a_stringCount, 0);
+    for (const uint32_t trigram : trigrams)
+    {
+        const auto iter = m_trigrams.find(trigram);
+        if (iter == m_trigrams.end())
+        {
+            return true;
+        }
+
+        for (const uint32_t index : iter->second)
+        {
+            if (index < a_stringCount && ++hits[index] == trigramCount)
+            {
+                a_candidates->emplace_back(index);
+            }
+        }
+    }
+
+    return true;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
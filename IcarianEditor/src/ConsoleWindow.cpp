@@ -4,6 +4,7 @@
 
 #include "Windows/ConsoleWindow.h"
 
+#include <algorithm>
 #include <imgui.h>
 
 #include "Core/Bitfield.h"
@@ -17,10 +18,25 @@ ConsoleWindow::ConsoleWindow() : Window("Console", "Textures/WindowIcons/WindowI
 {
     Logger::AddConsoleWindow(this);
 
+    m_messageHead = -1;
+    m_messageTail = -1;
+    m_messageCount = 0;
+
+    m_rowStart = 0;
+    m_groupsDirty = false;
+
+    m_searchBuffer[0] = 0;
+
+    // Lookup keys point into the stored strings so the storage can never be reallocated
+    // Every message holds at most one string and a new one is interned before the oldest is dropped
+    m_strings.reserve(MaxMessages + 1);
+
     m_flags = 0;
     m_flags |= 0b1 << DisplayWarningBit;
     m_flags |= 0b1 << DisplayErrorBit;
     m_flags |= 0b1 << DisplayEditorBit;
+    m_flags |= 0b1 << DisplayEngineBit;
+    m_flags |= 0b1 << DisplayScriptBit;
     m_flags |= 0b1 << CollapseBit;
 }   
 ConsoleWindow::~ConsoleWindow()
@@ -28,50 +44,365 @@ ConsoleWindow::~ConsoleWindow()
     Logger::RemoveConsoleWindow(this);
 }
 
-void ConsoleWindow::AddMessage(const std::string_view& a_message, bool a_editor, e_LoggerMessageType a_type)
+uint64_t ConsoleWindow::GetRecordKey(uint32_t a_string, e_LoggerMessageType a_type, e_LoggerMessageSource a_source)
 {
-    const bool full = m_messages.size() > MaxMessages;
-    if (full)
+    return ((uint64_t)a_string << 16) | ((uint64_t)a_type << 8) | (uint64_t)a_source;
+}
+
+uint32_t ConsoleWindow::InternString(const std::string_view& a_message)
+{
+    const auto iter = m_stringLookup.find(a_message);
+    if (iter != m_stringLookup.end())
     {
-        m_messages.erase(m_messages.begin());
+        ++m_strings[iter->second].RefCount;
+
+        return iter->second;
     }
 
-    if (!m_messages.empty())
+    uint32_t index;
+    if (!m_freeStrings.empty())
+    {
+        index = m_freeStrings.back();
+        m_freeStrings.pop_back();
+    }
+    else
+    {
+        index = (uint32_t)m_strings.size();
+        m_strings.emplace_back();
+    }
+
+    ConsoleString& str = m_strings[index];
+    str.Message = std::string(a_message);
+    str.RefCount = 1;
+
+    m_stringLookup.emplace(std::string_view(str.Message), index);
+
+    // Search only runs once per unique string as it comes in instead of every message
+    m_search.AddString(index, str.Message);
+    str.Match = m_search.Match(str.Message);
+
+    return index;
+}
+void ConsoleWindow::ReleaseString(uint32_t a_string)
+{
+    ConsoleString& str = m_strings[a_string];
+    if (--str.RefCount > 0)
     {
-        ConsoleMessage& msg = *--m_messages.end();   
+        return;
+    }
 
-        if (msg.Type == a_type && msg.Message == a_message)
+    m_stringLookup.erase(std::string_view(str.Message));
+    m_search.RemoveString(a_string, str.Message);
+    // Keep the buffer around so the slot can be reused without allocating
+    str.Message.clear();
+
+    m_freeStrings.emplace_back(a_string);
+}
+
+bool ConsoleWindow::IsVisible(const ConsoleMessage& a_message) const
+{
+    switch (a_message.Source)
+    {
+    case LoggerMessageSource_Editor:
+    {
+        if (!IISBITSET(m_flags, DisplayEditorBit))
         {
-            ++msg.Count;
+            return false;
+        }
+
+        break;
+    }
+    case LoggerMessageSource_Engine:
+    {
+        if (!IISBITSET(m_flags, DisplayEngineBit))
+        {
+            return false;
+        }
+
+        break;
+    }
+    case LoggerMessageSource_Script:
+    {
+        if (!IISBITSET(m_flags, DisplayScriptBit))
+        {
+            return false;
+        }
+
+        break;
+    }
+    }
+
+    if (!m_strings[a_message.String].Match)
+    {
+        return false;
+    }
+
+    switch (a_message.Type)
+    {
+    case LoggerMessageType_Message:
+    {
+        return IISBITSET(m_flags, DisplayMessageBit);
+    }
+    case LoggerMessageType_Warning:
+    {
+        return IISBITSET(m_flags, DisplayWarningBit);
+    }
+    case LoggerMessageType_Error:
+    {
+        return IISBITSET(m_flags, DisplayErrorBit);
+    }
+    }
+
+    return false;
+}
+uint64_t ConsoleWindow::GetGroupRows(const ConsoleGroup& a_group) const
+{
+    if (IISBITSET(m_flags, CollapseBit))
+    {
+        return 1;
+    }
+
+    return a_group.Count;
+}
+
+void ConsoleWindow::LinkMessage(uint32_t a_slot)
+{
+    ConsoleMessage& msg = m_messages[a_slot];
+    msg.Prev = m_messageTail;
+    msg.Next = -1;
+
+    if (m_messageTail != -1)
+    {
+        m_messages[m_messageTail].Next = a_slot;
+    }
+    else
+    {
+        m_messageHead = a_slot;
+    }
+
+    m_messageTail = a_slot;
+}
+void ConsoleWindow::UnlinkMessage(uint32_t a_slot)
+{
+    const ConsoleMessage& msg = m_messages[a_slot];
+
+    if (msg.Prev != -1)
+    {
+        m_messages[msg.Prev].Next = msg.Next;
+    }
+    else
+    {
+        m_messageHead = msg.Next;
+    }
+
+    if (msg.Next != -1)
+    {
+        m_messages[msg.Next].Prev = msg.Prev;
+    }
+    else
+    {
+        m_messageTail = msg.Prev;
+    }
+}
+
+void ConsoleWindow::PushGroup(const ConsoleMessage& a_message, uint32_t a_count)
+{
+    if (IISBITSET(m_flags, CollapseBit) && !m_groups.empty())
+    {
+        ConsoleGroup& group = m_groups.back();
+        if (group.String == a_message.String && group.Type == a_message.Type)
+        {
+            group.Count += a_count;
+            ++group.MessageCount;
 
             return;
         }
     }
 
-    const ConsoleMessage msg =
+    ConsoleGroup group;
+    group.String = a_message.String;
+    group.Count = a_count;
+    group.MessageCount = 1;
+    group.Type = a_message.Type;
+    group.RowEnd = m_groups.empty() ? m_rowStart : m_groups.back().RowEnd;
+    group.RowEnd += GetGroupRows(group);
+
+    m_groups.emplace_back(group);
+}
+void ConsoleWindow::PopGroup(const ConsoleMessage& a_message)
+{
+    // Messages leave oldest first so a visible one is always part of the front group
+    if (m_groups.empty() || !IsVisible(a_message))
     {
-        .Message = std::string(a_message),
-        .Count = 1,
-        .Type = a_type,
-        .Editor = a_editor
-    };
+        return;
+    }
+
+    ConsoleGroup& group = m_groups.front();
+    group.Count -= a_message.Count;
+    if (--group.MessageCount > 0)
+    {
+        return;
+    }
+
+    m_rowStart = group.RowEnd;
+    m_groups.pop_front();
+}
+void ConsoleWindow::RebuildGroups()
+{
+    m_groups.clear();
+    m_rowStart = 0;
+    m_groupsDirty = false;
+
+    for (uint32_t i = m_messageHead; i != -1; i = m_messages[i].Next)
+    {
+        const ConsoleMessage& msg = m_messages[i];
+        if (IsVisible(msg))
+        {
+            PushGroup(msg, msg.Count);
+        }
+    }
+}
+
+void ConsoleWindow::UpdateSearch()
+{
+    m_search.SetQuery(m_searchBuffer, IISBITSET(m_flags, RegexBit));
+
+    const uint32_t stringCount = (uint32_t)m_strings.size();
+
+    std::vector<uint32_t> candidates;
+    if (!m_search.IsEmpty() && m_search.GetCandidates(stringCount, &candidates))
+    {
+        for (ConsoleString& str : m_strings)
+        {
+            str.Match = false;
+        }
+
+        for (const uint32_t index : candidates)
+        {
+            ConsoleString& str = m_strings[index];
+            str.Match = m_search.Match(str.Message);
+        }
+    }
+    else
+    {
+        for (ConsoleString& str : m_strings)
+        {
+            if (str.RefCount > 0)
+            {
+                str.Match = m_search.Match(str.Message);
+            }
+        }
+    }
+
+    RebuildGroups();
+}
 
-    m_messages.emplace_back(msg);
+void ConsoleWindow::ClearMessages()
+{
+    m_messageHead = -1;
+    m_messageTail = -1;
+    m_messageCount = 0;
+
+    m_strings.clear();
+    m_freeStrings.clear();
+    m_stringLookup.clear();
+    m_recordLookup.clear();
+    m_search.Clear();
+
+    m_groups.clear();
+    m_rowStart = 0;
+    m_groupsDirty = false;
 }
 
-struct ConsoleDrawList
+void ConsoleWindow::AddMessage(const std::string_view& a_message, e_LoggerMessageSource a_source, e_LoggerMessageType a_type)
 {
-    const Texture* Tex;
-    ImVec4 Color;
-    uint32_t Count;
-    std::string Message;
-};
+    // Repeats are found through the hashed string lookup instead of only when logged back to back
+    const auto strIter = m_stringLookup.find(a_message);
+    if (strIter != m_stringLookup.end())
+    {
+        const auto recordIter = m_recordLookup.find(GetRecordKey(strIter->second, a_type, a_source));
+        if (recordIter != m_recordLookup.end())
+        {
+            const uint32_t slot = recordIter->second;
+            ConsoleMessage& msg = m_messages[slot];
+            ++msg.Count;
+
+            const bool visible = IsVisible(msg);
+
+            // Newest visible message is always in the back group
+            if (slot == m_messageTail)
+            {
+                if (visible && !m_groupsDirty)
+                {
+                    ConsoleGroup& group = m_groups.back();
+                    ++group.Count;
+                    if (!IISBITSET(m_flags, CollapseBit))
+                    {
+                        ++group.RowEnd;
+                    }
+                }
+
+                return;
+            }
+
+            // Moved to the newest end so it shows where it was last logged and is the last to be dropped
+            UnlinkMessage(slot);
+            LinkMessage(slot);
+
+            if (visible)
+            {
+                // Changes the rows of every group after where it was so just rebuild once before drawing
+                m_groupsDirty = true;
+            }
+
+            return;
+        }
+    }
+
+    const uint32_t strIndex = InternString(a_message);
+
+    uint32_t slot = m_messageCount;
+    if (m_messageCount >= MaxMessages)
+    {
+        // Oldest record gets dropped and its slot reused
+        slot = m_messageHead;
+
+        const ConsoleMessage& oldMsg = m_messages[slot];
+
+        if (!m_groupsDirty)
+        {
+            PopGroup(oldMsg);
+        }
+
+        m_recordLookup.erase(GetRecordKey(oldMsg.String, oldMsg.Type, oldMsg.Source));
+        ReleaseString(oldMsg.String);
+
+        UnlinkMessage(slot);
+        --m_messageCount;
+    }
+
+    ConsoleMessage& msg = m_messages[slot];
+    msg.String = strIndex;
+    msg.Count = 1;
+    msg.Type = a_type;
+    msg.Source = a_source;
+
+    LinkMessage(slot);
+    ++m_messageCount;
+
+    m_recordLookup.emplace(GetRecordKey(msg.String, msg.Type, msg.Source), slot);
+
+    if (IsVisible(msg) && !m_groupsDirty)
+    {
+        PushGroup(msg, msg.Count);
+    }
+}
 
 void ConsoleWindow::Update(double a_delta)
 {
     if (ImGui::Button("Clear"))
     {
-        m_messages.clear();
+        ClearMessages();
     }
 
     ImGui::SameLine();
@@ -80,13 +411,28 @@ void ConsoleWindow::Update(double a_delta)
     bool displayWarning = IISBITSET(m_flags, DisplayWarningBit);
     bool displayError = IISBITSET(m_flags, DisplayErrorBit);
     bool displayEditor = IISBITSET(m_flags, DisplayEditorBit);
+    bool displayEngine = IISBITSET(m_flags, DisplayEngineBit);
+    bool displayScript = IISBITSET(m_flags, DisplayScriptBit);
     bool collapse = IISBITSET(m_flags, CollapseBit);
+    bool regex = IISBITSET(m_flags, RegexBit);
+
+    const unsigned char prevFlags = m_flags;
 
     if (ImGui::Checkbox("Display Editor", &displayEditor))
     {
         ITOGGLEBIT(displayEditor, m_flags, DisplayEditorBit);
     }
     ImGui::SameLine();
+    if (ImGui::Checkbox("Display Engine", &displayEngine))
+    {
+        ITOGGLEBIT(displayEngine, m_flags, DisplayEngineBit);
+    }
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Display Script", &displayScript))
+    {
+        ITOGGLEBIT(displayScript, m_flags, DisplayScriptBit);
+    }
+    ImGui::SameLine();
     if (ImGui::Checkbox("Display Message", &displayMessage))
     {
         ITOGGLEBIT(displayMessage, m_flags, DisplayMessageBit);
@@ -107,169 +453,143 @@ void ConsoleWindow::Update(double a_delta)
         ITOGGLEBIT(collapse, m_flags, CollapseBit);
     }
 
+    bool searchChanged = false;
+
+    ImGui::PushItemWidth(256.0f);
+    if (ImGui::InputTextWithHint("##Search", "Search", m_searchBuffer, SearchBufferSize))
+    {
+        searchChanged = true;
+    }
+    ImGui::PopItemWidth();
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Regex", &regex))
+    {
+        ITOGGLEBIT(regex, m_flags, RegexBit);
+
+        searchChanged = true;
+    }
+
+    if (!m_search.IsValid())
+    {
+        ImGui::SameLine();
+        ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "%s", "Invalid Regex");
+    }
+
+    if (searchChanged)
+    {
+        UpdateSearch();
+    }
+    else if (m_flags != prevFlags || m_groupsDirty)
+    {
+        RebuildGroups();
+    }
+
     const Texture* infoTex = Datastore::GetTexture("Textures/Icons/Console_Info.png");
     const Texture* warningTex = Datastore::GetTexture("Textures/Icons/Console_Warning.png");
     const Texture* errorTex = Datastore::GetTexture("Textures/Icons/Console_Error.png");
 
-    std::vector<ConsoleDrawList> drawLists;
-
     ImGui::BeginChild("##Messages");
     IDEFER(ImGui::EndChild());
-    for (const ConsoleMessage& msg : m_messages)
+
+    if (m_groups.empty())
     {
-        if (!displayEditor && msg.Editor)
-        {
-            continue;
-        }
+        return;
+    }
 
-        ImVec4 color;
-        bool display = false;    
-        const Texture* tex = nullptr;    
+    const uint64_t count = m_groups.back().RowEnd - m_rowStart;
 
-        switch (msg.Type) 
-        {
-        case LoggerMessageType_Error:
-        {
-            display = displayError;
-
-            color = ImVec4(1.0, 0.0f, 0.0f, 1.0f);
-            tex = errorTex;
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImGuiStyle& style = ImGui::GetStyle();
+    const ImVec2 curPos = ImGui::GetCursorScreenPos();
+    const float spacing = style.ItemSpacing.y;
+    const float lineHeight = 16.0f + spacing;
+    const float windowWidth = ImGui::GetWindowWidth();
 
-            break;
-        }
-        case LoggerMessageType_Warning:
-        {
-            display = displayWarning;
+    const float startYPos = curPos.y - spacing * 0.5f;
 
-            color = ImVec4(1.0, 1.0f, 0.0f, 1.0f);
-            tex = warningTex;
+    const ImU32 oddColor = ImGui::GetColorU32(ImVec4(0.25f, 0.25f, 0.25f, 0.25f));
+    const ImU32 evenColor = ImGui::GetColorU32(ImVec4(0.0f, 0.0f, 0.0f, 0.1f));
 
-            break;
-        }
-        case LoggerMessageType_Message:
+    ImGuiListClipper clipper;
+    clipper.Begin((int)count, lineHeight);
+    while (clipper.Step())
+    {
+        // Rows map onto groups through the running row count so only the first visible row needs a search
+        auto groupIter = std::upper_bound(m_groups.begin(), m_groups.end(), m_rowStart + clipper.DisplayStart, [](uint64_t a_row, const ConsoleGroup& a_group)
         {
-            display = displayMessage;
-
-            color = ImVec4(1.0, 1.0f, 1.0f, 1.0f);
-            tex = infoTex;
+            return a_row < a_group.RowEnd;
+        });
 
-            break;
-        }
-        }
-
-        if (display)
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd && groupIter != m_groups.end(); ++row)
         {
-            if (collapse)
+            while (m_rowStart + row >= groupIter->RowEnd)
             {
-                const uint32_t count = (uint32_t)drawLists.size();
-
-                const bool empty = count <= 0;
-                if (empty)
-                {
-                    const ConsoleDrawList draw =
-                    {
-                        .Tex = tex,
-                        .Color = color,
-                        .Count = msg.Count,
-                        .Message = msg.Message
-                    };
-
-                    drawLists.emplace_back(draw);
-
-                    continue;
-                }
-
-                ConsoleDrawList& draw = drawLists[count - 1];
-                if (draw.Tex == tex && draw.Message == msg.Message)
-                {
-                    draw.Count += msg.Count;
-
-                    continue;
-                }
+                ++groupIter;
+            }
 
-                const ConsoleDrawList newDraw =
-                {
-                    .Tex = tex,
-                    .Color = color,
-                    .Count = msg.Count,
-                    .Message = msg.Message
-                };
+            const ConsoleGroup& group = *groupIter;
 
-                drawLists.emplace_back(newDraw);
+            ImU32 col;
+            const bool isOdd = row & 0b1;
+            if (isOdd)
+            {
+                col = oddColor;
             }
             else
             {
-                for (uint32_t i = 0; i < msg.Count; ++i)
-                {
-                    const ConsoleDrawList draw =
-                    {
-                        .Tex = tex,
-                        .Color = color,
-                        .Count = 1,
-                        .Message = msg.Message
-                    };
-
-                    drawLists.emplace_back(draw);
-                }
+                col = evenColor;
             }
-        }
-    }
 
-    const uint32_t count = (uint32_t)drawLists.size();
-    const bool empty = count <= 0;
-    if (!empty)
-    {
-        ImDrawList* drawList = ImGui::GetWindowDrawList();
-        const ImGuiStyle& style = ImGui::GetStyle();
-        const ImVec2 curPos = ImGui::GetCursorScreenPos();
-        const float spacing = style.ItemSpacing.y;
-        const float lineHeight = 16.0f + spacing;
-        const float windowWidth = ImGui::GetWindowWidth();
+            const float startY = startYPos + (row * lineHeight);
+            const float endY = startY + lineHeight;
 
-        const float startYPos = curPos.y - spacing * 0.5f;
+            drawList->AddRectFilled(ImVec2(curPos.x, startY), ImVec2(curPos.x + windowWidth, endY), col, 0);
 
-        const ImU32 oddColor = ImGui::GetColorU32(ImVec4(0.25f, 0.25f, 0.25f, 0.25f));
-        const ImU32 evenColor = ImGui::GetColorU32(ImVec4(0.0f, 0.0f, 0.0f, 0.1f));
+            ImVec4 color;
+            const Texture* tex = nullptr;
 
-        ImGuiListClipper clipper;
-        clipper.Begin((int)count, lineHeight);
-        while (clipper.Step())
-        {
-            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            switch (group.Type) 
             {
-                ImU32 col;
-                const bool isOdd = row & 0b1;
-                if (isOdd)
-                {
-                    col = oddColor;
-                }
-                else
-                {
-                    col = evenColor;
-                }
-
-                const float startY = startYPos + (row * lineHeight);
-                const float endY = startY + lineHeight;
+            case LoggerMessageType_Error:
+            {
+                color = ImVec4(1.0, 0.0f, 0.0f, 1.0f);
+                tex = errorTex;
 
-                drawList->AddRectFilled(ImVec2(curPos.x, startY), ImVec2(curPos.x + windowWidth, endY), col, 0);
+                break;
+            }
+            case LoggerMessageType_Warning:
+            {
+                color = ImVec4(1.0, 1.0f, 0.0f, 1.0f);
+                tex = warningTex;
 
-                const ConsoleDrawList& draw = drawLists[row];
+                break;
+            }
+            case LoggerMessageType_Message:
+            {
+                color = ImVec4(1.0, 1.0f, 1.0f, 1.0f);
+                tex = infoTex;
 
-                const bool multiItem = draw.Count > 1;
-                if (multiItem)
-                {
-                    ImGui::Text("[%d]", draw.Count);
-                    ImGui::SameLine();
-                }
+                break;
+            }
+            }
 
-                if (draw.Tex != nullptr)
-                {
-                    ImGui::Image(TexToImHandle(draw.Tex), ImVec2(16.0f, 16.0f));
-                    ImGui::SameLine();
-                }
+            const bool multiItem = collapse && group.Count > 1;
+            if (multiItem)
+            {
+                ImGui::Text("[%d]", group.Count);
+                ImGui::SameLine();
+            }
 
-                ImGui::TextColored(draw.Color, "%s", draw.Message.c_str());
+            if (tex != nullptr)
+            {
+                ImGui::Image(TexToImHandle(tex), ImVec2(16.0f, 16.0f));
+                ImGui::SameLine();
             }
+
+            const std::string& message = m_strings[group.String].Message;
+            ImGui::PushStyleColor(ImGuiCol_Text, color);
+            ImGui::TextUnformatted(message.c_str(), message.c_str() + message.size());
+            ImGui::PopStyleColor();
         }
     }
 }
@@ -5,18 +5,25 @@
 #include "Datastore.h"
 
 #include <filesystem>
+#include <fstream>
 #include <stb_image.h>
+#include <vector>
 
+#include "EditorConfig.h"
 #include "Texture.h"
+#include "TextureLoader.h"
 
 Datastore* Datastore::Instance = nullptr;
 
 Datastore::Datastore()
 {
-    
+    m_textureLoader = new TextureLoader();
 }
 Datastore::~Datastore()
 {
+    // Stop the workers before the textures go
+    delete m_textureLoader;
+
     for (auto iter = m_textures.begin(); iter != m_textures.end(); ++iter)
     {
         if (iter->second != nullptr)
@@ -42,6 +49,11 @@ void Datastore::Destroy()
     }
 }
 
+void Datastore::Update()
+{
+    Instance->m_textureLoader->Update();
+}
+
 Texture* Datastore::GetTexture(const std::string_view& a_path)
 {
     const std::string pStr = std::string(a_path);
@@ -58,21 +70,39 @@ Texture* Datastore::GetTexture(const std::string_view& a_path)
     {   
         if (p.extension() == ".png")
         {
-            int width;
-            int height;
+            std::ifstream file = std::ifstream(p, std::ios::binary | std::ios::ate);
+            const std::streamsize size = file.good() ? file.tellg() : std::streamsize(0);
+            if (size > 0)
+            {
+                file.seekg(0, std::ios::beg);
 
-            int comp;
+                std::vector<uint8_t> fileData = std::vector<uint8_t>((size_t)size);
+                file.read((char*)fileData.data(), size);
 
-            const unsigned char* data = stbi_load(a_path.data(), &width, &height, &comp, STBI_rgb_alpha);
-            if (data != nullptr)
-            {
-                Texture* tex = Texture::CreateRGBA((uint32_t)width, (uint32_t)height, data);
+                int width;
+                int height;
+
+                int comp;
+
+                const unsigned char* data = stbi_load_from_memory((const stbi_uc*)fileData.data(), (int)fileData.size(), &width, &height, &comp, STBI_rgb_alpha);
+                if (data != nullptr)
+                {
+                    Texture* tex = Texture::CreateRGBA((uint32_t)width, (uint32_t)height, data);
+
+                    Instance->m_textures.emplace(pStr, tex);
+
+                    stbi_image_free((void*)data);
 
-                Instance->m_textures.emplace(pStr, tex);
+                    Instance->m_textureLoader->SetResidentSize(tex->GetHandle(), (uint64_t)width * height * 4);
 
-                stbi_image_free((void*)data);
+                    const e_TextureQuality quality = EditorConfig::GetTextureQuality();
+                    if (quality != TextureQuality_Uncompressed)
+                    {
+                        Instance->m_textureLoader->Load(tex->GetHandle(), p, fileData.data(), (uint32_t)fileData.size(), CachePath, quality);
+                    }
 
-                return tex;
+                    return tex;
+                }
             }
         }
     }   
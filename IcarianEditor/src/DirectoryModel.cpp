@@ -0,0 +1,263 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "DirectoryModel.h"
+
+#include <algorithm>
+
+#include "IO.h"
+
+DirectoryModel::DirectoryModel()
+{
+    m_version = 0;
+    m_unknownChange = false;
+}
+DirectoryModel::~DirectoryModel()
+{
+
+}
+
+uint32_t DirectoryModel::AddNode(uint32_t a_parent, const std::filesystem::path& a_path)
+{
+    uint32_t index;
+    if (!m_freeNodes.empty())
+    {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        index = (uint32_t)m_nodes.size();
+        m_nodes.emplace_back();
+    }
+
+    DirectoryModelNode& node = m_nodes[index];
+    node.Parent = a_parent;
+    node.Path = a_path;
+    node.PathString = a_path.string();
+    node.Name = a_path.filename().string();
+    node.Children.clear();
+    node.Files.clear();
+    node.Valid = true;
+
+    m_lookup[node.PathString] = index;
+
+    m_watcher.Watch(a_path);
+
+    ScanNode(index);
+
+    return index;
+}
+void DirectoryModel::RemoveNode(uint32_t a_index)
+{
+    DirectoryModelNode& node = m_nodes[a_index];
+
+    for (const uint32_t child : node.Children)
+    {
+        RemoveNode(child);
+    }
+
+    m_watcher.Unwatch(node.Path);
+    m_lookup.erase(node.PathString);
+
+    // Parent is left alone so anything pointing at a removed node can walk back up to a valid one
+    node.Children.clear();
+    node.Files.clear();
+    node.Valid = false;
+
+    m_freeNodes.emplace_back(a_index);
+    m_changedNodes.emplace_back(a_index);
+}
+
+void DirectoryModel::ScanNode(uint32_t a_index)
+{
+    m_changedNodes.emplace_back(a_index);
+
+    std::vector<std::filesystem::path> dirPaths;
+    std::vector<DirectoryModelFile> files;
+
+    std::error_code ec;
+    m_nodes[a_index].ModifiedTime = std::filesystem::last_write_time(m_nodes[a_index].Path, ec);
+
+    for (const auto& iter : std::filesystem::directory_iterator(m_nodes[a_index].Path, std::filesystem::directory_options::skip_permission_denied, ec))
+    {
+        if (iter.is_regular_file(ec))
+        {
+            const std::filesystem::path& path = iter.path();
+
+            DirectoryModelFile file;
+            file.Path = path;
+            file.RelativePath = IO::GetRelativePath(m_root, path);
+            file.PathString = path.string();
+            file.Name = path.stem().string();
+
+            files.emplace_back(file);
+        }
+        else if (iter.is_directory(ec))
+        {
+            dirPaths.emplace_back(iter.path());
+        }
+    }
+
+    std::sort(files.begin(), files.end(), [](const DirectoryModelFile& a_lhs, const DirectoryModelFile& a_rhs)
+    {
+        return a_lhs.Path < a_rhs.Path;
+    });
+    m_nodes[a_index].Files = std::move(files);
+
+    // Keep existing children so indices held by the UI stay valid
+    const std::vector<uint32_t> oldChildren = m_nodes[a_index].Children;
+    std::vector<uint32_t> children;
+    children.reserve(dirPaths.size());
+
+    for (const uint32_t child : oldChildren)
+    {
+        const auto iter = std::find(dirPaths.begin(), dirPaths.end(), m_nodes[child].Path);
+        if (iter == dirPaths.end())
+        {
+            RemoveNode(child);
+
+            continue;
+        }
+
+        children.emplace_back(child);
+        dirPaths.erase(iter);
+    }
+
+    for (const std::filesystem::path& path : dirPaths)
+    {
+        // Can reallocate the node storage so no references can be held across this
+        children.emplace_back(AddNode(a_index, path));
+    }
+
+    std::sort(children.begin(), children.end(), [this](uint32_t a_lhs, uint32_t a_rhs)
+    {
+        return m_nodes[a_lhs].Path < m_nodes[a_rhs].Path;
+    });
+    m_nodes[a_index].Children = std::move(children);
+}
+
+void DirectoryModel::Build(const std::filesystem::path& a_root)
+{
+    Clear();
+
+    m_root = a_root;
+
+    if (std::filesystem::exists(m_root))
+    {
+        AddNode(-1, m_root);
+    }
+
+    ++m_version;
+}
+void DirectoryModel::Clear()
+{
+    m_watcher.Clear();
+
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_lookup.clear();
+    m_changedNodes.clear();
+
+    ++m_version;
+}
+
+bool DirectoryModel::Update()
+{
+    m_changedNodes.clear();
+    m_unknownChange = false;
+
+    std::vector<std::filesystem::path> directories;
+    bool unknown;
+    if (!m_watcher.Poll(&directories, &unknown))
+    {
+        return false;
+    }
+
+    m_unknownChange = unknown;
+
+    if (unknown)
+    {
+        // Watcher could not say where so fall back to checking directory write times
+        // Children get checked by their own entries so only rescan the ones that changed
+        const uint32_t count = (uint32_t)m_nodes.size();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!m_nodes[i].Valid)
+            {
+                continue;
+            }
+
+            std::error_code ec;
+            const std::filesystem::file_time_type time = std::filesystem::last_write_time(m_nodes[i].Path, ec);
+            if (ec || time != m_nodes[i].ModifiedTime)
+            {
+                directories.emplace_back(m_nodes[i].Path);
+            }
+        }
+    }
+
+    for (const std::filesystem::path& path : directories)
+    {
+        const uint32_t index = GetNodeIndex(path);
+        if (index == -1 || !m_nodes[index].Valid)
+        {
+            continue;
+        }
+
+        if (!std::filesystem::exists(path))
+        {
+            const uint32_t parent = m_nodes[index].Parent;
+            if (parent != -1)
+            {
+                ScanNode(parent);
+            }
+            else
+            {
+                RemoveNode(index);
+            }
+
+            continue;
+        }
+
+        ScanNode(index);
+    }
+
+    ++m_version;
+
+    return true;
+}
+
+uint32_t DirectoryModel::GetNodeIndex(const std::filesystem::path& a_path) const
+{
+    const auto iter = m_lookup.find(a_path.string());
+    if (iter == m_lookup.end())
+    {
+        return -1;
+    }
+
+    return iter->second;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
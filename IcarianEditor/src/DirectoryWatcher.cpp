@@ -0,0 +1,228 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "DirectoryWatcher.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "Logger.h"
+
+#ifdef WIN32
+DirectoryWatcher::DirectoryWatcher()
+{
+    m_handle = INVALID_HANDLE_VALUE;
+}
+DirectoryWatcher::~DirectoryWatcher()
+{
+    Clear();
+}
+
+void DirectoryWatcher::Watch(const std::filesystem::path& a_path)
+{
+    // First path is the root and is watched recursively so the rest come for free
+    if (m_handle != INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    m_handle = FindFirstChangeNotificationW(a_path.c_str(), TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE);
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+        Logger::Warning("Failed to watch directory: " + a_path.string());
+    }
+}
+void DirectoryWatcher::Unwatch(const std::filesystem::path& a_path)
+{
+
+}
+void DirectoryWatcher::Clear()
+{
+    if (m_handle != INVALID_HANDLE_VALUE)
+    {
+        FindCloseChangeNotification(m_handle);
+
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+}
+
+bool DirectoryWatcher::Poll(std::vector<std::filesystem::path>* a_directories, bool* a_unknown)
+{
+    *a_unknown = false;
+
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    bool changed = false;
+    while (WaitForSingleObject(m_handle, 0) == WAIT_OBJECT_0)
+    {
+        changed = true;
+
+        if (!FindNextChangeNotification(m_handle))
+        {
+            break;
+        }
+    }
+
+    *a_unknown = changed;
+
+    return changed;
+}
+#else
+DirectoryWatcher::DirectoryWatcher()
+{
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0)
+    {
+        Logger::Warning("Failed to create directory watcher");
+    }
+}
+DirectoryWatcher::~DirectoryWatcher()
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+    }
+}
+
+void DirectoryWatcher::Watch(const std::filesystem::path& a_path)
+{
+    if (m_fd < 0)
+    {
+        return;
+    }
+
+    const std::string path = a_path.string();
+    if (m_paths.find(path) != m_paths.end())
+    {
+        return;
+    }
+
+    const int wd = inotify_add_watch(m_fd, path.c_str(), IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+    if (wd < 0)
+    {
+        Logger::Warning("Failed to watch directory: " + path);
+
+        return;
+    }
+
+    m_watches[wd] = path;
+    m_paths[path] = wd;
+}
+void DirectoryWatcher::Unwatch(const std::filesystem::path& a_path)
+{
+    const auto iter = m_paths.find(a_path.string());
+    if (iter == m_paths.end())
+    {
+        return;
+    }
+
+    inotify_rm_watch(m_fd, iter->second);
+
+    m_watches.erase(iter->second);
+    m_paths.erase(iter);
+}
+void DirectoryWatcher::Clear()
+{
+    for (const auto& iter : m_watches)
+    {
+        inotify_rm_watch(m_fd, iter.first);
+    }
+
+    m_watches.clear();
+    m_paths.clear();
+}
+
+bool DirectoryWatcher::Poll(std::vector<std::filesystem::path>* a_directories, bool* a_unknown)
+{
+    *a_unknown = false;
+
+    if (m_fd < 0)
+    {
+        return false;
+    }
+
+    bool changed = false;
+
+    alignas(inotify_event) char buffer[4096];
+    while (true)
+    {
+        const ssize_t len = read(m_fd, buffer, sizeof(buffer));
+        if (len <= 0)
+        {
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < len;)
+        {
+            const inotify_event* event = (const inotify_event*)(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            changed = true;
+
+            // Dropped events so have no idea what happened
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                *a_unknown = true;
+
+                continue;
+            }
+
+            const auto iter = m_watches.find(event->wd);
+            if (iter == m_watches.end())
+            {
+                continue;
+            }
+
+            const std::filesystem::path path = iter->second;
+
+            // Kernel has already dropped the watch
+            if (event->mask & IN_IGNORED)
+            {
+                m_paths.erase(iter->second);
+                m_watches.erase(iter);
+            }
+
+            // The directory itself went away so the parent is what needs updating
+            const std::filesystem::path dir = (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) ? path.parent_path() : path;
+            if (std::find(a_directories->begin(), a_directories->end(), dir) == a_directories->end())
+            {
+                a_directories->emplace_back(dir);
+            }
+        }
+    }
+
+    return changed;
+}
+#endif
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -107,6 +107,12 @@ void EditorConfig::Deserialize()
 
                         break;
                     }
+                    case StringHash("BackgroundFrameRate"):
+                    {
+                        Instance->m_backgroundFrameRate = element->UnsignedText();
+
+                        break;
+                    }
                     case StringHash("CodeEditor"):
                     {
                         const char* codeEditor = element->GetText();
@@ -154,6 +160,21 @@ void EditorConfig::Deserialize()
 
                         break;
                     }
+                    case StringHash("TextureQuality"):
+                    {
+                        const char* textureQuality = element->GetText();
+                        for (uint32_t i = 0; i < TextureQuality_End; ++i)
+                        {
+                            if (strcmp(textureQuality, TextureCompressor::GetQualityName((e_TextureQuality)i)) == 0)
+                            {
+                                Instance->m_textureQuality = (e_TextureQuality)i;
+
+                                break;
+                            }
+                        }
+
+                        break;
+                    }
                     default:
                     {
                         for (uint32_t i = KeyBindTarget_Start; i < KeyBindTarget_End; ++i)
@@ -213,6 +234,10 @@ void EditorConfig::Serialize()
     editorMouseSensitivity->SetText(Instance->m_editorMouseSensitivity);
     root->InsertEndChild(editorMouseSensitivity);
 
+    tinyxml2::XMLElement* backgroundFrameRate = doc.NewElement("BackgroundFrameRate");
+    backgroundFrameRate->SetText(Instance->m_backgroundFrameRate);
+    root->InsertEndChild(backgroundFrameRate);
+
     tinyxml2::XMLElement* codeEditor = doc.NewElement("CodeEditor");
     switch (Instance->m_codeEditor)
     {
@@ -255,6 +280,10 @@ void EditorConfig::Serialize()
     }
     root->InsertEndChild(defEditor);
 
+    tinyxml2::XMLElement* textureQuality = doc.NewElement("TextureQuality");
+    textureQuality->SetText(TextureCompressor::GetQualityName(Instance->m_textureQuality));
+    root->InsertEndChild(textureQuality);
+
     for (uint32_t i = KeyBindTarget_Start; i < KeyBindTarget_End; ++i)
     {
         const std::string keyBindName = std::string(KeyBindNames[i]) + "Key";
@@ -304,6 +333,15 @@ void EditorConfig::SetEditorMouseSensitivity(float a_editorMouseSensitivity)
     Instance->m_editorMouseSensitivity = a_editorMouseSensitivity;
 }
 
+uint32_t EditorConfig::GetBackgroundFrameRate()
+{
+    return Instance->m_backgroundFrameRate;
+}
+void EditorConfig::SetBackgroundFrameRate(uint32_t a_backgroundFrameRate)
+{
+    Instance->m_backgroundFrameRate = a_backgroundFrameRate;
+}
+
 glm::vec4 EditorConfig::GetBackgroundColor()
 {
     return Instance->m_backgroundColor;
@@ -331,6 +369,15 @@ void EditorConfig::SetDefEditor(e_DefEditor a_defEditor)
     Instance->m_defEditor = a_defEditor;
 }
 
+e_TextureQuality EditorConfig::GetTextureQuality()
+{
+    return Instance->m_textureQuality;
+}
+void EditorConfig::SetTextureQuality(e_TextureQuality a_textureQuality)
+{
+    Instance->m_textureQuality = a_textureQuality;
+}
+
 ImGuiKey EditorConfig::GetKeyBind(e_KeyBindTarget a_keyBind)
 {
     return Instance->m_keyBinds[a_keyBind];
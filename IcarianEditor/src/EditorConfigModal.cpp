@@ -86,6 +86,14 @@ void EditorConfigModal::GeneralTab()
     {
         EditorConfig::SetEditorMouseSensitivity(editorMouseSensitivity);
     }
+
+    // Cap for when the editor is not focused, 0 is uncapped
+    ImGui::SetNextItemWidth(ItemWidth);
+    int backgroundFrameRate = (int)EditorConfig::GetBackgroundFrameRate();
+    if (ImGui::DragInt("Background Frame Rate", &backgroundFrameRate, 1.0f, 0, 240))
+    {
+        EditorConfig::SetBackgroundFrameRate((uint32_t)glm::max(backgroundFrameRate, 0));
+    }
     
     ImGui::SetNextItemWidth(ItemWidth);
     glm::vec4 backgroundColor = EditorConfig::GetBackgroundColor();
@@ -93,6 +101,30 @@ void EditorConfigModal::GeneralTab()
     {
         EditorConfig::SetBackgroundColor(backgroundColor);
     }
+
+    // Only applies to textures loaded after the change
+    const e_TextureQuality textureQuality = EditorConfig::GetTextureQuality();
+
+    ImGui::SetNextItemWidth(ItemWidth);
+    if (ImGui::BeginCombo("Texture Quality", TextureCompressor::GetQualityName(textureQuality)))
+    {
+        IDEFER(ImGui::EndCombo());
+
+        for (uint32_t i = 0; i < TextureQuality_End; ++i)
+        {
+            const bool selected = textureQuality == i;
+
+            if (ImGui::Selectable(TextureCompressor::GetQualityName((e_TextureQuality)i), selected))
+            {
+                EditorConfig::SetTextureQuality((e_TextureQuality)i);
+            }
+
+            if (selected)
+            {
+                ImGui::SetItemDefaultFocus();
+            }
+        }
+    }
 }
 
 void EditorConfigModal::KeyBindingsTab()
@@ -247,7 +279,7 @@ bool EditorConfigModal::Update()
         }
         default:
         {
-            Logger::Error("Invalid EditorConfigTab: %d", m_currentTab);
+            Logger::Error("Invalid EditorConfigTab: " + std::to_string(m_currentTab));
 
             break;
         }
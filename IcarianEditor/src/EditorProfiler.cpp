@@ -0,0 +1,370 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "EditorProfiler.h"
+
+#ifndef ICARIANEDITOR_DISABLE_PROFILER
+
+#include <cstring>
+
+EditorProfiler* EditorProfiler::Instance = nullptr;
+
+static void SetProfileName(char* a_dst, const char* a_name)
+{
+    // Names get used as C strings elsewhere so always leave room for the terminator
+    strncpy(a_dst, a_name, ProfileNameMax - 1);
+    a_dst[ProfileNameMax - 1] = 0;
+}
+static bool IsProfileName(const char* a_lhs, const char* a_rhs)
+{
+    return strncmp(a_lhs, a_rhs, ProfileNameMax - 1) == 0;
+}
+
+EditorProfiler::EditorProfiler()
+{
+    m_mainThread = std::this_thread::get_id();
+
+    m_frameActive = false;
+
+    memset(&m_cpuScope, 0, sizeof(m_cpuScope));
+    SetProfileName(m_cpuScope.Name, CPUSnapshotName);
+    m_cpuDepth = 0;
+
+    memset(&m_counterScope, 0, sizeof(m_counterScope));
+    SetProfileName(m_counterScope.Name, CounterSnapshotName);
+
+    for (uint32_t i = 0; i < GPUFrameLatency; ++i)
+    {
+        GPUFrame& frame = m_gpuFrames[i];
+
+        memset(&frame.Scope, 0, sizeof(frame.Scope));
+        SetProfileName(frame.Scope.Name, GPUSnapshotName);
+
+        glGenQueries(ProfileFrameMax * 2, frame.Queries);
+        frame.Pending = false;
+    }
+
+    m_gpuFrameIndex = 0;
+    m_gpuDepth = 0;
+}
+EditorProfiler::~EditorProfiler()
+{
+    for (uint32_t i = 0; i < GPUFrameLatency; ++i)
+    {
+        glDeleteQueries(ProfileFrameMax * 2, m_gpuFrames[i].Queries);
+    }
+}
+
+void EditorProfiler::Init()
+{
+    if (Instance == nullptr)
+    {
+        Instance = new EditorProfiler();
+    }
+}
+void EditorProfiler::Destroy()
+{
+    if (Instance != nullptr)
+    {
+        delete Instance;
+        Instance = nullptr;
+    }
+}
+
+bool EditorProfiler::IsProfileThread()
+{
+    return Instance != nullptr && std::this_thread::get_id() == Instance->m_mainThread;
+}
+
+void EditorProfiler::ResolveGPUFrame(GPUFrame* a_frame)
+{
+    if (!a_frame->Pending)
+    {
+        return;
+    }
+
+    // The root scope is the last to end so if it is ready everything else is as well
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(a_frame->Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE)
+    {
+        return;
+    }
+
+    a_frame->Pending = false;
+
+    for (uint16_t i = 0; i < a_frame->Scope.FrameCount; ++i)
+    {
+        GLuint64 start;
+        GLuint64 end;
+        glGetQueryObjectui64v(a_frame->Queries[i * 2 + 0], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(a_frame->Queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+
+        a_frame->Scope.Frames[i].Time = (float)((end - start) / 1000000.0);
+    }
+
+    ProfilerData::PushData(a_frame->Scope);
+}
+
+void EditorProfiler::BeginFrame()
+{
+    if (!IsProfileThread())
+    {
+        return;
+    }
+
+    Instance->m_frameActive = true;
+
+    Instance->m_cpuScope.FrameCount = 0;
+    Instance->m_cpuDepth = 0;
+
+    Instance->m_gpuDepth = 0;
+
+    GPUFrame& gpuFrame = Instance->m_gpuFrames[Instance->m_gpuFrameIndex];
+    // Results are still not back after several frames so drop them rather then block on the driver
+    Instance->ResolveGPUFrame(&gpuFrame);
+    gpuFrame.Pending = false;
+    gpuFrame.Scope.FrameCount = 0;
+
+    for (uint16_t i = 0; i < Instance->m_counterScope.FrameCount; ++i)
+    {
+        Instance->m_counterScope.Frames[i].Time = 0.0f;
+    }
+
+    // Root scopes have to be added by hand as there is no parent to attach them to
+    ProfileFrame& cpuRoot = Instance->m_cpuScope.Frames[0];
+    SetProfileName(cpuRoot.Name, "Frame");
+    cpuRoot.Time = 0.0f;
+    cpuRoot.Stack = 1;
+    Instance->m_cpuScope.FrameCount = 1;
+    Instance->m_cpuStack[Instance->m_cpuDepth++] = 0;
+    Instance->m_cpuStart[0] = std::chrono::high_resolution_clock::now();
+
+    ProfileFrame& gpuRoot = gpuFrame.Scope.Frames[0];
+    SetProfileName(gpuRoot.Name, "Frame");
+    gpuRoot.Time = 0.0f;
+    gpuRoot.Stack = 1;
+    gpuFrame.Scope.FrameCount = 1;
+    Instance->m_gpuStack[Instance->m_gpuDepth++] = 0;
+    glQueryCounter(gpuFrame.Queries[0], GL_TIMESTAMP);
+}
+void EditorProfiler::EndFrame()
+{
+    if (!IsProfileThread() || !Instance->m_frameActive)
+    {
+        return;
+    }
+
+    while (Instance->m_cpuDepth > 0)
+    {
+        EndScope(Instance->m_cpuStack[Instance->m_cpuDepth - 1]);
+    }
+    while (Instance->m_gpuDepth > 0)
+    {
+        EndGPUScope(Instance->m_gpuStack[Instance->m_gpuDepth - 1]);
+    }
+
+    Instance->m_frameActive = false;
+
+    ProfilerData::PushData(Instance->m_cpuScope);
+
+    if (Instance->m_counterScope.FrameCount > 0)
+    {
+        ProfilerData::PushData(Instance->m_counterScope, ProfileUnit_Count);
+    }
+
+    Instance->m_gpuFrames[Instance->m_gpuFrameIndex].Pending = true;
+    Instance->m_gpuFrameIndex = (Instance->m_gpuFrameIndex + 1) % GPUFrameLatency;
+
+    for (uint32_t i = 0; i < GPUFrameLatency; ++i)
+    {
+        Instance->ResolveGPUFrame(&Instance->m_gpuFrames[(Instance->m_gpuFrameIndex + i) % GPUFrameLatency]);
+    }
+}
+
+uint16_t EditorProfiler::BeginScope(const char* a_name)
+{
+    if (!IsProfileThread() || !Instance->m_frameActive || Instance->m_cpuDepth <= 0)
+    {
+        return ProfileNoParent;
+    }
+
+    ProfileScope& scope = Instance->m_cpuScope;
+
+    const uint16_t parent = Instance->m_cpuStack[Instance->m_cpuDepth - 1];
+    const uint8_t stack = scope.Frames[parent].Stack + 1;
+
+    // Repeated scopes under the same parent are merged so the layout stays stable between frames
+    // Otherwise scopes in loops would quickly run out of frames
+    uint16_t index = parent + 1;
+    bool found = false;
+    for (; index < scope.FrameCount; ++index)
+    {
+        const ProfileFrame& frame = scope.Frames[index];
+        if (frame.Stack < stack)
+        {
+            break;
+        }
+
+        if (frame.Stack == stack && IsProfileName(frame.Name, a_name))
+        {
+            found = true;
+
+            break;
+        }
+    }
+
+    if (!found)
+    {
+        if (scope.FrameCount >= ProfileFrameMax)
+        {
+            return ProfileNoParent;
+        }
+
+        // Inserted at the end of the parent so frames stay depth first
+        // Only open scopes are tracked by index and they are all before this point so nothing needs fixing up
+        memmove(scope.Frames + index + 1, scope.Frames + index, (scope.FrameCount - index) * sizeof(ProfileFrame));
+        ++scope.FrameCount;
+
+        ProfileFrame& frame = scope.Frames[index];
+        SetProfileName(frame.Name, a_name);
+        frame.Time = 0.0f;
+        frame.Stack = stack;
+    }
+
+    Instance->m_cpuStack[Instance->m_cpuDepth++] = index;
+    Instance->m_cpuStart[index] = std::chrono::high_resolution_clock::now();
+
+    return index;
+}
+void EditorProfiler::EndScope(uint16_t a_index)
+{
+    if (a_index == ProfileNoParent || !IsProfileThread() || Instance->m_cpuDepth <= 0)
+    {
+        return;
+    }
+
+    const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    Instance->m_cpuScope.Frames[a_index].Time += std::chrono::duration<float, std::milli>(end - Instance->m_cpuStart[a_index]).count();
+
+    --Instance->m_cpuDepth;
+}
+
+uint16_t EditorProfiler::BeginGPUScope(const char* a_name)
+{
+    if (!IsProfileThread() || !Instance->m_frameActive || Instance->m_gpuDepth <= 0)
+    {
+        return ProfileNoParent;
+    }
+
+    GPUFrame& gpuFrame = Instance->m_gpuFrames[Instance->m_gpuFrameIndex];
+    ProfileScope& scope = gpuFrame.Scope;
+
+    if (scope.FrameCount >= ProfileFrameMax)
+    {
+        return ProfileNoParent;
+    }
+
+    const uint16_t parent = Instance->m_gpuStack[Instance->m_gpuDepth - 1];
+    const uint16_t index = scope.FrameCount++;
+
+    ProfileFrame& frame = scope.Frames[index];
+    SetProfileName(frame.Name, a_name);
+    frame.Time = 0.0f;
+    frame.Stack = scope.Frames[parent].Stack + 1;
+
+    Instance->m_gpuStack[Instance->m_gpuDepth++] = index;
+    glQueryCounter(gpuFrame.Queries[index * 2 + 0], GL_TIMESTAMP);
+
+    return index;
+}
+void EditorProfiler::EndGPUScope(uint16_t a_index)
+{
+    if (a_index == ProfileNoParent || !IsProfileThread() || Instance->m_gpuDepth <= 0)
+    {
+        return;
+    }
+
+    GPUFrame& gpuFrame = Instance->m_gpuFrames[Instance->m_gpuFrameIndex];
+    glQueryCounter(gpuFrame.Queries[a_index * 2 + 1], GL_TIMESTAMP);
+
+    --Instance->m_gpuDepth;
+}
+
+uint16_t EditorProfiler::GetCounterIndex(const char* a_name)
+{
+    for (uint16_t i = 0; i < m_counterScope.FrameCount; ++i)
+    {
+        if (IsProfileName(m_counterScope.Frames[i].Name, a_name))
+        {
+            return i;
+        }
+    }
+
+    if (m_counterScope.FrameCount >= ProfileFrameMax)
+    {
+        return ProfileNoParent;
+    }
+
+    const uint16_t index = m_counterScope.FrameCount++;
+
+    ProfileFrame& frame = m_counterScope.Frames[index];
+    SetProfileName(frame.Name, a_name);
+    frame.Time = 0.0f;
+    frame.Stack = 1;
+
+    return index;
+}
+
+void EditorProfiler::SetCounter(const char* a_name, float a_value)
+{
+    if (!IsProfileThread())
+    {
+        return;
+    }
+
+    const uint16_t index = Instance->GetCounterIndex(a_name);
+    if (index != ProfileNoParent)
+    {
+        Instance->m_counterScope.Frames[index].Time = a_value;
+    }
+}
+void EditorProfiler::AddCounter(const char* a_name, float a_value)
+{
+    if (!IsProfileThread())
+    {
+        return;
+    }
+
+    const uint16_t index = Instance->GetCounterIndex(a_name);
+    if (index != ProfileNoParent)
+    {
+        Instance->m_counterScope.Frames[index].Time += a_value;
+    }
+}
+
+#endif
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Core/IcarianDefer.h"
 #include "EditorConfig.h"
 #include "EditorInputManager.h"
+#include "EditorProfiler.h"
 #include "FlareImGui.h"
 #include "Gizmos.h"
 #include "PixelShader.h"
@@ -103,6 +104,9 @@ EditorWindow::~EditorWindow()
 
 void EditorWindow::Draw()
 {
+    EDITOR_PROFILE_SCOPE("EditorDraw");
+    EDITOR_PROFILE_GPU_SCOPE("EditorDraw");
+
     m_refresh = false;
 
     ImGuizmo::SetDrawlist();
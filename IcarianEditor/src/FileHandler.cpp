@@ -4,24 +4,18 @@
 
 #include "FileHandler.h"
 
-#include <ktx.h>
-#include <stb_image.h>
-
 #include "AssetLibrary.h"
 #include "Datastore.h"
 #include "EditorConfig.h"
 #include "IO.h"
-#include "Runtime/RuntimeManager.h"
+#include "Project.h"
 #include "Runtime/RuntimeStorage.h"
 #include "Texture.h"
+#include "ThumbnailService.h"
 #include "Workspace.h"
 
-#include "EditorFileHandlerInterop.h"
-
 FileHandler* Instance = nullptr;
 
-FILEHANDLER_EXPORT_TABLE(RUNTIME_FUNCTION_DEFINITION);
-
 static void OpenCSScript(const std::filesystem::path& a_path, const std::filesystem::path& a_relativePath, uint32_t a_size, const uint8_t* a_data)
 {
     const e_CodeEditor codeEditor = EditorConfig::GetCodeEditor();
@@ -118,11 +112,14 @@ static void PushDef(Workspace* a_workspace, const std::filesystem::path& a_path,
     ImGui::SetDragDropPayload("DefPath", str.c_str(), str.size(), ImGuiCond_Once);
 }
 
-FileHandler::FileHandler(AssetLibrary* a_assets, RuntimeStorage* a_storage, Workspace* a_workspace)
+FileHandler::FileHandler(AssetLibrary* a_assets, RuntimeStorage* a_storage, Project* a_project, Workspace* a_workspace)
 {
     m_assets = a_assets;
 
     m_storage = a_storage;
+    m_project = a_project;
+
+    m_thumbnails = new ThumbnailService();
 
     m_extTex.emplace(".cs", Datastore::GetTexture("Textures/FileIcons/FileIcon_CSharpScript.png"));
     m_extTex.emplace(".def", Datastore::GetTexture("Textures/FileIcons/FileIcon_Def.png"));
@@ -143,19 +140,17 @@ FileHandler::FileHandler(AssetLibrary* a_assets, RuntimeStorage* a_storage, Work
     m_extOpenCallback.emplace(".ffrag", FileCallback(std::bind(OpenShader, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4)));
 
     m_extDragCallback.emplace(".def", FileCallback(std::bind(PushDef, a_workspace, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3, std::placeholders::_4)));
-
-    FILEHANDLER_EXPORT_TABLE(RUNTIME_FUNCTION_ATTACH);
 }
 FileHandler::~FileHandler()
 {
-    
+    delete m_thumbnails;
 }
 
-void FileHandler::Init(AssetLibrary* a_assets, RuntimeStorage* a_storage, Workspace* a_workspace)
+void FileHandler::Init(AssetLibrary* a_assets, RuntimeStorage* a_storage, Project* a_project, Workspace* a_workspace)
 {
     if (Instance == nullptr)
     {
-        Instance = new FileHandler(a_assets, a_storage, a_workspace);
+        Instance = new FileHandler(a_assets, a_storage, a_project, a_workspace);
     }
 }
 void FileHandler::Destroy()
@@ -167,16 +162,31 @@ void FileHandler::Destroy()
     }
 }
 
-void FileHandler::SetFileHandle(const FileTextureHandle& a_handle)
+void FileHandler::Update()
+{
+    Instance->m_thumbnails->Update();
+}
+void FileHandler::Clear()
+{
+    Instance->m_thumbnails->Clear();
+}
+
+void FileHandler::InvalidateFile(const std::filesystem::path& a_path)
+{
+    Instance->m_thumbnails->Invalidate(a_path);
+}
+void FileHandler::InvalidateFiles()
 {
-    Instance->m_runtimeTexHandle = a_handle;
+    Instance->m_thumbnails->InvalidateAll();
 }
 
-void FileHandler::GetFileData(const std::filesystem::path& a_path, FileCallback** a_openCallback, FileCallback** a_dragCallback, GLuint* a_texture)
+void FileHandler::GetFileData(const std::filesystem::path& a_path, FileCallback** a_openCallback, FileCallback** a_dragCallback, GLuint* a_texture, glm::vec2* a_uv0, glm::vec2* a_uv1)
 {
     const Texture* unknownTex = Datastore::GetTexture("Textures/FileIcons/FileIcon_Unknown.png");
 
     *a_texture = unknownTex->GetHandle();
+    *a_uv0 = glm::vec2(0.0f);
+    *a_uv1 = glm::vec2(1.0f);
     *a_openCallback = nullptr;
     *a_dragCallback = nullptr;
 
@@ -187,48 +197,31 @@ void FileHandler::GetFileData(const std::filesystem::path& a_path, FileCallback*
 
     const std::string ext = a_path.extension().string();
 
-    const e_AssetType type = Instance->m_assets->GetAssetType(a_path);
-    switch (type) 
-    {
-    case AssetType_Texture:
+    const auto tIter = Instance->m_extTex.find(ext);
+    if (tIter != Instance->m_extTex.end())
     {
-        if (!RuntimeManager::IsBuilt())
-        {
-            break;
-        }
-
-        MonoDomain* domain = RuntimeManager::GetEditorDomain();
-
-        const std::string pathString = a_path.u8string();
-        MonoString* str = mono_string_new(domain, pathString.c_str());
-
-        void* args[] =
+        if (tIter->second != nullptr)
         {
-            str
-        };
+            const Texture* tex = tIter->second;
 
-        RuntimeManager::ExecFunction("IcarianEditor", "FileHandler", ":GetFileHandle(string)", args);
+            *a_texture = tex->GetHandle();
+        }
+    }
 
-        const FileTextureHandle& handle = Instance->m_runtimeTexHandle;
+    // Previews come from the thumbnail atlas instead of going through the runtime
+    // Stays on the fallback icon until the worker has finished with it
+    const e_AssetType type = AssetLibrary::GetAssetTypeFromExtension(ext);
+    switch (type)
+    {
+    case AssetType_Texture:
+    {
+        Instance->m_thumbnails->GetThumbnail(a_path, Instance->m_project->GetCachePath(), ThumbnailType_Texture, a_texture, a_uv0, a_uv1);
 
-        if (handle.Addr != -1)
-        {
-            switch (handle.Mode)
-            {
-            case FileTextureMode_Texture:
-            {
-                const Texture* tex = Instance->m_storage->GetTexture(handle.Addr);
-
-                *a_texture = tex->GetHandle();
-
-                break;
-            }
-            default:
-            {
-                break;
-            }
-            }
-        }
+        break;
+    }
+    case AssetType_Model:
+    {
+        Instance->m_thumbnails->GetThumbnail(a_path, Instance->m_project->GetCachePath(), ThumbnailType_Model, a_texture, a_uv0, a_uv1);
 
         break;
     }
@@ -238,17 +231,6 @@ void FileHandler::GetFileData(const std::filesystem::path& a_path, FileCallback*
     }
     }
 
-    const auto tIter = Instance->m_extTex.find(ext);
-    if (tIter != Instance->m_extTex.end())
-    {
-        if (tIter->second != nullptr)
-        {
-            const Texture* tex = tIter->second;
-
-            *a_texture = tex->GetHandle();
-        }
-    }
-
     const auto oIter = Instance->m_extOpenCallback.find(ext);
     if (oIter != Instance->m_extOpenCallback.end())
     {
@@ -139,6 +139,10 @@ namespace FlareImGui
     }
 
     bool ImageButton(const char* a_label, GLuint a_texture, const glm::vec2& a_size, bool a_background)
+    {
+        return ImageButton(a_label, a_texture, a_size, glm::vec2(0.0f), glm::vec2(1.0f), a_background);
+    }
+    bool ImageButton(const char* a_label, GLuint a_texture, const glm::vec2& a_size, const glm::vec2& a_uv0, const glm::vec2& a_uv1, bool a_background)
     {
         if (!a_background)
         {
@@ -155,7 +159,7 @@ namespace FlareImGui
 
         if (a_texture != -1)
         {
-            ret = ImGui::ImageButton(a_label, (ImTextureID)(uintptr_t)a_texture, { a_size.x, a_size.y });
+            ret = ImGui::ImageButton(a_label, (ImTextureID)(uintptr_t)a_texture, { a_size.x, a_size.y }, { a_uv0.x, a_uv0.y }, { a_uv1.x, a_uv1.y });
         }
 
         return ret;
@@ -4,13 +4,17 @@
 
 #include "GUI.h"
 
+#include <algorithm>
 #include <glm/glm.hpp>
 #include <string>
 
 #include "AppMain.h"
 #include "Core/IcarianDefer.h"
 #include "Datastore.h"
+#include "EditorGUIInteropStructures.h"
+#include "EditorProfiler.h"
 #include "FlareImGui.h"
+#include "Logger.h"
 #include "Modals/GetAssetModal.h"
 #include "Runtime/RuntimeManager.h"
 #include "Texture.h"
@@ -18,16 +22,43 @@
 static GUI* Instance = nullptr;
 
 static constexpr uint32_t BufferSize = 4096;
+static constexpr uint32_t ScratchBlockSize = 1 << 16;
+
+static constexpr uint32_t FNVPrime = 16777619U;
+
+// Argument count for each GUICommand, does not include the opcode
+static constexpr uint32_t CommandArgCount[GUICommand_Last] = 
+{
+    2, // Label
+    0, // SameLine
+    0, // Separator
+    0, // Indent
+    0, // Unindent
+    2, // PushID
+    0, // PopID
+    3, // Button
+    4, // Selectable
+    4, // TreeNode
+    0, // TreePop
+    4, // BeginTable
+    0, // TableNextRow
+    0, // TableNextColumn
+    0  // EndTable
+};
+
+// Calls coming in from C# and commands played back from buffers, reported and reset every frame
+static uint32_t NativeCalls = 0;
+static uint32_t BufferedCommands = 0;
 
 // TODO: This is a mess in this file and need to be cleaned up and redone
 // I am not happy with the current state of the file
 struct IDStack
 {
-    IDStack(const std::string_view& a_id)
+    IDStack(uint32_t a_id)
     {
         Instance->PushID(a_id);
 
-        ImGui::PushID(a_id.data());
+        ImGui::PushID((int)a_id);
     }
     ~IDStack()
     {
@@ -37,26 +68,43 @@ struct IDStack
     }
 };
 
-#define STACK_ID(str) const IDStack idStackTVal = IDStack(str)
-#define STACK_G_ID(str) STACK_ID(Instance->GetID() + (str))
+// Labels are hashed straight off the managed string seeded by the ID stack so nothing gets built to push an ID
+static uint32_t GetLabelID(MonoString* a_str)
+{
+    return GUI::HashID((const uint16_t*)mono_string_chars(a_str), (uint32_t)mono_string_length(a_str), Instance->GetID());
+}
+// Null strings stay null as a few bindings use them for optional text
+static const char* ToScratchString(MonoString* a_str)
+{
+    if (a_str == NULL)
+    {
+        return nullptr;
+    }
+
+    return Instance->ToScratchUTF8((const uint16_t*)mono_string_chars(a_str), (uint32_t)mono_string_length(a_str));
+}
+
+// Every binding counts itself so the managed to native transitions per frame show up in the profiler
+#define GUI_FUNCTION(ret, name, code, ...) RUNTIME_FUNCTION(ret, GUI, name, { ++NativeCalls; code }, __VA_ARGS__)
+
+#define STACK_ID(id) const IDStack idStackTVal = IDStack(id)
+#define STACK_G_ID(str) STACK_ID(GetLabelID(str))
+#define STACK_I_ID(index) STACK_ID(GUI::HashID((uint32_t)(index), Instance->GetID()))
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetButton, 
+GUI_FUNCTION(uint32_t, GetButton, 
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     return (uint32_t)ImGui::Button(str);
 }, MonoString* a_str)
-RUNTIME_FUNCTION(uint32_t, GUI, GetToggleButton, 
+GUI_FUNCTION(uint32_t, GetToggleButton, 
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
     if (*a_state)
     {
-        char* enabledStr = mono_string_to_utf8(a_enabledPath);
-        IDEFER(mono_free(enabledStr));
+        const char* enabledStr = ToScratchString(a_enabledPath);
 
         if (FlareImGui::ImageButton(str, enabledStr, a_size, (bool)a_background))
         {
@@ -67,8 +115,7 @@ RUNTIME_FUNCTION(uint32_t, GUI, GetToggleButton,
     }
     else
     {
-        char* disabledStr = mono_string_to_utf8(a_disabledPath);
-        IDEFER(mono_free(disabledStr));
+        const char* disabledStr = ToScratchString(a_disabledPath);
 
         if (FlareImGui::ImageButton(str, disabledStr, a_size, (bool)a_background))
         {
@@ -82,18 +129,17 @@ RUNTIME_FUNCTION(uint32_t, GUI, GetToggleButton,
     
 }, MonoString* a_str, MonoString* a_enabledPath, MonoString* a_disabledPath, uint32_t* a_state, glm::vec2 a_size, uint32_t a_background)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetCheckbox, 
+// The label is already part of the ID scope so the hidden value labels do not need it
+GUI_FUNCTION(uint32_t, GetCheckbox, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
     bool b = (bool)*a_value;
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    if (ImGui::Checkbox(("##V_" + str).c_str(), &b))
+    if (ImGui::Checkbox("##V", &b))
     {
         *a_value = (uint32_t)b;
 
@@ -108,15 +154,10 @@ static MonoString* M_GUI_GetDef(MonoString* a_str, MonoString* a_preview, uint32
 {
     *a_dispatchModal = 0;
 
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
+    const char* str = ToScratchString(a_str);
+    const char* preview = ToScratchString(a_preview);
 
-    char* preview = mono_string_to_utf8(a_preview);
-    IDEFER(mono_free(preview));
-
-    const std::string str = mStr;
-
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
 
     FlareImGui::Label(str);
 
@@ -138,71 +179,61 @@ static MonoString* M_GUI_GetDef(MonoString* a_str, MonoString* a_preview, uint32
 
     return NULL;
 }
-RUNTIME_FUNCTION(MonoString*, GUI, GetDef,
+GUI_FUNCTION(MonoString*, GetDef,
 {
     return M_GUI_GetDef(a_str, a_preview, a_dispatchModal);
 }, MonoString* a_str, MonoString* a_preview, uint32_t* a_dispatchModal)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetInt,
+GUI_FUNCTION(uint32_t, GetInt,
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
     
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::InputInt(("##V_" + str).c_str(), (int*)a_value);
+    return (uint32_t)ImGui::InputInt("##V", (int*)a_value);
 }, MonoString* a_str, int32_t* a_value)
-RUNTIME_FUNCTION(uint32_t, GUI, GetIntSlider, 
+GUI_FUNCTION(uint32_t, GetIntSlider, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::SliderInt(("##V_" + str).c_str(), (int*)a_value, (int)a_min, (int)a_max);
+    return (uint32_t)ImGui::SliderInt("##V", (int*)a_value, (int)a_min, (int)a_max);
 }, MonoString* a_str, int32_t* a_value, int32_t a_min, int32_t a_max)
-RUNTIME_FUNCTION(uint32_t, GUI, GetUInt, 
+GUI_FUNCTION(uint32_t, GetUInt, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::InputInt(("##V_" + str).c_str(), (int*)a_value);
+    return (uint32_t)ImGui::InputInt("##V", (int*)a_value);
 }, MonoString* a_str, uint32_t* a_value)
-RUNTIME_FUNCTION(uint32_t, GUI, GetUIntSlider, 
+GUI_FUNCTION(uint32_t, GetUIntSlider, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::SliderInt(("##V_" + str).c_str(), (int*)a_value, (int)a_min, (int)a_max);
+    return (uint32_t)ImGui::SliderInt("##V", (int*)a_value, (int)a_min, (int)a_max);
 }, MonoString* a_str, uint32_t* a_value, uint32_t a_min, uint32_t a_max)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetBitField, 
+GUI_FUNCTION(uint32_t, GetBitField, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
-    ImGui::Text("%s", str.c_str());
+    STACK_G_ID(a_str);
+    ImGui::Text("%s", str);
 
     ImGuiStyle& style = ImGui::GetStyle();
 
     bool ret = false;
     for (uint32_t i = 0; i < a_bitCount; ++i)
     {
-        STACK_G_ID(str + "[" + std::to_string(i) + "]");
+        STACK_I_ID(i);
 
         if (i % 8 != 0)
         {
@@ -220,7 +251,7 @@ RUNTIME_FUNCTION(uint32_t, GUI, GetBitField,
         }
         IDEFER(ImGui::PopStyleColor());
 
-        if (ImGui::Button(("##V_" + str + "[" + std::to_string(i) + "]").c_str(), { 16.0f, 16.0f }))
+        if (ImGui::Button("##V", { 16.0f, 16.0f }))
         {
             if (selected)
             {
@@ -238,121 +269,104 @@ RUNTIME_FUNCTION(uint32_t, GUI, GetBitField,
     return (uint32_t)ret;
 }, MonoString* a_str, uint32_t* a_value, uint32_t a_bitCount)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetFloat, 
+GUI_FUNCTION(uint32_t, GetFloat, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::DragFloat(("##V_" + str).c_str(), a_value);
+    return (uint32_t)ImGui::DragFloat("##V", a_value);
 }, MonoString* a_str, float* a_value)
-RUNTIME_FUNCTION(uint32_t, GUI, GetFloatSlider, 
+GUI_FUNCTION(uint32_t, GetFloatSlider, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::SliderFloat(("##V_" + str).c_str(), a_value, a_min, a_max);
+    return (uint32_t)ImGui::SliderFloat("##V", a_value, a_min, a_max);
 }, MonoString* a_str, float* a_value, float a_min, float a_max)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetVec2, 
+GUI_FUNCTION(uint32_t, GetVec2, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)FlareImGui::DragVec2(("##V_" + str).c_str(), (float*)a_value);
+    return (uint32_t)FlareImGui::DragVec2("##V", (float*)a_value);
 }, MonoString* a_str, glm::vec2* a_value)
-RUNTIME_FUNCTION(uint32_t, GUI, GetVec3, 
+GUI_FUNCTION(uint32_t, GetVec3, 
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)FlareImGui::DragVec3(("##V_" + str).c_str(), (float*)a_value);
+    return (uint32_t)FlareImGui::DragVec3("##V", (float*)a_value);
 }, MonoString* a_str, glm::vec3* a_value)
-RUNTIME_FUNCTION(uint32_t, GUI, GetVec4,
+GUI_FUNCTION(uint32_t, GetVec4,
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)FlareImGui::DragVec4(("##V_" + str).c_str(), (float*)a_value);
+    return (uint32_t)FlareImGui::DragVec4("##V", (float*)a_value);
 }, MonoString* a_str, glm::vec4* a_value)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetColor,
+GUI_FUNCTION(uint32_t, GetColor,
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
     
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    return (uint32_t)ImGui::ColorEdit4(("##V_" + str).c_str(), (float*)a_value);
+    return (uint32_t)ImGui::ColorEdit4("##V", (float*)a_value);
 }, MonoString* a_str, glm::vec4* a_value)
 
 // Workaround for MSVC
 static MonoString* M_GUI_GetString(MonoString* a_str, MonoString* a_value)
 {
-    char buffer[BufferSize];
-
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    char* value = mono_string_to_utf8(a_value);
-    IDEFER(mono_free(value));
+    char buffer[BufferSize] = { 0 };
 
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
+    const char* value = ToScratchString(a_value);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    strncpy(buffer, value, BufferSize - 1);
-    if (ImGui::InputText(("##V_" + str).c_str(), buffer, BufferSize))
+    if (value != nullptr)
+    {
+        strncpy(buffer, value, BufferSize - 1);
+    }
+    if (ImGui::InputText("##V", buffer, BufferSize))
     {
         return mono_string_new(mono_domain_get(), buffer);
     }
 
     return NULL;
 }
-RUNTIME_FUNCTION(MonoString*, GUI, GetString,
+GUI_FUNCTION(MonoString*, GetString,
 {
     return M_GUI_GetString(a_str, a_value);
 }, MonoString* a_str, MonoString* a_value)
 
-RUNTIME_FUNCTION(MonoString*, GUI, GetPathString, 
+GUI_FUNCTION(MonoString*, GetPathString, 
 {
-    char buffer[BufferSize];
-
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-    char* value = mono_string_to_utf8(a_value);
-    IDEFER(mono_free(value));
+    char buffer[BufferSize] = { 0 };
 
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
+    const char* value = ToScratchString(a_value);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
     ImGui::BeginGroup();
     IDEFER(ImGui::EndGroup());
 
-    if (FlareImGui::ImageButton(("##F_" + str).c_str(), "Textures/WindowIcons/WindowIcon_AssetBrowser.png", { 16.0f, 16.0f }, false))
+    if (FlareImGui::ImageButton("##F", "Textures/WindowIcons/WindowIcon_AssetBrowser.png", { 16.0f, 16.0f }, false))
     {
         const uint32_t extensionCount = (uint32_t)mono_array_length(a_extensions);
 
@@ -385,8 +399,11 @@ RUNTIME_FUNCTION(MonoString*, GUI, GetPathString,
 
     ImGui::SameLine();
 
-    strncpy(buffer, value, BufferSize - 1);
-    if (ImGui::InputText(("##V_" + str).c_str(), buffer, BufferSize))
+    if (value != nullptr)
+    {
+        strncpy(buffer, value, BufferSize - 1);
+    }
+    if (ImGui::InputText("##V", buffer, BufferSize))
     {
         return mono_string_new(mono_domain_get(), buffer);
     }
@@ -403,10 +420,7 @@ RUNTIME_FUNCTION(MonoString*, GUI, GetPathString,
 // MSVC workaround
 static uint32_t M_GUI_GetStringList(MonoString* a_str, MonoArray* a_list, int32_t* a_selected)
 {
-    char* mStr = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(mStr));
-
-    const std::string str = mStr;
+    const char* str = ToScratchString(a_str);
 
     const uintptr_t size = mono_array_length(a_list);
     if (*a_selected >= size)
@@ -414,23 +428,21 @@ static uint32_t M_GUI_GetStringList(MonoString* a_str, MonoArray* a_list, int32_
         *a_selected = 0;
     }
 
-    char* selectedStr = mono_string_to_utf8(mono_array_get(a_list, MonoString*, *a_selected));
-    IDEFER(mono_free(selectedStr));
+    const char* selectedStr = ToScratchString(mono_array_get(a_list, MonoString*, *a_selected));
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     FlareImGui::Label(str);
 
-    if (ImGui::BeginCombo(("##V_" + str).c_str(), selectedStr))
+    if (ImGui::BeginCombo("##V", selectedStr))
     {
         IDEFER(ImGui::EndCombo());
         
         static char Buffer[4096] = { 0 };
-        ImGui::InputText(("Search##VS_" + str).c_str(), Buffer, sizeof(Buffer) - 1);
+        ImGui::InputText("Search##VS", Buffer, sizeof(Buffer) - 1);
 
         for (uint32_t i = 0; i < size; ++i)
         {
-            char* selectableStr = mono_string_to_utf8(mono_array_get(a_list, MonoString*, i));
-            IDEFER(mono_free(selectableStr));
+            const char* selectableStr = ToScratchString(mono_array_get(a_list, MonoString*, i));
 
             if (Buffer[0] != 0 && strstr(selectableStr, Buffer) == NULL)
             {
@@ -439,7 +451,7 @@ static uint32_t M_GUI_GetStringList(MonoString* a_str, MonoArray* a_list, int32_
 
             const bool selected = i == *a_selected;
 
-            STACK_G_ID(std::string(str) + "[" + std::to_string(i) + "]");
+            STACK_I_ID(i);
             if (ImGui::Selectable(selectableStr, selected))
             {
                 *a_selected = i;
@@ -456,7 +468,7 @@ static uint32_t M_GUI_GetStringList(MonoString* a_str, MonoArray* a_list, int32_
 
     return 0;
 }
-RUNTIME_FUNCTION(uint32_t, GUI, GetStringList,
+GUI_FUNCTION(uint32_t, GetStringList,
 {
     return M_GUI_GetStringList(a_str, a_list, a_selected);
 }, MonoString* a_str, MonoArray* a_list, int32_t* a_selected)
@@ -464,29 +476,28 @@ RUNTIME_FUNCTION(uint32_t, GUI, GetStringList,
 // MSVC workaround
 static uint32_t M_GUI_ResetButton(MonoString* a_str)
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
     IDEFER(ImGui::SameLine());
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
 
     return (uint32_t)FlareImGui::ImageButton(str, "Textures/Icons/Icon_Reset.png", glm::vec2(16.0f));
 }
-RUNTIME_FUNCTION(uint32_t, GUI, ResetButton,
+GUI_FUNCTION(uint32_t, ResetButton,
 {
     return M_GUI_ResetButton(a_str);
 }, MonoString* a_str)
 
-RUNTIME_FUNCTION(void, GUI, NIndent,
+GUI_FUNCTION(void, NIndent,
 {
     ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
 })
-RUNTIME_FUNCTION(void, GUI, Indent,
+GUI_FUNCTION(void, Indent,
 {
     ImGui::Indent();
 })
-RUNTIME_FUNCTION(void, GUI, Unindent,
+GUI_FUNCTION(void, Unindent,
 {
     ImGui::Unindent();
 })
@@ -494,13 +505,12 @@ RUNTIME_FUNCTION(void, GUI, Unindent,
 // MSVC workaround
 static void M_GUI_Tooltip(MonoString* a_title, MonoString* a_str)
 {
-    char* title = mono_string_to_utf8(a_title);
-    IDEFER(mono_free(title));
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
-
+    // Called for every item that has one so skip converting unless it is going to be shown
     if (ImGui::IsItemHovered())
     {
+        const char* title = ToScratchString(a_title);
+        const char* str = ToScratchString(a_str);
+
         ImGui::BeginTooltip();
         IDEFER(ImGui::EndTooltip());
 
@@ -520,39 +530,36 @@ static void M_GUI_Tooltip(MonoString* a_title, MonoString* a_str)
         }
     }
 }
-RUNTIME_FUNCTION(void, GUI, Tooltip,
+GUI_FUNCTION(void, Tooltip,
 {
     M_GUI_Tooltip(a_title, a_str);
 }, MonoString* a_title, MonoString* a_str)
 
-RUNTIME_FUNCTION(uint32_t, GUI, ShowStructView,
+GUI_FUNCTION(uint32_t, ShowStructView,
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     return (uint32_t)ImGui::CollapsingHeader(str);
 }, MonoString* a_str)
-RUNTIME_FUNCTION(uint32_t, GUI, ShowArrayView,
+GUI_FUNCTION(uint32_t, ShowArrayView,
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
     {
-        STACK_G_ID(std::string(str) + "_Add");
+        STACK_ID(GUI::HashID("_Add", 4, GetLabelID(a_str)));
         *a_addValue = (uint32_t)ImGui::Button("+");
     }
     
     ImGui::SameLine();
     
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     return (uint32_t)ImGui::CollapsingHeader(str);
 }, MonoString* a_str, uint32_t* a_addValue)
 
-RUNTIME_FUNCTION(uint32_t, GUI, ShowTexture, 
+GUI_FUNCTION(uint32_t, ShowTexture, 
 {
-    char* path = mono_string_to_utf8(a_path);
-    IDEFER(mono_free(path));
+    const char* path = ToScratchString(a_path);
 
     const Texture* texture = Datastore::GetTexture(path);
     if (texture != nullptr)
@@ -565,123 +572,144 @@ RUNTIME_FUNCTION(uint32_t, GUI, ShowTexture,
     return 0;
 }, MonoString* a_path, glm::vec2 a_size)
 
-RUNTIME_FUNCTION(void, GUI, PushID, 
+GUI_FUNCTION(void, PushID, 
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
-
-    Instance->PushID(str);
+    Instance->PushID(GetLabelID(a_str));
 }, MonoString* a_str)
-RUNTIME_FUNCTION(void, GUI, PopID,
+GUI_FUNCTION(void, PopID,
 {
     Instance->PopID();
 })
-RUNTIME_FUNCTION(MonoString*, GUI, GetCurrentID,
+GUI_FUNCTION(uint32_t, GetCurrentID,
 {
-    return mono_string_new(mono_domain_get(), Instance->GetID().c_str());
+    return Instance->GetID();
 })
 
-RUNTIME_FUNCTION(void, GUI, Label, 
+GUI_FUNCTION(void, Label, 
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     ImGui::Text("%s", str);
 }, MonoString* a_str)
-RUNTIME_FUNCTION(uint32_t, GUI, GetSelectable,
+GUI_FUNCTION(uint32_t, GetSelectable,
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     return (uint32_t)ImGui::Selectable(str);
 }, MonoString* a_str)
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetContextPopup, 
+GUI_FUNCTION(uint32_t, GetContextPopup, 
 {
     return (uint32_t)ImGui::BeginPopupContextItem();
 })
-RUNTIME_FUNCTION(uint32_t, GUI, GetContextPopupWindow, 
+GUI_FUNCTION(uint32_t, GetContextPopupWindow, 
 {
     return (uint32_t)ImGui::BeginPopupContextWindow();
 })
-RUNTIME_FUNCTION(void, GUI, EndPopup,
+GUI_FUNCTION(void, EndPopup,
 {
     ImGui::EndPopup();
 })
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetMenu, 
+GUI_FUNCTION(uint32_t, GetMenu, 
 {
-    char* str = mono_string_to_utf8(a_label);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_label);
 
     return (uint32_t)ImGui::BeginMenu(str);
 }, MonoString* a_label)
-RUNTIME_FUNCTION(void, GUI, EndMenu,
+GUI_FUNCTION(void, EndMenu,
 {
     ImGui::EndMenu();
 })
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetMenuItem, 
+GUI_FUNCTION(uint32_t, GetMenuItem, 
 {
-    char* str = mono_string_to_utf8(a_label);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_label);
 
     return (uint32_t)ImGui::MenuItem(str);
 }, MonoString* a_label)
 
-RUNTIME_FUNCTION(uint32_t, GUI, NodeI,
+GUI_FUNCTION(uint32_t, NodeI,
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
-    STACK_G_ID(str);
+    STACK_G_ID(a_str);
     return (uint32_t)ImGui::TreeNode(str);
 }, MonoString* a_str)
-RUNTIME_FUNCTION(void, GUI, PopNode,
+GUI_FUNCTION(void, PopNode,
 {
     ImGui::TreePop();
 })
 
-RUNTIME_FUNCTION(void, GUI, SameLine, 
+GUI_FUNCTION(void, SameLine, 
 {
     ImGui::SameLine();
 })
-RUNTIME_FUNCTION(void, GUI, Separator, 
+GUI_FUNCTION(void, Separator, 
 {
     ImGui::Separator();
 })
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetBeginChild, 
+GUI_FUNCTION(uint32_t, GetBeginChild, 
 {
-    char* str = mono_string_to_utf8(a_str);
-    IDEFER(mono_free(str));
+    const char* str = ToScratchString(a_str);
 
     return (uint32_t)ImGui::BeginChild(str, { a_size.x, a_size.y });
 }, MonoString* a_str, glm::vec2 a_size)
-RUNTIME_FUNCTION(void, GUI, EndChild, 
+GUI_FUNCTION(void, EndChild, 
 {
     ImGui::EndChild();
 })
 
-RUNTIME_FUNCTION(uint32_t, GUI, GetShiftModifier, 
+GUI_FUNCTION(void, BeginListClipper,
+{
+    Instance->BeginListClipper(a_count, a_itemHeight);
+}, uint32_t a_count, float a_itemHeight)
+GUI_FUNCTION(uint32_t, GetListClipperStep,
+{
+    return (uint32_t)Instance->StepListClipper(a_start, a_end);
+}, uint32_t* a_start, uint32_t* a_end)
+GUI_FUNCTION(void, EndListClipper,
+{
+    Instance->EndListClipper();
+})
+
+GUI_FUNCTION(void, ExecuteCommands,
+{
+    const uint32_t* commands = mono_array_addr(a_commands, uint32_t, 0);
+    const uint16_t* strings = mono_array_addr(a_strings, uint16_t, 0);
+    uint32_t* results = mono_array_addr(a_results, uint32_t, 0);
+
+    // Counts come from C# so do not trust them past the arrays
+    const uint32_t commandCount = std::min(a_commandCount, (uint32_t)mono_array_length(a_commands));
+    const uint32_t stringLength = std::min(a_stringLength, (uint32_t)mono_array_length(a_strings));
+    const uint32_t resultCount = std::min(a_resultCount, (uint32_t)mono_array_length(a_results));
+
+    Instance->ExecuteCommands(commands, commandCount, strings, stringLength, results, resultCount);
+}, MonoArray* a_commands, uint32_t a_commandCount, MonoArray* a_strings, uint32_t a_stringLength, MonoArray* a_results, uint32_t a_resultCount)
+
+GUI_FUNCTION(uint32_t, GetShiftModifier, 
 {
     return (uint32_t)(ImGui::IsKeyDown(ImGuiKey_LeftShift) || ImGui::IsKeyDown(ImGuiKey_RightShift));
 })
-RUNTIME_FUNCTION(uint32_t, GUI, GetCtrlModifier,
+GUI_FUNCTION(uint32_t, GetCtrlModifier,
 {
     return (uint32_t)(ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl));
 })
 
-GUI::GUI(AppMain* a_app, AssetLibrary* a_assets)
+GUI::GUI(AppMain* a_app, AssetLibrary* a_assets) : m_scratch(ScratchBlockSize)
 {
     m_app = a_app;
     m_assets = a_assets;
 }
 GUI::~GUI()
 {
-    
+    for (ImGuiListClipper* clipper : m_clippers)
+    {
+        delete clipper;
+    }
 }
 
 void GUI::Init(AppMain* a_app, AssetLibrary* a_assets)
@@ -751,6 +779,12 @@ void GUI::Init(AppMain* a_app, AssetLibrary* a_assets)
         BIND_FUNCTION(IcarianEditor, GUI, SameLine);
         BIND_FUNCTION(IcarianEditor, GUI, Separator);
 
+        BIND_FUNCTION(IcarianEditor, GUI, BeginListClipper);
+        BIND_FUNCTION(IcarianEditor, GUI, GetListClipperStep);
+        BIND_FUNCTION(IcarianEditor, GUI, EndListClipper);
+
+        BIND_FUNCTION(IcarianEditor, GUI, ExecuteCommands);
+
         BIND_FUNCTION(IcarianEditor, GUI, GetShiftModifier);
         BIND_FUNCTION(IcarianEditor, GUI, GetCtrlModifier);
 
@@ -767,16 +801,35 @@ void GUI::Destroy()
     }
 }
 
+// Everything converted last frame is done with by the time the next one starts
+void GUI::NewFrame()
+{
+    if (Instance == nullptr)
+    {
+        return;
+    }
+
+    EDITOR_PROFILE_COUNTER("GUI Scratch Bytes", Instance->m_scratch.GetUsed());
+    EDITOR_PROFILE_COUNTER("GUI Scratch Blocks", Instance->m_scratch.GetBlockCount());
+    EDITOR_PROFILE_COUNTER("GUI Native Calls", NativeCalls);
+    EDITOR_PROFILE_COUNTER("GUI Buffered Commands", BufferedCommands);
+
+    Instance->m_scratch.Reset();
+
+    NativeCalls = 0;
+    BufferedCommands = 0;
+}
+
 class PathAssetModalData : public GetAssetModalData
 {
 private:
-    GUI*        m_gui;
-    std::string m_id;
+    GUI*     m_gui;
+    uint32_t m_id;
 
 protected:
 
 public:
-    PathAssetModalData(GUI* a_gui, const std::string_view& a_id)
+    PathAssetModalData(GUI* a_gui, uint32_t a_id)
     {
         m_gui = a_gui;
         m_id = a_id;
@@ -786,7 +839,7 @@ public:
     {
         const PathString str =
         {
-            .IDStr = m_id,
+            .ID = m_id,
             .Path = a_path.string()
         };
 
@@ -803,11 +856,11 @@ void GUI::OpenAssetPathModal(char* const* a_extensions, uint32_t a_extensionCoun
 
 std::string GUI::GetPathString()
 {
-    const std::string id = GetID();
+    const uint32_t id = GetID();
 
     for (auto iter = m_pathStrings.begin(); iter != m_pathStrings.end(); ++iter)
     {
-        if (iter->IDStr == id)
+        if (iter->ID == id)
         {
             const std::string path = iter->Path;
 
@@ -820,20 +873,361 @@ std::string GUI::GetPathString()
     return std::string();
 }
 
+// Item height of zero or less gets measured off the first row
+void GUI::BeginListClipper(uint32_t a_count, float a_itemHeight)
+{
+    ImGuiListClipper* clipper = new ImGuiListClipper();
+    clipper->Begin((int)a_count, a_itemHeight > 0.0f ? a_itemHeight : -1.0f);
+
+    m_clippers.emplace_back(clipper);
+}
+bool GUI::StepListClipper(uint32_t* a_start, uint32_t* a_end)
+{
+    if (m_clippers.empty())
+    {
+        return false;
+    }
+
+    ImGuiListClipper* clipper = m_clippers.back();
+    if (!clipper->Step())
+    {
+        return false;
+    }
+
+    *a_start = (uint32_t)clipper->DisplayStart;
+    *a_end = (uint32_t)clipper->DisplayEnd;
+
+    return true;
+}
+void GUI::EndListClipper()
+{
+    if (m_clippers.empty())
+    {
+        return;
+    }
+
+    ImGuiListClipper* clipper = m_clippers.back();
+    m_clippers.pop_back();
+
+    clipper->End();
+    delete clipper;
+}
+
+// Stops at anything malformed and closes whatever it opened so the ImGui stacks stay balanced
+void GUI::ExecuteCommands(const uint32_t* a_commands, uint32_t a_commandCount, const uint16_t* a_strings, uint32_t a_stringLength, uint32_t* a_results, uint32_t a_resultCount)
+{
+    m_commandScopes.clear();
+
+    uint32_t index = 0;
+    while (index < a_commandCount)
+    {
+        const uint32_t command = a_commands[index];
+        if (command >= GUICommand_Last || index + CommandArgCount[command] >= a_commandCount)
+        {
+            Logger::Warning("GUI command buffer has an invalid command");
+
+            break;
+        }
+
+        const uint32_t* args = a_commands + index + 1;
+        index += CommandArgCount[command] + 1;
+
+        ++BufferedCommands;
+
+        // Every command with arguments starts with a string
+        if (CommandArgCount[command] > 0 && (uint64_t)args[0] + args[1] > a_stringLength)
+        {
+            Logger::Warning("GUI command buffer string out of range");
+
+            break;
+        }
+
+        bool valid = true;
+        switch (command)
+        {
+        case GUICommand_Label:
+        {
+            ImGui::TextUnformatted(ToScratchUTF8(a_strings + args[0], args[1]));
+
+            break;
+        }
+        case GUICommand_SameLine:
+        {
+            ImGui::SameLine();
+
+            break;
+        }
+        case GUICommand_Separator:
+        {
+            ImGui::Separator();
+
+            break;
+        }
+        case GUICommand_Indent:
+        {
+            ImGui::Indent();
+
+            break;
+        }
+        case GUICommand_Unindent:
+        {
+            ImGui::Unindent();
+
+            break;
+        }
+        case GUICommand_PushID:
+        {
+            PushID(HashID(a_strings + args[0], args[1], GetID()));
+            m_commandScopes.emplace_back(GUICommand_PushID);
+
+            break;
+        }
+        case GUICommand_PopID:
+        {
+            valid = !m_commandScopes.empty() && m_commandScopes.back() == GUICommand_PushID;
+            if (valid)
+            {
+                PopID();
+                m_commandScopes.pop_back();
+            }
+
+            break;
+        }
+        case GUICommand_Button:
+        {
+            valid = args[2] < a_resultCount;
+            if (valid)
+            {
+                STACK_ID(HashID(a_strings + args[0], args[1], GetID()));
+
+                a_results[args[2]] = (uint32_t)ImGui::Button(ToScratchUTF8(a_strings + args[0], args[1]));
+            }
+
+            break;
+        }
+        case GUICommand_Selectable:
+        {
+            valid = args[3] < a_resultCount;
+            if (valid)
+            {
+                STACK_ID(HashID(a_strings + args[0], args[1], GetID()));
+
+                a_results[args[3]] = (uint32_t)ImGui::Selectable(ToScratchUTF8(a_strings + args[0], args[1]), args[2] != 0);
+            }
+
+            break;
+        }
+        case GUICommand_TreeNode:
+        {
+            valid = args[2] < a_resultCount && args[3] >= index && args[3] <= a_commandCount;
+            if (valid)
+            {
+                bool open;
+                {
+                    STACK_ID(HashID(a_strings + args[0], args[1], GetID()));
+
+                    open = ImGui::TreeNode(ToScratchUTF8(a_strings + args[0], args[1]));
+                }
+
+                a_results[args[2]] = (uint32_t)open;
+
+                if (open)
+                {
+                    m_commandScopes.emplace_back(GUICommand_TreeNode);
+                }
+                else
+                {
+                    index = args[3];
+                }
+            }
+
+            break;
+        }
+        case GUICommand_TreePop:
+        {
+            valid = !m_commandScopes.empty() && m_commandScopes.back() == GUICommand_TreeNode;
+            if (valid)
+            {
+                ImGui::TreePop();
+                m_commandScopes.pop_back();
+            }
+
+            break;
+        }
+        case GUICommand_BeginTable:
+        {
+            valid = args[2] > 0 && args[3] >= index && args[3] <= a_commandCount;
+            if (valid)
+            {
+                if (ImGui::BeginTable(ToScratchUTF8(a_strings + args[0], args[1]), (int)args[2]))
+                {
+                    m_commandScopes.emplace_back(GUICommand_BeginTable);
+                }
+                else
+                {
+                    index = args[3];
+                }
+            }
+
+            break;
+        }
+        case GUICommand_TableNextRow:
+        {
+            valid = !m_commandScopes.empty() && m_commandScopes.back() == GUICommand_BeginTable;
+            if (valid)
+            {
+                ImGui::TableNextRow();
+            }
+
+            break;
+        }
+        case GUICommand_TableNextColumn:
+        {
+            valid = !m_commandScopes.empty() && m_commandScopes.back() == GUICommand_BeginTable;
+            if (valid)
+            {
+                ImGui::TableNextColumn();
+            }
+
+            break;
+        }
+        case GUICommand_EndTable:
+        {
+            valid = !m_commandScopes.empty() && m_commandScopes.back() == GUICommand_BeginTable;
+            if (valid)
+            {
+                ImGui::EndTable();
+                m_commandScopes.pop_back();
+            }
+
+            break;
+        }
+        }
+
+        if (!valid)
+        {
+            Logger::Warning("GUI command buffer has an invalid command");
+
+            break;
+        }
+    }
+
+    for (auto iter = m_commandScopes.rbegin(); iter != m_commandScopes.rend(); ++iter)
+    {
+        switch (*iter)
+        {
+        case GUICommand_PushID:
+        {
+            PopID();
+
+            break;
+        }
+        case GUICommand_TreeNode:
+        {
+            ImGui::TreePop();
+
+            break;
+        }
+        case GUICommand_BeginTable:
+        {
+            ImGui::EndTable();
+
+            break;
+        }
+        }
+    }
+
+    m_commandScopes.clear();
+}
+
 void GUI::SetWidth(float a_width)
 {
     Instance->m_width = a_width;
 }
 
-std::string GUI::GetID() const
+// FNV-1a, only has to be stable within a run
+uint32_t GUI::HashID(const char* a_str, uint32_t a_size, uint32_t a_seed)
 {
-    std::string str;
+    uint32_t hash = a_seed;
+    for (uint32_t i = 0; i < a_size; ++i)
+    {
+        hash ^= (uint8_t)a_str[i];
+        hash *= FNVPrime;
+    }
 
-    for (const std::string& s : m_id)
+    return hash;
+}
+uint32_t GUI::HashID(const uint16_t* a_str, uint32_t a_size, uint32_t a_seed)
+{
+    uint32_t hash = a_seed;
+    for (uint32_t i = 0; i < a_size; ++i)
     {
-        str += s + " ";
+        hash ^= (uint8_t)(a_str[i] & 0xFF);
+        hash *= FNVPrime;
+        hash ^= (uint8_t)(a_str[i] >> 8);
+        hash *= FNVPrime;
     }
 
+    return hash;
+}
+uint32_t GUI::HashID(uint32_t a_value, uint32_t a_seed)
+{
+    uint32_t hash = a_seed;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        hash ^= (uint8_t)(a_value >> (i * 8));
+        hash *= FNVPrime;
+    }
+
+    return hash;
+}
+
+// Worst case is 3 bytes per UTF-16 unit, surrogate pairs only take 4 bytes for 2 units
+char* GUI::ToScratchUTF8(const uint16_t* a_str, uint32_t a_length)
+{
+    char* str = (char*)m_scratch.Allocate(a_length * 3 + 1);
+
+    uint32_t size = 0;
+    for (uint32_t i = 0; i < a_length; ++i)
+    {
+        uint32_t c = a_str[i];
+        if (c >= 0xD800 && c <= 0xDBFF && i + 1 < a_length && a_str[i + 1] >= 0xDC00 && a_str[i + 1] <= 0xDFFF)
+        {
+            c = 0x10000 + ((c - 0xD800) << 10) + (a_str[i + 1] - 0xDC00);
+            ++i;
+        }
+        else if (c >= 0xD800 && c <= 0xDFFF)
+        {
+            // Lone surrogate, same as what mono swaps them for
+            c = 0xFFFD;
+        }
+
+        if (c < 0x80)
+        {
+            str[size++] = (char)c;
+        }
+        else if (c < 0x800)
+        {
+            str[size++] = (char)(0xC0 | (c >> 6));
+            str[size++] = (char)(0x80 | (c & 0x3F));
+        }
+        else if (c < 0x10000)
+        {
+            str[size++] = (char)(0xE0 | (c >> 12));
+            str[size++] = (char)(0x80 | ((c >> 6) & 0x3F));
+            str[size++] = (char)(0x80 | (c & 0x3F));
+        }
+        else
+        {
+            str[size++] = (char)(0xF0 | (c >> 18));
+            str[size++] = (char)(0x80 | ((c >> 12) & 0x3F));
+            str[size++] = (char)(0x80 | ((c >> 6) & 0x3F));
+            str[size++] = (char)(0x80 | (c & 0x3F));
+        }
+    }
+
+    str[size] = 0;
+
     return str;
 }
 
@@ -4,8 +4,11 @@
 
 #include "IO.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
+#include <fstream>
+#include <thread>
 
 #include "Logger.h"
 
@@ -13,6 +16,8 @@
 #include "Core/WindowsHeaders.h"
 
 #include <shlobj.h>
+#else
+#include <unistd.h>
 #endif
 
 std::filesystem::path IO::GetHomePath()
@@ -27,6 +32,31 @@ std::filesystem::path IO::GetHomePath()
     return std::getenv("HOME");
 #endif
 }
+std::filesystem::path IO::GetEditorDataPath()
+{
+#ifdef WIN32
+    CHAR path[MAX_PATH];
+    if (SHGetFolderPathA(NULL, CSIDL_LOCAL_APPDATA, NULL, 0, path) == S_OK)
+    {
+        return std::filesystem::path(path) / "IcarianEditor";
+    }
+#else
+    const char* dataHome = std::getenv("XDG_DATA_HOME");
+    if (dataHome != nullptr && dataHome[0] != 0)
+    {
+        return std::filesystem::path(dataHome) / "IcarianEditor";
+    }
+
+    const char* home = std::getenv("HOME");
+    if (home != nullptr && home[0] != 0)
+    {
+        return std::filesystem::path(home) / ".local" / "share" / "IcarianEditor";
+    }
+#endif
+
+    // Nowhere better to put it so fall back to where the editor is running
+    return std::filesystem::current_path();
+}
 bool IO::ValidatePathName(const std::string_view& a_name)
 {
     const uint32_t nameLen = (uint32_t)a_name.length();
@@ -108,6 +138,57 @@ std::filesystem::path IO::GetRelativePath(const std::filesystem::path& a_relativ
     return path;
 }
 
+bool IO::WriteFileAtomic(const std::filesystem::path& a_path, const std::initializer_list<IOWritePart>& a_parts)
+{
+    static std::atomic<uint32_t> Counter = 0;
+
+    std::error_code ec;
+    std::filesystem::create_directories(a_path.parent_path(), ec);
+
+#ifdef WIN32
+    const uint64_t processID = (uint64_t)GetCurrentProcessId();
+#else
+    const uint64_t processID = (uint64_t)getpid();
+#endif
+    const uint64_t threadID = (uint64_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    // Process and thread keep other editors and workers off the file, counter covers the same thread writing twice
+    std::filesystem::path tempPath = a_path;
+    tempPath += "." + std::to_string(processID) + "." + std::to_string(threadID) + "." + std::to_string(Counter++) + ".tmp";
+
+    {
+        std::ofstream file = std::ofstream(tempPath, std::ios::binary);
+        if (!file.good())
+        {
+            return false;
+        }
+
+        for (const IOWritePart& part : a_parts)
+        {
+            file.write((const char*)part.Data, (std::streamsize)part.Size);
+        }
+
+        if (!file.good())
+        {
+            file.close();
+            std::filesystem::remove(tempPath, ec);
+
+            return false;
+        }
+    }
+
+    // Replaces the destination if another writer got there first
+    std::filesystem::rename(tempPath, a_path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+
+        return false;
+    }
+
+    return true;
+}
+
 std::filesystem::path IO::GetCSCPath()
 {
 #ifdef WIN32
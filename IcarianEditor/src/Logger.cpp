@@ -4,64 +4,566 @@
 
 #include "Logger.h"
  
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <filesystem>
 #include <iostream>
 
+#include <fcntl.h>
+
+#ifdef WIN32
+#include <io.h>
+#include <process.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "Application.h"
 #include "Windows/ConsoleWindow.h"
 
+Logger* Logger::Instance = nullptr;
+
 std::vector<ConsoleWindow*> Logger::Windows = std::vector<ConsoleWindow*>();
 
-void Logger::AddConsoleWindow(ConsoleWindow* a_window)
+static const char* GetPrefix(e_LoggerMessageType a_type)
 {
-    Windows.emplace_back(a_window);
+    switch (a_type)
+    {
+    case LoggerMessageType_Warning:
+    {
+        return "ILW: ";
+    }
+    case LoggerMessageType_Error:
+    {
+        return "ILE: ";
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return "ILM: ";
 }
-void Logger::RemoveConsoleWindow(ConsoleWindow* a_window)
+static const char* GetSourceName(e_LoggerMessageSource a_source)
 {
-    for (auto iter = Windows.begin(); iter != Windows.end(); ++iter)
+    switch (a_source)
     {
-        if (*iter == a_window)
-        {
-            Windows.erase(iter);
+    case LoggerMessageSource_Engine:
+    {
+        return "[Engine] ";
+    }
+    case LoggerMessageSource_Script:
+    {
+        return "[Script] ";
+    }
+    default:
+    {
+        break;
+    }
+    }
 
+    return "[Editor] ";
+}
+
+// Raw file handles as the crash path cannot go through streams
+static int OpenCrashFile(const char* a_path)
+{
+#ifdef WIN32
+    return _open(a_path, _O_WRONLY | _O_APPEND | _O_BINARY);
+#else
+    return open(a_path, O_WRONLY | O_APPEND | O_CLOEXEC);
+#endif
+}
+static void CloseCrashFile(int a_file)
+{
+#ifdef WIN32
+    _close(a_file);
+#else
+    close(a_file);
+#endif
+}
+static void CrashWrite(int a_file, const char* a_data, uint64_t a_size)
+{
+    while (a_size > 0)
+    {
+#ifdef WIN32
+        const int written = _write(a_file, a_data, (unsigned int)a_size);
+#else
+        const ssize_t written = write(a_file, a_data, (size_t)a_size);
+#endif
+        if (written <= 0)
+        {
             return;
         }
+
+        a_data += written;
+        a_size -= (uint64_t)written;
+    }
+}
+
+// Held for as long as the editor runs so no other editor rotates or truncates the log that goes with it
+// Released by the OS if the process goes down
+static int LockFile(const std::filesystem::path& a_path)
+{
+#ifdef WIN32
+    // No sharing so opening it again fails while it is held
+    int file = -1;
+    if (_wsopen_s(&file, a_path.c_str(), _O_CREAT | _O_RDWR | _O_BINARY, _SH_DENYRW, _S_IREAD | _S_IWRITE) != 0)
+    {
+        return -1;
+    }
+
+    return file;
+#else
+    const int file = open(a_path.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (file < 0)
+    {
+        return -1;
+    }
+
+    if (flock(file, LOCK_EX | LOCK_NB) != 0)
+    {
+        close(file);
+
+        return -1;
+    }
+
+    return file;
+#endif
+}
+static void UnlockFile(int a_file)
+{
+    // Lock files are left behind as removing one can race another editor taking it
+#ifdef WIN32
+    _close(a_file);
+#else
+    close(a_file);
+#endif
+}
+
+static void CrashSignalHandler(int a_signal)
+{
+    Logger::CrashFlush(a_signal);
+
+    std::signal(a_signal, SIG_DFL);
+    std::raise(a_signal);
+}
+
+Logger::Logger(const std::string_view& a_path)
+{
+    m_shutdown = false;
+
+    m_fileSize = 0;
+    m_lockFile = -1;
+
+    m_crashQueued = 0;
+    m_crashWritten = 0;
+    m_crashFile = -1;
+
+    const std::filesystem::path path = a_path;
+    const std::filesystem::path parent = path.parent_path();
+    const std::string stem = path.stem().string();
+    const std::string extension = path.extension().string();
+
+    // Do not want logging to be able to take down the editor so errors are ignored
+    std::error_code ec;
+    if (!parent.empty())
+    {
+        std::filesystem::create_directories(parent, ec);
+    }
+
+    // First editor gets the plain name and any others running at the same time get numbered ones
+    // Otherwise starting a second editor would rotate the log out from under the first
+    for (uint32_t i = 0; i < MaxLogSlots; ++i)
+    {
+        const std::string slotStem = i == 0 ? stem : stem + "-" + std::to_string(i);
+
+        m_lockFile = LockFile(parent / (slotStem + ".lock"));
+        if (m_lockFile >= 0)
+        {
+            m_filePath = (parent / (slotStem + extension)).string();
+
+            break;
+        }
+    }
+
+    if (m_lockFile < 0)
+    {
+#ifdef WIN32
+        const int processID = _getpid();
+#else
+        const int processID = (int)getpid();
+#endif
+
+        m_filePath = (parent / (stem + "-" + std::to_string(processID) + extension)).string();
+    }
+
+    // Keep the log from the last session around instead of overwriting it
+    RotateLogFiles();
+    OpenLogFile();
+
+    m_thread = std::thread(&Logger::Run, this);
+}
+Logger::~Logger()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_writeLock);
+
+        m_shutdown = true;
+    }
+    m_writeSignal.notify_one();
+
+    m_thread.join();
+
+    m_file.close();
+
+    const int crashFile = m_crashFile.exchange(-1);
+    if (crashFile >= 0)
+    {
+        CloseCrashFile(crashFile);
+    }
+
+    if (m_lockFile >= 0)
+    {
+        UnlockFile(m_lockFile);
+    }
+}
+
+void Logger::Init(const std::string_view& a_path)
+{
+    if (Instance == nullptr)
+    {
+        Instance = new Logger(a_path);
+
+        std::signal(SIGSEGV, CrashSignalHandler);
+        std::signal(SIGABRT, CrashSignalHandler);
+        std::signal(SIGFPE, CrashSignalHandler);
+        std::signal(SIGILL, CrashSignalHandler);
+    }
+}
+void Logger::Destroy()
+{
+    if (Instance != nullptr)
+    {
+        std::signal(SIGSEGV, SIG_DFL);
+        std::signal(SIGABRT, SIG_DFL);
+        std::signal(SIGFPE, SIG_DFL);
+        std::signal(SIGILL, SIG_DFL);
+
+        // Destructor drains the queue before the thread exits
+        delete Instance;
+        Instance = nullptr;
+    }
+}
+
+void Logger::OpenLogFile()
+{
+    m_file.open(m_filePath, std::ios::out | std::ios::trunc);
+    m_fileSize = 0;
+
+    if (!m_file.good())
+    {
+        std::cout << "ILW: Failed to open log file: " << m_filePath << "\n";
+    }
+
+    // Opened up front as the signal handler cannot open anything itself
+    const int oldFile = m_crashFile.exchange(OpenCrashFile(m_filePath.c_str()));
+    if (oldFile >= 0)
+    {
+        CloseCrashFile(oldFile);
+    }
+}
+void Logger::RotateLogFiles()
+{
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+
+    const std::filesystem::path path = m_filePath;
+    const std::filesystem::path parent = path.parent_path();
+    const std::string stem = path.stem().string();
+    const std::string extension = path.extension().string();
+
+    // Do not want logging to be able to take down the editor so errors are ignored
+    std::error_code ec;
+
+    if (!std::filesystem::exists(path, ec))
+    {
+        return;
+    }
+
+    std::filesystem::remove(parent / (stem + "." + std::to_string(MaxLogFiles) + extension), ec);
+    for (uint32_t i = MaxLogFiles - 1; i > 0; --i)
+    {
+        const std::filesystem::path from = parent / (stem + "." + std::to_string(i) + extension);
+        if (std::filesystem::exists(from, ec))
+        {
+            std::filesystem::rename(from, parent / (stem + "." + std::to_string(i + 1) + extension), ec);
+        }
+    }
+
+    std::filesystem::rename(path, parent / (stem + ".1" + extension), ec);
+}
+
+void Logger::WriteMessages(const std::vector<LoggerMessage>& a_messages)
+{
+    // Build the output up front so each batch is a single write instead of one per message
+    std::string out;
+    std::string file;
+    for (const LoggerMessage& message : a_messages)
+    {
+        const char* prefix = GetPrefix(message.Type);
+
+        if (message.Print)
+        {
+            out += prefix;
+            out += message.Message;
+            out += '\n';
+        }
+
+        file += GetSourceName(message.Source);
+        file += prefix;
+        file += message.Message;
+        file += '\n';
+    }
+
+    if (!out.empty())
+    {
+        std::cout << out;
+        std::cout.flush();
+    }
+
+    if (m_file.good())
+    {
+        m_file << file;
+        m_file.flush();
+
+        m_fileSize += file.size();
+        if (m_fileSize >= MaxLogFileSize)
+        {
+            RotateLogFiles();
+            OpenLogFile();
+        }
     }
 }
 
-void Logger::Message(const std::string_view& a_string, bool a_editor, bool a_print)
+void Logger::Run()
 {
-    if (a_print)
+    std::vector<LoggerMessage> messages;
+
+    while (true)
+    {
+        {
+            std::unique_lock l = std::unique_lock(m_writeLock);
+            m_writeSignal.wait(l, [this]() { return m_shutdown || !m_writeQueue.empty(); });
+
+            if (m_writeQueue.empty())
+            {
+                // Only get here on shutdown with nothing left to write
+                break;
+            }
+
+            messages.swap(m_writeQueue);
+        }
+
+        // Everything swapped out was already in the crash buffer when the lock was held
+        const uint64_t crashQueued = m_crashQueued.load();
+
+        WriteMessages(messages);
+
+        m_crashWritten.store(crashQueued);
+
+        messages.clear();
+    }
+}
+
+void Logger::Update()
+{
+    if (Instance == nullptr)
+    {
+        return;
+    }
+
+    std::vector<LoggerMessage> messages;
+    {
+        const std::unique_lock l = std::unique_lock(Instance->m_consoleLock);
+
+        messages.swap(Instance->m_consoleQueue);
+    }
+
+    for (const LoggerMessage& message : messages)
+    {
+        for (ConsoleWindow* console : Windows)
+        {
+            console->AddMessage(message.Message, message.Source, message.Type);
+        }
+    }
+}
+void Logger::AppendCrashBuffer(const std::string_view& a_str)
+{
+    const char* data = a_str.data();
+    uint64_t size = a_str.size();
+    uint64_t queued = m_crashQueued.load(std::memory_order_relaxed);
+
+    // Only the tail of anything bigger then the buffer would survive anyway
+    if (size > CrashBufferSize)
     {
-        std::cout << "ILM: " << a_string << "\n";
+        data += size - CrashBufferSize;
+        queued += size - CrashBufferSize;
+        size = CrashBufferSize;
     }
 
-    for (ConsoleWindow* console : Windows)
+    while (size > 0)
     {
-        console->AddMessage(a_string, a_editor, LoggerMessageType_Message);
+        const uint64_t offset = queued % CrashBufferSize;
+        const uint64_t count = std::min(size, CrashBufferSize - offset);
+
+        memcpy(m_crashBuffer + offset, data, count);
+
+        data += count;
+        queued += count;
+        size -= count;
     }
+
+    m_crashQueued.store(queued, std::memory_order_release);
 }
-void Logger::Warning(const std::string_view& a_string, bool a_editor, bool a_print)
+void Logger::CrashFlush(int a_signal)
 {
-    if (a_print)
+    // Whatever crashed may be holding a lock or be inside the allocator so only raw writes from memory that already exists
+    // A message being appended as this runs can come out torn but it is better then nothing
+    if (Instance == nullptr)
+    {
+        return;
+    }
+
+    const uint64_t queued = Instance->m_crashQueued.load(std::memory_order_acquire);
+    uint64_t written = Instance->m_crashWritten.load();
+    // Anything older has already been overwritten
+    if (queued - written > CrashBufferSize)
     {
-        std::cout << "ILW: " << a_string << "\n";
+        written = queued - CrashBufferSize;
     }
 
-    for (ConsoleWindow* console : Windows)
+    char line[64] = "[Editor] ILE: Crashed with signal ";
+    uint32_t lineSize = (uint32_t)strlen(line);
+
+    char digits[16];
+    uint32_t digitCount = 0;
+    uint32_t value = (uint32_t)a_signal;
+    do
     {
-        console->AddMessage(a_string, a_editor, LoggerMessageType_Warning);
+        digits[digitCount++] = (char)('0' + value % 10);
+        value /= 10;
     }
+    while (value > 0);
+
+    while (digitCount > 0)
+    {
+        line[lineSize++] = digits[--digitCount];
+    }
+    line[lineSize++] = '\n';
+
+    const int files[] = { Instance->m_crashFile.load(), 2 };
+    for (const int file : files)
+    {
+        if (file < 0)
+        {
+            continue;
+        }
+
+        const uint64_t start = written % CrashBufferSize;
+        const uint64_t size = queued - written;
+        const uint64_t firstSize = std::min(size, CrashBufferSize - start);
+
+        CrashWrite(file, Instance->m_crashBuffer + start, firstSize);
+        CrashWrite(file, Instance->m_crashBuffer, size - firstSize);
+        CrashWrite(file, line, lineSize);
+    }
+}
+
+void Logger::AddConsoleWindow(ConsoleWindow* a_window)
+{
+    Windows.emplace_back(a_window);
 }
-void Logger::Error(const std::string_view& a_string, bool a_editor, bool a_print)
+void Logger::RemoveConsoleWindow(ConsoleWindow* a_window)
 {
-    if (a_print)
+    for (auto iter = Windows.begin(); iter != Windows.end(); ++iter)
     {
-        std::cout << "ILE: " << a_string << "\n";
+        if (*iter == a_window)
+        {
+            Windows.erase(iter);
+
+            return;
+        }
+    }
+}
+
+void Logger::PushMessage(const std::string_view& a_string, e_LoggerMessageType a_type, e_LoggerMessageSource a_source, bool a_print)
+{
+    if (Instance == nullptr)
+    {
+        // Not running so fallback to writing straight out
+        if (a_print)
+        {
+            std::cout << GetPrefix(a_type) << a_string << "\n";
+        }
+
+        for (ConsoleWindow* console : Windows)
+        {
+            console->AddMessage(a_string, a_source, a_type);
+        }
+
+        return;
+    }
+
+    const LoggerMessage message =
+    {
+        .Message = std::string(a_string),
+        .Type = a_type,
+        .Source = a_source,
+        .Print = a_print
+    };
+
+    {
+        const std::unique_lock l = std::unique_lock(Instance->m_consoleLock);
+
+        Instance->m_consoleQueue.emplace_back(message);
     }
 
-    for (ConsoleWindow* console : Windows)
+    // Can come from any thread so wake the editor up to show it
+    Application::RequestRedraw();
+
     {
-        console->AddMessage(a_string, a_editor, LoggerMessageType_Error);
+        const std::unique_lock l = std::unique_lock(Instance->m_writeLock);
+
+        Instance->m_writeQueue.emplace_back(message);
+
+        // Kept in the same form as the log file so a crash can write it straight out
+        Instance->AppendCrashBuffer(GetSourceName(a_source));
+        Instance->AppendCrashBuffer(GetPrefix(a_type));
+        Instance->AppendCrashBuffer(a_string);
+        Instance->AppendCrashBuffer("\n");
     }
+    Instance->m_writeSignal.notify_one();
+}
+
+void Logger::Message(const std::string_view& a_string, e_LoggerMessageSource a_source, bool a_print)
+{
+    PushMessage(a_string, LoggerMessageType_Message, a_source, a_print);
+}
+void Logger::Warning(const std::string_view& a_string, e_LoggerMessageSource a_source, bool a_print)
+{
+    PushMessage(a_string, LoggerMessageType_Warning, a_source, a_print);
+}
+void Logger::Error(const std::string_view& a_string, e_LoggerMessageSource a_source, bool a_print)
+{
+    PushMessage(a_string, LoggerMessageType_Error, a_source, a_print);
 }
 
 // MIT License
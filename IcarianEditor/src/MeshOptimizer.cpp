@@ -0,0 +1,433 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "Runtime/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#include "Hash.h"
+
+struct OverdrawCluster
+{
+    uint32_t Start;
+    uint32_t Count;
+    float    Sort;
+};
+
+static void GetPosition(const uint8_t* a_vertices, uint32_t a_vertexStride, uint32_t a_positionOffset, uint32_t a_index, float* a_pos)
+{
+    memcpy(a_pos, a_vertices + (uint64_t)a_index * a_vertexStride + a_positionOffset, sizeof(float) * 3);
+}
+
+float MeshOptimizer::GetACMR(const uint32_t* a_indices, uint32_t a_indexCount, uint32_t a_vertexCount)
+{
+    const uint32_t triangleCount = a_indexCount / 3;
+    if (triangleCount <= 0)
+    {
+        return 0.0f;
+    }
+
+    // Timestamp per vertex stands in for a FIFO, in the cache while the miss counter has not moved on more then the cache size
+    std::vector<uint32_t> cacheTime = std::vector<uint32_t>(a_vertexCount, 0);
+    uint32_t misses = 0;
+    for (uint32_t i = 0; i < a_indexCount; ++i)
+    {
+        const uint32_t index = a_indices[i];
+        if (cacheTime[index] == 0 || misses - cacheTime[index] >= CacheSize)
+        {
+            ++misses;
+            cacheTime[index] = misses;
+        }
+    }
+
+    return (float)misses / triangleCount;
+}
+
+uint32_t MeshOptimizer::Deduplicate(uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t* a_indices, uint32_t a_indexCount)
+{
+    std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+    buckets.reserve(a_vertexCount);
+
+    std::vector<uint32_t> remap = std::vector<uint32_t>(a_vertexCount);
+    uint32_t vertexCount = 0;
+    for (uint32_t i = 0; i < a_vertexCount; ++i)
+    {
+        const uint8_t* vertex = a_vertices + (uint64_t)i * a_vertexStride;
+
+        std::vector<uint32_t>& bucket = buckets[FNVHash(vertex, a_vertexStride)];
+
+        uint32_t match = -1;
+        for (const uint32_t candidate : bucket)
+        {
+            if (memcmp(a_vertices + (uint64_t)candidate * a_vertexStride, vertex, a_vertexStride) == 0)
+            {
+                match = candidate;
+
+                break;
+            }
+        }
+
+        if (match == -1)
+        {
+            // Compacting in place is safe as the write never gets ahead of the read
+            match = vertexCount++;
+            if (match != i)
+            {
+                memcpy(a_vertices + (uint64_t)match * a_vertexStride, vertex, a_vertexStride);
+            }
+
+            bucket.emplace_back(match);
+        }
+
+        remap[i] = match;
+    }
+
+    for (uint32_t i = 0; i < a_indexCount; ++i)
+    {
+        a_indices[i] = remap[a_indices[i]];
+    }
+
+    return vertexCount;
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* a_indices, uint32_t a_indexCount, uint32_t a_vertexCount, std::vector<uint32_t>* a_clusters)
+{
+    const uint32_t triangleCount = a_indexCount / 3;
+    if (triangleCount <= 0)
+    {
+        return;
+    }
+
+    // Vertex to triangle adjacency packed into one array
+    std::vector<uint32_t> live = std::vector<uint32_t>(a_vertexCount, 0);
+    for (uint32_t i = 0; i < triangleCount * 3; ++i)
+    {
+        ++live[a_indices[i]];
+    }
+
+    std::vector<uint32_t> offsets = std::vector<uint32_t>(a_vertexCount + 1, 0);
+    for (uint32_t i = 0; i < a_vertexCount; ++i)
+    {
+        offsets[i + 1] = offsets[i] + live[i];
+    }
+
+    std::vector<uint32_t> adjacency = std::vector<uint32_t>(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill = std::vector<uint32_t>(offsets.begin(), offsets.end() - 1);
+        for (uint32_t i = 0; i < triangleCount * 3; ++i)
+        {
+            adjacency[fill[a_indices[i]]++] = i / 3;
+        }
+    }
+
+    std::vector<uint32_t> cacheTime = std::vector<uint32_t>(a_vertexCount, 0);
+    std::vector<bool> emitted = std::vector<bool>(triangleCount, false);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+
+    uint32_t timestamp = CacheSize + 1;
+    uint32_t cursor = 0;
+    uint32_t fanning = 0;
+    bool newCluster = true;
+
+    while (fanning != -1)
+    {
+        if (newCluster)
+        {
+            a_clusters->emplace_back((uint32_t)output.size() / 3);
+            newCluster = false;
+        }
+
+        candidates.clear();
+        for (uint32_t i = offsets[fanning]; i < offsets[fanning + 1]; ++i)
+        {
+            const uint32_t triangle = adjacency[i];
+            if (emitted[triangle])
+            {
+                continue;
+            }
+
+            for (uint32_t j = 0; j < 3; ++j)
+            {
+                const uint32_t vertex = a_indices[triangle * 3 + j];
+
+                output.emplace_back(vertex);
+                deadEnd.emplace_back(vertex);
+                candidates.emplace_back(vertex);
+
+                --live[vertex];
+
+                if (timestamp - cacheTime[vertex] > CacheSize)
+                {
+                    cacheTime[vertex] = timestamp++;
+                }
+            }
+
+            emitted[triangle] = true;
+        }
+
+        // Prefer the candidate that has been in the cache longest that will still be in it after its remaining triangles
+        uint32_t next = -1;
+        uint32_t bestPriority = 0;
+        for (const uint32_t vertex : candidates)
+        {
+            if (live[vertex] <= 0)
+            {
+                continue;
+            }
+
+            uint32_t priority = 0;
+            if (timestamp - cacheTime[vertex] + 2 * live[vertex] <= CacheSize)
+            {
+                priority = timestamp - cacheTime[vertex];
+            }
+
+            if (next == -1 || priority > bestPriority)
+            {
+                next = vertex;
+                bestPriority = priority;
+            }
+        }
+
+        if (next == -1)
+        {
+            while (!deadEnd.empty())
+            {
+                const uint32_t vertex = deadEnd.back();
+                deadEnd.pop_back();
+
+                if (live[vertex] > 0)
+                {
+                    next = vertex;
+
+                    break;
+                }
+            }
+
+            while (next == -1 && cursor < a_vertexCount)
+            {
+                if (live[cursor] > 0)
+                {
+                    next = cursor;
+                }
+
+                ++cursor;
+            }
+
+            // Jumped away from the current fan so anything after here can be moved around without hurting the cache much
+            newCluster = true;
+        }
+
+        fanning = next;
+    }
+
+    // Clusters that never emitted anything are just noise
+    a_clusters->erase(std::unique(a_clusters->begin(), a_clusters->end()), a_clusters->end());
+    if (!a_clusters->empty() && a_clusters->back() >= triangleCount)
+    {
+        a_clusters->pop_back();
+    }
+
+    memcpy(a_indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+void MeshOptimizer::OptimizeOverdraw(uint32_t* a_indices, uint32_t a_indexCount, const uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t a_positionOffset, const std::vector<uint32_t>& a_clusters)
+{
+    const uint32_t triangleCount = a_indexCount / 3;
+    const uint32_t clusterCount = (uint32_t)a_clusters.size();
+    if (clusterCount <= 1)
+    {
+        return;
+    }
+
+    float meshCentroid[3] = { 0.0f, 0.0f, 0.0f };
+    float meshArea = 0.0f;
+
+    std::vector<OverdrawCluster> clusters = std::vector<OverdrawCluster>(clusterCount);
+    std::vector<float> clusterCentroids = std::vector<float>(clusterCount * 3, 0.0f);
+    std::vector<float> clusterNormals = std::vector<float>(clusterCount * 3, 0.0f);
+
+    for (uint32_t i = 0; i < clusterCount; ++i)
+    {
+        OverdrawCluster& cluster = clusters[i];
+        cluster.Start = a_clusters[i];
+        cluster.Count = (i + 1 < clusterCount ? a_clusters[i + 1] : triangleCount) - cluster.Start;
+
+        float* centroid = clusterCentroids.data() + i * 3;
+        float* normal = clusterNormals.data() + i * 3;
+        float area = 0.0f;
+
+        for (uint32_t j = cluster.Start; j < cluster.Start + cluster.Count; ++j)
+        {
+            float p0[3];
+            float p1[3];
+            float p2[3];
+            GetPosition(a_vertices, a_vertexStride, a_positionOffset, a_indices[j * 3 + 0], p0);
+            GetPosition(a_vertices, a_vertexStride, a_positionOffset, a_indices[j * 3 + 1], p1);
+            GetPosition(a_vertices, a_vertexStride, a_positionOffset, a_indices[j * 3 + 2], p2);
+
+            const float e0[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            const float e1[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            const float n[3] = 
+            { 
+                e0[1] * e1[2] - e0[2] * e1[1], 
+                e0[2] * e1[0] - e0[0] * e1[2], 
+                e0[0] * e1[1] - e0[1] * e1[0] 
+            };
+
+            // Length of the unnormalised normal is twice the area so weights everything for free
+            const float triArea = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const float c = (p0[k] + p1[k] + p2[k]) / 3.0f;
+
+                centroid[k] += c * triArea;
+                meshCentroid[k] += c * triArea;
+                normal[k] += n[k];
+            }
+
+            area += triArea;
+        }
+
+        if (area > 0.0f)
+        {
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                centroid[k] /= area;
+            }
+        }
+
+        meshArea += area;
+    }
+
+    if (meshArea <= 0.0f)
+    {
+        return;
+    }
+
+    for (uint32_t k = 0; k < 3; ++k)
+    {
+        meshCentroid[k] /= meshArea;
+    }
+
+    // Clusters facing away from the middle of the mesh are more likely to occlude the rest so they go first
+    for (uint32_t i = 0; i < clusterCount; ++i)
+    {
+        const float* centroid = clusterCentroids.data() + i * 3;
+        const float* normal = clusterNormals.data() + i * 3;
+
+        const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+        float sort = 0.0f;
+        if (length > 0.0f)
+        {
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                sort += (centroid[k] - meshCentroid[k]) * normal[k] / length;
+            }
+        }
+
+        clusters[i].Sort = sort;
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(), [](const OverdrawCluster& a_lhs, const OverdrawCluster& a_rhs)
+    {
+        return a_lhs.Sort > a_rhs.Sort;
+    });
+
+    std::vector<uint32_t> output;
+    output.reserve(a_indexCount);
+    for (const OverdrawCluster& cluster : clusters)
+    {
+        output.insert(output.end(), a_indices + cluster.Start * 3, a_indices + (cluster.Start + cluster.Count) * 3);
+    }
+
+    // Cluster boundaries are not free so only keep the new order if the cache did not suffer too much for it
+    const float before = GetACMR(a_indices, a_indexCount, a_vertexCount);
+    const float after = GetACMR(output.data(), (uint32_t)output.size(), a_vertexCount);
+    if (after <= before * OverdrawThreshold)
+    {
+        memcpy(a_indices, output.data(), output.size() * sizeof(uint32_t));
+    }
+}
+
+uint32_t MeshOptimizer::OptimizeVertexFetch(uint8_t* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, uint32_t* a_indices, uint32_t a_indexCount)
+{
+    std::vector<uint32_t> remap = std::vector<uint32_t>(a_vertexCount, -1);
+
+    std::vector<uint8_t> output;
+    output.reserve((size_t)a_vertexCount * a_vertexStride);
+
+    uint32_t vertexCount = 0;
+    for (uint32_t i = 0; i < a_indexCount; ++i)
+    {
+        const uint32_t index = a_indices[i];
+        if (remap[index] == -1)
+        {
+            remap[index] = vertexCount++;
+
+            const uint8_t* vertex = a_vertices + (uint64_t)index * a_vertexStride;
+            output.insert(output.end(), vertex, vertex + a_vertexStride);
+        }
+
+        a_indices[i] = remap[index];
+    }
+
+    // Anything never referenced gets dropped off the end
+    memcpy(a_vertices, output.data(), output.size());
+
+    return vertexCount;
+}
+
+MeshOptimizerStats MeshOptimizer::Optimize(uint8_t* a_vertices, uint32_t* a_vertexCount, uint32_t a_vertexStride, uint32_t a_positionOffset, uint32_t* a_indices, uint32_t a_indexCount)
+{
+    MeshOptimizerStats stats;
+    stats.VertexCountBefore = *a_vertexCount;
+    stats.ACMRBefore = GetACMR(a_indices, a_indexCount, *a_vertexCount);
+
+    uint32_t vertexCount = Deduplicate(a_vertices, *a_vertexCount, a_vertexStride, a_indices, a_indexCount);
+
+    std::vector<uint32_t> clusters;
+    OptimizeVertexCache(a_indices, a_indexCount, vertexCount, &clusters);
+    OptimizeOverdraw(a_indices, a_indexCount, a_vertices, vertexCount, a_vertexStride, a_positionOffset, clusters);
+
+    // Has to be last as it depends on the final triangle order
+    vertexCount = OptimizeVertexFetch(a_vertices, vertexCount, a_vertexStride, a_indices, a_indexCount);
+
+    *a_vertexCount = vertexCount;
+
+    stats.VertexCountAfter = vertexCount;
+    stats.ACMRAfter = GetACMR(a_indices, a_indexCount, vertexCount);
+
+    return stats;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
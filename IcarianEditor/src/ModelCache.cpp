@@ -0,0 +1,280 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "Runtime/ModelCache.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "IO.h"
+
+static constexpr uint64_t SectionAlignment = 16;
+
+static uint64_t Align(uint64_t a_value)
+{
+    return (a_value + SectionAlignment - 1) & ~(SectionAlignment - 1);
+}
+
+ModelCacheFile::ModelCacheFile()
+{
+#ifdef WIN32
+    m_file = INVALID_HANDLE_VALUE;
+    m_mapping = NULL;
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+ModelCacheFile::~ModelCacheFile()
+{
+    Close();
+}
+
+bool ModelCacheFile::Validate(e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash) const
+{
+    if (m_size < sizeof(ModelCacheHeader))
+    {
+        return false;
+    }
+
+    const ModelCacheHeader* header = GetHeader();
+    if (header->Magic != ModelCache::Magic || header->Version != ModelCache::Version)
+    {
+        return false;
+    }
+
+    if (header->Type != a_type || header->ImportFlags != a_importFlags || header->SourceHash != a_sourceHash)
+    {
+        return false;
+    }
+
+    // Make sure a truncated or corrupt file can never hand out pointers past the end of the mapping
+    // Checked as offset then remaining size so garbage offsets cannot wrap around
+    const auto fits = [this](uint64_t a_offset, uint64_t a_size)
+    {
+        return a_offset <= m_size && a_size <= m_size - a_offset;
+    };
+
+    if (!fits(header->VertexOffset, (uint64_t)header->VertexCount * header->VertexStride) || !fits(header->IndexOffset, (uint64_t)header->IndexCount * sizeof(uint32_t)))
+    {
+        return false;
+    }
+
+    if (!fits(header->BoneOffset, (uint64_t)header->BoneCount * sizeof(ModelCacheBone)) || !fits(header->NameOffset, header->NameSize))
+    {
+        return false;
+    }
+
+    // Bone names get handed out as views into the name block so each one has to stay inside it
+    const ModelCacheBone* bones = GetBones();
+    for (uint32_t i = 0; i < header->BoneCount; ++i)
+    {
+        if ((uint64_t)bones[i].NameOffset + bones[i].NameLength > header->NameSize)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ModelCacheFile::Open(const std::filesystem::path& a_path, e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash)
+{
+    Close();
+
+#ifdef WIN32
+    m_file = CreateFileW(a_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size) || size.QuadPart <= 0)
+    {
+        Close();
+
+        return false;
+    }
+
+    m_mapping = CreateFileMappingW(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m_mapping == NULL)
+    {
+        Close();
+
+        return false;
+    }
+
+    m_data = (const uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (m_data == nullptr)
+    {
+        Close();
+
+        return false;
+    }
+
+    m_size = (uint64_t)size.QuadPart;
+#else
+    const int fd = open(a_path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+
+        return false;
+    }
+
+    void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // Mapping holds its own reference to the file
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    m_data = (const uint8_t*)data;
+    m_size = (uint64_t)st.st_size;
+#endif
+
+    if (!Validate(a_type, a_importFlags, a_sourceHash))
+    {
+        Close();
+
+        return false;
+    }
+
+    return true;
+}
+void ModelCacheFile::Close()
+{
+#ifdef WIN32
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != NULL)
+    {
+        CloseHandle(m_mapping);
+        m_mapping = NULL;
+    }
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+        m_file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (m_data != nullptr)
+    {
+        munmap((void*)m_data, (size_t)m_size);
+    }
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+std::filesystem::path ModelCache::GetCacheFile(const std::filesystem::path& a_cachePath, uint64_t a_sourceHash, e_ModelCacheType a_type, uint32_t a_importFlags, uint32_t a_index)
+{
+    char name[96];
+    snprintf(name, sizeof(name), "%016llx_%u_%08x_%u.icmdl", (unsigned long long)a_sourceHash, (uint32_t)a_type, a_importFlags, a_index);
+
+    return a_cachePath / "Models" / name;
+}
+
+bool ModelCache::WriteMesh(const std::filesystem::path& a_path, e_ModelCacheType a_type, uint32_t a_importFlags, uint64_t a_sourceHash, const void* a_vertices, uint32_t a_vertexCount, uint32_t a_vertexStride, const uint32_t* a_indices, uint32_t a_indexCount, float a_radiusSqr)
+{
+    const uint64_t vertexSize = (uint64_t)a_vertexCount * a_vertexStride;
+    const uint64_t indexSize = (uint64_t)a_indexCount * sizeof(uint32_t);
+
+    ModelCacheHeader header = { 0 };
+    header.Magic = Magic;
+    header.Version = Version;
+    header.Type = a_type;
+    header.ImportFlags = a_importFlags;
+    header.SourceHash = a_sourceHash;
+    header.VertexStride = a_vertexStride;
+    header.VertexCount = a_vertexCount;
+    header.IndexCount = a_indexCount;
+    header.RadiusSqr = a_radiusSqr;
+    header.VertexOffset = Align(sizeof(ModelCacheHeader));
+    header.IndexOffset = Align(header.VertexOffset + vertexSize);
+    header.BoneOffset = Align(header.IndexOffset + indexSize);
+    header.NameOffset = header.BoneOffset;
+
+    std::vector<uint8_t> data = std::vector<uint8_t>((size_t)header.NameOffset, 0);
+    memcpy(data.data(), &header, sizeof(ModelCacheHeader));
+    memcpy(data.data() + header.VertexOffset, a_vertices, (size_t)vertexSize);
+    memcpy(data.data() + header.IndexOffset, a_indices, (size_t)indexSize);
+
+    return IO::WriteFileAtomic(a_path, { { data.data(), (uint32_t)data.size() } });
+}
+bool ModelCache::WriteBones(const std::filesystem::path& a_path, uint32_t a_importFlags, uint64_t a_sourceHash, const std::vector<ModelCacheBone>& a_bones, const std::vector<std::string>& a_names)
+{
+    const uint32_t boneCount = (uint32_t)a_bones.size();
+
+    std::vector<ModelCacheBone> bones = a_bones;
+    std::string names;
+    for (uint32_t i = 0; i < boneCount; ++i)
+    {
+        bones[i].NameOffset = (uint32_t)names.size();
+        bones[i].NameLength = (uint32_t)a_names[i].size();
+
+        names += a_names[i];
+    }
+
+    ModelCacheHeader header = { 0 };
+    header.Magic = Magic;
+    header.Version = Version;
+    header.Type = ModelCacheType_Bones;
+    header.ImportFlags = a_importFlags;
+    header.SourceHash = a_sourceHash;
+    header.BoneCount = boneCount;
+    header.NameSize = (uint32_t)names.size();
+    header.VertexOffset = Align(sizeof(ModelCacheHeader));
+    header.IndexOffset = header.VertexOffset;
+    header.BoneOffset = header.VertexOffset;
+    header.NameOffset = Align(header.BoneOffset + (uint64_t)boneCount * sizeof(ModelCacheBone));
+
+    std::vector<uint8_t> data = std::vector<uint8_t>((size_t)(header.NameOffset + header.NameSize), 0);
+    memcpy(data.data(), &header, sizeof(ModelCacheHeader));
+    memcpy(data.data() + header.BoneOffset, bones.data(), (size_t)boneCount * sizeof(ModelCacheBone));
+    memcpy(data.data() + header.NameOffset, names.data(), names.size());
+
+    return IO::WriteFileAtomic(a_path, { { data.data(), (uint32_t)data.size() } });
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
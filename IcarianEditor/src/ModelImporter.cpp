@@ -0,0 +1,708 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "Runtime/ModelImporter.h"
+
+#include <algorithm>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "Core/IcarianDefer.h"
+#include "Hash.h"
+#include "Logger.h"
+#include "Runtime/MeshOptimizer.h"
+
+#include "EngineModelInteropStructures.h"
+
+static constexpr uint32_t MeshImportFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices;
+
+static void LoadMesh(const aiMesh* a_mesh, std::vector<Vertex>* a_vertices, std::vector<uint32_t>* a_indices, float* a_rSqr)
+{
+    const bool hasNormals = a_mesh->HasNormals();
+    const bool hasTexCoordsA = a_mesh->HasTextureCoords(0);
+    const bool hasTexCoordsB = a_mesh->HasTextureCoords(1);
+    const bool hasColour = a_mesh->HasVertexColors(0);
+
+    // Callers reserve for the whole scene up front when loading every mesh so this only allocates for single meshes
+    a_vertices->reserve(a_vertices->size() + a_mesh->mNumVertices);
+    a_indices->reserve(a_indices->size() + (size_t)a_mesh->mNumFaces * 3);
+
+    for (uint32_t i = 0; i < a_mesh->mNumVertices; ++i) 
+    {
+        Vertex v;
+
+        const aiVector3D& pos = a_mesh->mVertices[i];
+        v.Position = glm::vec4(pos.x, -pos.y, pos.z, 1.0f);
+
+        *a_rSqr = glm::max(pos.SquareLength(), *a_rSqr);
+
+        if (hasNormals) 
+        {
+            const aiVector3D& norm = a_mesh->mNormals[i];
+            v.Normal = glm::vec3(norm.x, -norm.y, norm.z);
+        }
+
+        if (hasTexCoordsA) 
+        {
+            const aiVector3D& uv = a_mesh->mTextureCoords[0][i];
+            v.TexCoordsA = glm::vec2(uv.x, uv.y);
+        }
+
+        if (hasTexCoordsB)
+        {
+            const aiVector3D& uv = a_mesh->mTextureCoords[1][i];
+            v.TexCoordsB = glm::vec2(uv.x, uv.y);
+        }
+
+        if (hasColour) 
+        {
+            const aiColor4D& colour = a_mesh->mColors[0][i];
+            v.Color = glm::vec4(colour.r, colour.g, colour.b, colour.a);
+        }
+
+        a_vertices->emplace_back(v);
+    }
+
+    for (uint32_t i = 0; i < a_mesh->mNumFaces; ++i) 
+    {
+        const aiFace& face = a_mesh->mFaces[i];
+
+        a_indices->emplace_back(face.mIndices[0]);
+        a_indices->emplace_back(face.mIndices[2]);
+        a_indices->emplace_back(face.mIndices[1]);
+    }
+}
+
+static void LogMeshOptimizerStats(const std::string_view& a_path, const MeshOptimizerStats& a_stats)
+{
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "Optimised mesh: %.*s, vertices %u -> %u, ACMR %.3f -> %.3f", (int)a_path.size(), a_path.data(), a_stats.VertexCountBefore, a_stats.VertexCountAfter, a_stats.ACMRBefore, a_stats.ACMRAfter);
+
+    Logger::Message(buffer);
+}
+
+template<typename T>
+static void ReserveSceneMeshes(const aiScene* a_scene, uint8_t a_data, std::vector<T>* a_vertices, std::vector<uint32_t>* a_indices)
+{
+    // Single meshes reserve themselves
+    if (a_data != std::numeric_limits<uint8_t>::max())
+    {
+        return;
+    }
+
+    size_t vertexCount = 0;
+    size_t indexCount = 0;
+    for (uint32_t i = 0; i < a_scene->mNumMeshes; ++i)
+    {
+        const aiMesh* mesh = a_scene->mMeshes[i];
+
+        vertexCount += mesh->mNumVertices;
+        indexCount += (size_t)mesh->mNumFaces * 3;
+    }
+
+    a_vertices->reserve(vertexCount);
+    a_indices->reserve(indexCount);
+}
+
+static void WalkTreeMesh(const aiScene* a_scene, const aiNode* a_node, uint8_t a_data, std::vector<Vertex>* a_vertices, std::vector<uint32_t>* a_indices, float* a_radSqr, uint8_t* a_index)
+{
+    if (a_data == std::numeric_limits<uint8_t>::max())
+    {
+        for (uint32_t i = 0; i < a_node->mNumMeshes; ++i)
+        {
+            LoadMesh(a_scene->mMeshes[a_node->mMeshes[i]], a_vertices, a_indices, a_radSqr);
+        }
+    }
+    else 
+    {
+        if (*a_index > a_data)
+        {
+            return;
+        }
+
+        if (a_data < *a_index + a_node->mNumMeshes)
+        {
+            LoadMesh(a_scene->mMeshes[a_node->mMeshes[a_data - *a_index]], a_vertices, a_indices, a_radSqr);
+            *a_index = std::numeric_limits<uint8_t>::max();
+
+            return;
+        }
+
+        *a_index += a_node->mNumMeshes;
+    }
+
+    for (uint32_t i = 0; i < a_node->mNumChildren; ++i)
+    {
+        WalkTreeMesh(a_scene, a_node->mChildren[i], a_data, a_vertices, a_indices, a_radSqr, a_index);
+    }
+}
+
+static void LoadSkinnedMesh(const aiMesh* a_mesh, std::vector<SkinnedVertex>* a_vertices, std::vector<uint32_t>* a_indices, const std::unordered_map<std::string, int>& a_boneMap, float* a_rSqr)
+{
+    a_vertices->reserve(a_vertices->size() + a_mesh->mNumVertices);
+    a_indices->reserve(a_indices->size() + (size_t)a_mesh->mNumFaces * 3);
+
+    for (uint32_t i = 0; i < a_mesh->mNumVertices; ++i) 
+    {
+        SkinnedVertex v;
+
+        const aiVector3D& pos = a_mesh->mVertices[i];
+        v.Position = glm::vec4(pos.x, -pos.y, pos.z, 1.0f);
+
+        *a_rSqr = glm::max(pos.SquareLength(), *a_rSqr);
+
+        if (a_mesh->HasNormals()) 
+        {
+            const aiVector3D& norm = a_mesh->mNormals[i];
+            v.Normal = glm::vec3(norm.x, -norm.y, norm.z);
+        }
+
+        if (a_mesh->HasTextureCoords(0)) 
+        {
+            const aiVector3D& uv = a_mesh->mTextureCoords[0][i];
+            v.TexCoords = glm::vec2(uv.x, uv.y);
+        }
+
+        if (a_mesh->HasVertexColors(0)) 
+        {
+            const aiColor4D& colour = a_mesh->mColors[0][i];
+            v.Color = glm::vec4(colour.r, colour.g, colour.b, colour.a);
+        }
+
+        if (a_mesh->HasBones())
+        {
+            const aiBone* bone = a_mesh->mBones[i];
+
+            const uint32_t weights = glm::min(uint32_t(4), (uint32_t)bone->mNumWeights);
+            for (uint32_t j = 0; j < weights; ++j)
+            {
+                const auto iter = a_boneMap.find(bone->mName.C_Str());
+                if (iter == a_boneMap.end())
+                {
+                    continue;
+                }
+
+                v.BoneIndices[j] = iter->second;
+                v.BoneWeights[j] = bone->mWeights[j].mWeight;
+            }
+        }
+
+        a_vertices->emplace_back(v);
+    }
+
+    for (uint32_t i = 0; i < a_mesh->mNumFaces; ++i) 
+    {
+        const aiFace& face = a_mesh->mFaces[i];
+
+        a_indices->emplace_back(face.mIndices[0]);
+        a_indices->emplace_back(face.mIndices[2]);
+        a_indices->emplace_back(face.mIndices[1]);
+    }
+}
+
+static void WalkTreeSkinned(const aiScene* a_scene, const aiNode* a_node, uint8_t a_data, std::vector<SkinnedVertex>* a_vertices, std::vector<uint32_t>* a_indices, const std::unordered_map<std::string, int>& a_boneMap, float* a_radSqr, uint8_t* a_index)
+{
+    if (a_data == std::numeric_limits<uint8_t>::max())
+    {
+        for (uint32_t i = 0; i < a_node->mNumMeshes; ++i)
+        {
+            LoadSkinnedMesh(a_scene->mMeshes[a_node->mMeshes[i]], a_vertices, a_indices, a_boneMap, a_radSqr);
+        }
+    }
+    else
+    {
+        if (*a_index > a_data)
+        {
+            return;
+        }
+
+        if (a_data < *a_index + a_node->mNumMeshes)
+        {
+            LoadSkinnedMesh(a_scene->mMeshes[a_node->mMeshes[a_data - *a_index]], a_vertices, a_indices, a_boneMap, a_radSqr);
+            *a_index = std::numeric_limits<uint8_t>::max();
+
+            return;
+        }
+
+        *a_index += a_node->mNumMeshes;
+    }
+
+    for (uint32_t i = 0; i < a_node->mNumChildren; ++i)
+    {
+        WalkTreeSkinned(a_scene, a_node->mChildren[i], a_data, a_vertices, a_indices, a_boneMap, a_radSqr, a_index);
+    }
+}
+
+template<typename T>
+static void SetMeshResult(const std::vector<T>& a_vertices, std::vector<uint32_t>* a_indices, ModelImportResult* a_result)
+{
+    a_result->Valid = true;
+    a_result->VertexStride = (uint16_t)sizeof(T);
+    a_result->VertexCount = (uint32_t)a_vertices.size();
+    a_result->Vertices.assign((const uint8_t*)a_vertices.data(), (const uint8_t*)(a_vertices.data() + a_vertices.size()));
+    a_result->Indices = std::move(*a_indices);
+}
+
+static bool ReadMeshCache(const std::filesystem::path& a_path, e_ModelCacheType a_type, uint64_t a_hash, uint16_t a_vertexStride, ModelImportResult* a_result)
+{
+    ModelCacheFile cache;
+    if (!cache.Open(a_path, a_type, MeshImportFlags, a_hash))
+    {
+        return false;
+    }
+
+    const ModelCacheHeader* header = cache.GetHeader();
+    if (header->VertexStride != a_vertexStride)
+    {
+        return false;
+    }
+
+    const uint8_t* vertices = (const uint8_t*)cache.GetVertices();
+    const uint32_t* indices = cache.GetIndices();
+
+    a_result->Valid = true;
+    a_result->VertexStride = a_vertexStride;
+    a_result->VertexCount = header->VertexCount;
+    a_result->Vertices.assign(vertices, vertices + (uint64_t)header->VertexCount * a_vertexStride);
+    a_result->Indices.assign(indices, indices + header->IndexCount);
+
+    return true;
+}
+
+ModelImporter::ModelImporter()
+{
+    m_shutdown = false;
+
+    m_immediateImporter = new Assimp::Importer();
+
+    // Imports are almost entirely CPU bound so use most of the machine and leave a core for the main thread
+    const uint32_t workerCount = std::clamp(std::thread::hardware_concurrency(), 2U, 16U) - 1;
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&ModelImporter::Run, this);
+    }
+}
+ModelImporter::~ModelImporter()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_shutdown = true;
+    }
+    m_jobSignal.notify_all();
+
+    for (std::thread& thread : m_workers)
+    {
+        thread.join();
+    }
+
+    Clear();
+
+    delete m_immediateImporter;
+}
+
+void ModelImporter::ImportMesh(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result)
+{
+    const uint64_t hash = FNVHash(a_job.Data.data(), (uint64_t)a_job.Data.size());
+    const std::filesystem::path cachePath = ModelCache::GetCacheFile(a_job.CachePath, hash, ModelCacheType_Mesh, MeshImportFlags, a_job.Index);
+
+    if (ReadMeshCache(cachePath, ModelCacheType_Mesh, hash, (uint16_t)sizeof(Vertex), a_result))
+    {
+        return;
+    }
+
+    const std::string pathStr = a_job.Path.string();
+    const std::string extStr = a_job.Path.extension().string();
+
+    const aiScene* scene = a_importer->ReadFileFromMemory(a_job.Data.data(), a_job.Data.size(), MeshImportFlags, extStr.c_str() + 1);
+    if (scene == nullptr)
+    {
+        Logger::Error("Failed to import mesh: " + pathStr);
+
+        return;
+    }
+    IDEFER(a_importer->FreeScene());
+
+    const aiNode* root = scene->mRootNode;
+
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    ReserveSceneMeshes(scene, (uint8_t)a_job.Index, &vertices, &indices);
+
+    float radSqr = 0.0f;
+    uint8_t index = 0;
+    WalkTreeMesh(scene, root, (uint8_t)a_job.Index, &vertices, &indices, &radSqr, &index);
+
+    if (vertices.empty() || indices.empty() || radSqr <= 0.0f)
+    {
+        Logger::Warning("Empty model: " + pathStr);
+
+        return;
+    }
+
+    // Only paid on import as the optimised result is what goes into the cache
+    const MeshOptimizerStats stats = MeshOptimizer::Optimize(&vertices, &indices, (uint32_t)offsetof(Vertex, Position));
+    LogMeshOptimizerStats(pathStr, stats);
+
+    ModelCache::WriteMesh(cachePath, ModelCacheType_Mesh, MeshImportFlags, hash, vertices.data(), (uint32_t)vertices.size(), sizeof(Vertex), indices.data(), (uint32_t)indices.size(), radSqr);
+
+    SetMeshResult(vertices, &indices, a_result);
+}
+void ModelImporter::ImportSkinnedMesh(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result)
+{
+    const uint64_t hash = FNVHash(a_job.Data.data(), (uint64_t)a_job.Data.size());
+    const std::filesystem::path cachePath = ModelCache::GetCacheFile(a_job.CachePath, hash, ModelCacheType_SkinnedMesh, MeshImportFlags, a_job.Index);
+
+    if (ReadMeshCache(cachePath, ModelCacheType_SkinnedMesh, hash, (uint16_t)sizeof(SkinnedVertex), a_result))
+    {
+        return;
+    }
+
+    const std::string pathStr = a_job.Path.string();
+    const std::string extStr = a_job.Path.extension().string();
+
+    const aiScene* scene = a_importer->ReadFileFromMemory(a_job.Data.data(), a_job.Data.size(), MeshImportFlags, extStr.c_str() + 1);
+    if (scene == nullptr)
+    {
+        Logger::Error("Failed to import skinned mesh: " + pathStr);
+
+        return;
+    }
+    IDEFER(a_importer->FreeScene());
+
+    if (scene->mNumSkeletons <= 0)
+    {
+        Logger::Warning("No skeletons: " + pathStr);
+
+        return;
+    }
+
+    // Hic sunt dracones
+    // Compiler is being weird this is a dodgy hack
+    // This should not be broken and inserting the arguments directly should work and using a macro should not fix it but it does
+    // I think the compiler has had enough of my preprocessor shannigans
+    // DO NOT REMOVE otherwise compiler error on GCC and clang
+#define MCR_ImportSkinnedMesh_MAPKEYS std::string, int
+    std::unordered_map<MCR_ImportSkinnedMesh_MAPKEYS> boneMap;
+
+    const aiSkeleton* skeleton = scene->mSkeletons[0];
+    for (int i = 0; i < skeleton->mNumBones; ++i)
+    {
+        const aiSkeletonBone* bone = skeleton->mBones[i];
+        const std::string name = bone->mNode->mName.C_Str();
+
+        boneMap.emplace(name, i);
+    }
+
+    const aiNode* root = scene->mRootNode;
+
+    std::vector<SkinnedVertex> vertices;
+    std::vector<uint32_t> indices;
+    ReserveSceneMeshes(scene, (uint8_t)a_job.Index, &vertices, &indices);
+
+    float radSqr = 0.0f;
+    uint8_t index = 0;
+    WalkTreeSkinned(scene, root, (uint8_t)a_job.Index, &vertices, &indices, boneMap, &radSqr, &index);
+
+    if (vertices.empty() || indices.empty() || radSqr <= 0)
+    {
+        Logger::Warning("Empty Model: " + pathStr);
+
+        return;
+    }
+
+    const MeshOptimizerStats stats = MeshOptimizer::Optimize(&vertices, &indices, (uint32_t)offsetof(SkinnedVertex, Position));
+    LogMeshOptimizerStats(pathStr, stats);
+
+    ModelCache::WriteMesh(cachePath, ModelCacheType_SkinnedMesh, MeshImportFlags, hash, vertices.data(), (uint32_t)vertices.size(), sizeof(SkinnedVertex), indices.data(), (uint32_t)indices.size(), radSqr);
+
+    SetMeshResult(vertices, &indices, a_result);
+}
+void ModelImporter::ImportBones(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result)
+{
+    const uint64_t hash = FNVHash(a_job.Data.data(), (uint64_t)a_job.Data.size());
+    const std::filesystem::path cachePath = ModelCache::GetCacheFile(a_job.CachePath, hash, ModelCacheType_Bones, 0, 0);
+
+    ModelCacheFile cache;
+    if (cache.Open(cachePath, ModelCacheType_Bones, 0, hash))
+    {
+        const uint32_t boneCount = cache.GetHeader()->BoneCount;
+        const ModelCacheBone* cacheBones = cache.GetBones();
+
+        a_result->Valid = true;
+        a_result->Bones.assign(cacheBones, cacheBones + boneCount);
+        a_result->BoneNames.reserve(boneCount);
+        for (uint32_t i = 0; i < boneCount; ++i)
+        {
+            a_result->BoneNames.emplace_back(cache.GetBoneName(cacheBones[i]));
+        }
+
+        return;
+    }
+
+    const std::string extStr = a_job.Path.extension().string();
+
+    const aiScene* scene = a_importer->ReadFileFromMemory(a_job.Data.data(), a_job.Data.size(), 0, extStr.c_str() + 1);
+    if (scene == nullptr)
+    {
+        Logger::Error("Failed to import skeleton: " + a_job.Path.string());
+
+        return;
+    }
+    IDEFER(a_importer->FreeScene());
+
+    if (scene->mNumSkeletons > 0)
+    {
+        const aiSkeleton* skeleton = scene->mSkeletons[0];
+
+        const uint32_t boneCount = (uint32_t)skeleton->mNumBones;
+        a_result->Bones.reserve(boneCount);
+        a_result->BoneNames.reserve(boneCount);
+
+        for (uint32_t i = 0; i < boneCount; ++i)
+        {
+            const aiSkeletonBone* bone = skeleton->mBones[i];
+
+            aiMatrix4x4 bindPose = bone->mOffsetMatrix;
+            bindPose.Inverse();
+
+            ModelCacheBone cacheBone = { 0 };
+            for (uint32_t j = 0; j < 16; ++j)
+            {
+                cacheBone.BindPose[j] = bindPose[j / 4][j % 4];
+            }
+            cacheBone.Parent = (uint32_t)bone->mParent;
+
+            a_result->Bones.emplace_back(cacheBone);
+            a_result->BoneNames.emplace_back(bone->mNode->mName.C_Str());
+        }
+    }
+
+    // Files without a skeleton get cached as well so they are not imported again just to find that out
+    ModelCache::WriteBones(cachePath, 0, hash, a_result->Bones, a_result->BoneNames);
+
+    a_result->Valid = true;
+}
+void ModelImporter::ImportAnimation(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result)
+{
+    const std::string extStr = a_job.Path.extension().string();
+
+    const aiScene* scene = a_importer->ReadFileFromMemory(a_job.Data.data(), a_job.Data.size(), 0, extStr.c_str() + 1);
+    if (scene == nullptr)
+    {
+        Logger::Error("Failed to import animation clip: " + a_job.Path.string());
+
+        return;
+    }
+    IDEFER(a_importer->FreeScene());
+
+    a_result->Valid = true;
+
+    if (scene->mNumAnimations <= 0)
+    {
+        return;
+    }
+
+    const aiAnimation* animation = scene->mAnimations[0];
+
+    const uint32_t channelCount = (uint32_t)animation->mNumChannels;
+    a_result->Channels.reserve((size_t)channelCount * 3);
+
+    for (uint32_t i = 0; i < channelCount; ++i)
+    {
+        const aiNodeAnim* anim = animation->mChannels[i];
+
+        const uint32_t posCount = (uint32_t)anim->mNumPositionKeys;
+        if (posCount > 0)
+        {
+            ModelImportChannel channel;
+            channel.Name = anim->mNodeName.C_Str();
+            channel.Target = ModelImportTarget_Translation;
+            channel.Frames.reserve(posCount);
+
+            for (uint32_t j = 0; j < posCount; ++j)
+            {
+                const aiVectorKey& posKey = anim->mPositionKeys[j];
+
+                channel.Frames.emplace_back(ModelImportFrame{ (float)posKey.mTime, glm::vec4(posKey.mValue.x, -posKey.mValue.y, posKey.mValue.z, 1.0f) });
+            }
+
+            a_result->Channels.emplace_back(std::move(channel));
+        }
+
+        const uint32_t rotCount = (uint32_t)anim->mNumRotationKeys;
+        if (rotCount > 0)
+        {
+            ModelImportChannel channel;
+            channel.Name = anim->mNodeName.C_Str();
+            channel.Target = ModelImportTarget_Rotation;
+            channel.Frames.reserve(rotCount);
+
+            for (uint32_t j = 0; j < rotCount; ++j)
+            {
+                const aiQuatKey& rotKey = anim->mRotationKeys[j];
+
+                channel.Frames.emplace_back(ModelImportFrame{ (float)rotKey.mTime, glm::vec4(rotKey.mValue.x, -rotKey.mValue.y, rotKey.mValue.z, rotKey.mValue.w) });
+            }
+
+            a_result->Channels.emplace_back(std::move(channel));
+        }
+
+        const uint32_t scaleCount = (uint32_t)anim->mNumScalingKeys;
+        if (scaleCount > 0)
+        {
+            ModelImportChannel channel;
+            channel.Name = anim->mNodeName.C_Str();
+            channel.Target = ModelImportTarget_Scale;
+            channel.Frames.reserve(scaleCount);
+
+            for (uint32_t j = 0; j < scaleCount; ++j)
+            {
+                const aiVectorKey& scaleKey = anim->mScalingKeys[j];
+
+                channel.Frames.emplace_back(ModelImportFrame{ (float)scaleKey.mTime, glm::vec4(scaleKey.mValue.x, scaleKey.mValue.y, scaleKey.mValue.z, 0.0f) });
+            }
+
+            a_result->Channels.emplace_back(std::move(channel));
+        }
+    }
+}
+
+void ModelImporter::RunJob(Assimp::Importer* a_importer, const ImportJob& a_job, ModelImportResult* a_result)
+{
+    switch (a_job.Type)
+    {
+    case ModelImportType_Mesh:
+    {
+        ImportMesh(a_importer, a_job, a_result);
+
+        break;
+    }
+    case ModelImportType_SkinnedMesh:
+    {
+        ImportSkinnedMesh(a_importer, a_job, a_result);
+
+        break;
+    }
+    case ModelImportType_Bones:
+    {
+        ImportBones(a_importer, a_job, a_result);
+
+        break;
+    }
+    case ModelImportType_Animation:
+    {
+        ImportAnimation(a_importer, a_job, a_result);
+
+        break;
+    }
+    }
+}
+
+void ModelImporter::Run()
+{
+    // Importers are not thread safe but are fine to reuse so each worker keeps its own
+    Assimp::Importer importer;
+
+    while (true)
+    {
+        ImportJob job;
+
+        {
+            std::unique_lock l = std::unique_lock(m_jobLock);
+            m_jobSignal.wait(l, [this]() { return m_shutdown || !m_jobs.empty(); });
+
+            if (m_shutdown)
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        ModelImportResult result;
+        RunJob(&importer, job, &result);
+
+        job.Promise.set_value(std::move(result));
+    }
+}
+
+std::future<ModelImportResult> ModelImporter::Import(e_ModelImportType a_type, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, uint32_t a_index, const std::filesystem::path& a_cachePath)
+{
+    ImportJob job;
+    job.Type = a_type;
+    job.Index = a_index;
+    job.Path = a_path;
+    job.CachePath = a_cachePath;
+    job.Data.assign(a_data, a_data + a_size);
+
+    std::future<ModelImportResult> future = job.Promise.get_future();
+
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_jobs.emplace_back(std::move(job));
+    }
+    m_jobSignal.notify_one();
+
+    return future;
+}
+ModelImportResult ModelImporter::ImportImmediate(e_ModelImportType a_type, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, uint32_t a_index, const std::filesystem::path& a_cachePath)
+{
+    ImportJob job;
+    job.Type = a_type;
+    job.Index = a_index;
+    job.Path = a_path;
+    job.CachePath = a_cachePath;
+    job.Data.assign(a_data, a_data + a_size);
+
+    ModelImportResult result;
+
+    // Importer is kept around so repeat calls stay warm, lock is just in case it ever gets called off the main thread
+    const std::unique_lock l = std::unique_lock(m_immediateLock);
+
+    RunJob(m_immediateImporter, job, &result);
+
+    return result;
+}
+void ModelImporter::Clear()
+{
+    const std::unique_lock l = std::unique_lock(m_jobLock);
+
+    for (ImportJob& job : m_jobs)
+    {
+        job.Promise.set_value(ModelImportResult());
+    }
+
+    m_jobs.clear();
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
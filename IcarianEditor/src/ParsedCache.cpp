@@ -0,0 +1,95 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "ParsedCache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Hash.h"
+#include "IO.h"
+
+uint64_t ParsedCache::HashSource(const std::filesystem::path& a_path, const uint8_t* a_data, uint64_t a_size)
+{
+    // Path goes in as well as defs loaded from the file carry it
+    const std::string pathStr = a_path.generic_u8string();
+
+    const uint64_t pathHash = FNVHash(pathStr.data(), pathStr.size());
+
+    return FNVHash(a_data, a_size, pathHash);
+}
+std::filesystem::path ParsedCache::GetCacheFile(const std::filesystem::path& a_cachePath, const std::filesystem::path& a_path, e_ParsedCacheType a_type)
+{
+    const std::string pathStr = a_path.generic_u8string();
+
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx_%u.icpc", (unsigned long long)FNVHash(pathStr.data(), pathStr.size()), (uint32_t)a_type);
+
+    return a_cachePath / "Parsed" / name;
+}
+
+bool ParsedCache::Read(const std::filesystem::path& a_path, e_ParsedCacheType a_type, uint64_t a_sourceHash, std::vector<uint8_t>* a_payload)
+{
+    std::ifstream file = std::ifstream(a_path, std::ios::binary);
+    if (!file.good())
+    {
+        return false;
+    }
+
+    ParsedCacheHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file.good() || header.Magic != Magic || header.Version != Version || header.Type != a_type || header.SourceHash != a_sourceHash)
+    {
+        return false;
+    }
+
+    a_payload->resize(header.PayloadSize);
+    file.read((char*)a_payload->data(), (std::streamsize)header.PayloadSize);
+    if (!file.good() || FNVHash(a_payload->data(), a_payload->size()) != header.PayloadHash)
+    {
+        a_payload->clear();
+
+        return false;
+    }
+
+    return true;
+}
+bool ParsedCache::Write(const std::filesystem::path& a_path, e_ParsedCacheType a_type, uint64_t a_sourceHash, const uint8_t* a_payload, uint32_t a_size)
+{
+    const ParsedCacheHeader header =
+    {
+        .Magic = Magic,
+        .Version = Version,
+        .Type = a_type,
+        .PayloadSize = a_size,
+        .SourceHash = a_sourceHash,
+        .PayloadHash = FNVHash(a_payload, a_size)
+    };
+
+    return IO::WriteFileAtomic(a_path, { { &header, sizeof(header) }, { a_payload, a_size } });
+}
+
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -674,19 +674,19 @@ void ProcessManager::PollMessage(bool a_blockError)
             {
             case LoggerMessageType_Message:
             {
-                Logger::Message(str, false, false);
+                Logger::Message(str, LoggerMessageSource_Engine, false);
 
                 break;
             }
             case LoggerMessageType_Warning:
             {
-                Logger::Warning(str, false, false);
+                Logger::Warning(str, LoggerMessageSource_Engine, false);
 
                 break;
             }
             case LoggerMessageType_Error:
             {
-                Logger::Error(str, false, false);
+                Logger::Error(str, LoggerMessageSource_Engine, false);
 
                 break;
             }
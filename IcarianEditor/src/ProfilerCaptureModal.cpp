@@ -0,0 +1,175 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "Modals/ProfilerCaptureModal.h"
+
+#include <imgui.h>
+
+#include "AppMain.h"
+#include "FileDialogBlock.h"
+#include "Modals/ErrorModal.h"
+#include "ProfilerData.h"
+
+constexpr static const char* const TraceFilters[] = { ".json", "*" };
+constexpr uint32_t TraceFilterCount = sizeof(TraceFilters) / sizeof(*TraceFilters);
+
+constexpr static const char* const CaptureFilters[] = { ".icprof", "*" };
+constexpr uint32_t CaptureFilterCount = sizeof(CaptureFilters) / sizeof(*CaptureFilters);
+
+static const char* GetTitle(e_ProfilerCaptureMode a_mode)
+{
+    switch (a_mode)
+    {
+    case ProfilerCaptureMode_ExportTrace:
+    {
+        return "Export Trace";
+    }
+    case ProfilerCaptureMode_Save:
+    {
+        return "Save Capture";
+    }
+    case ProfilerCaptureMode_Load:
+    {
+        return "Load Capture";
+    }
+    }
+
+    return "Profiler Capture";
+}
+
+ProfilerCaptureModal::ProfilerCaptureModal(AppMain* a_app, e_ProfilerCaptureMode a_mode) : Modal(GetTitle(a_mode), glm::vec2(640, 480))
+{
+    m_app = a_app;
+    m_mode = a_mode;
+
+    if (m_mode == ProfilerCaptureMode_ExportTrace)
+    {
+        m_fileDialogBlock = new FileDialogBlock(glm::vec2(-1, -1), false, TraceFilterCount, TraceFilters);
+    }
+    else
+    {
+        m_fileDialogBlock = new FileDialogBlock(glm::vec2(-1, -1), false, CaptureFilterCount, CaptureFilters);
+    }
+}
+ProfilerCaptureModal::~ProfilerCaptureModal()
+{
+    delete m_fileDialogBlock;
+}
+
+bool ProfilerCaptureModal::Update()
+{
+    std::filesystem::path path;
+    std::string name;
+
+    const e_FileDialogStatus status = m_fileDialogBlock->ShowFileDialog(&path, &name);
+
+    switch (status)
+    {
+    case FileDialogStatus_Ok:
+    {
+        if (!std::filesystem::exists(path))
+        {
+            m_app->PushModal(new ErrorModal("Directory does not exist"));
+
+            return true;
+        }
+
+        if (name.empty())
+        {
+            m_app->PushModal(new ErrorModal("Invalid Name"));
+
+            return true;
+        }
+
+        std::filesystem::path filePath = path / name;
+
+        switch (m_mode)
+        {
+        case ProfilerCaptureMode_ExportTrace:
+        {
+            if (!filePath.has_extension())
+            {
+                filePath.replace_extension(".json");
+            }
+
+            if (!ProfilerData::ExportChromeTrace(filePath))
+            {
+                m_app->PushModal(new ErrorModal("Failed to export trace"));
+
+                return true;
+            }
+
+            break;
+        }
+        case ProfilerCaptureMode_Save:
+        {
+            if (!filePath.has_extension())
+            {
+                filePath.replace_extension(".icprof");
+            }
+
+            if (!ProfilerData::SaveCapture(filePath))
+            {
+                m_app->PushModal(new ErrorModal("Failed to save capture"));
+
+                return true;
+            }
+
+            break;
+        }
+        case ProfilerCaptureMode_Load:
+        {
+            if (!ProfilerData::LoadCapture(filePath))
+            {
+                m_app->PushModal(new ErrorModal("Failed to load capture"));
+
+                return true;
+            }
+
+            break;
+        }
+        }
+
+        return false;
+    }
+    case FileDialogStatus_Error:
+    {
+        m_app->PushModal(new ErrorModal("File dialog error"));
+
+        break;
+    }
+    case FileDialogStatus_Cancel:
+    {
+        return false;
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return true;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -4,6 +4,29 @@
 
 #include "ProfilerData.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "Core/IcarianDefer.h"
+#include "Logger.h"
+
+// The engine reports frame times in milliseconds and the trace format expects microseconds
+static constexpr double ProfileTimeToMicroseconds = 1000.0;
+
+static constexpr char ProfileCaptureMagic[4] = { 'I', 'C', 'P', 'F' };
+static constexpr uint32_t ProfileCaptureVersion = 2;
+
+struct ProfileCaptureHeader
+{
+    char Magic[4];
+    uint32_t Version;
+    uint32_t ScopeSize;
+    uint32_t SnapshotCount;
+};
+
 ProfilerData* ProfilerData::Instance = nullptr;
 
 ProfilerData::ProfilerData()
@@ -36,7 +59,7 @@ void ProfilerData::Clear()
     Instance->m_snapshots.clear();
 }
 
-void ProfilerData::PushData(const ProfileScope& a_scope)
+void ProfilerData::PushData(const ProfileScope& a_scope, e_ProfileUnit a_unit)
 {
     // Realised that dynamic memory was too slow so doing a rotating array
     // Overwrite the old value when data gets too old
@@ -46,9 +69,18 @@ void ProfilerData::PushData(const ProfileScope& a_scope)
     // Should now hopefully be fast enough for the ~1000 calls a second I need
     for (ProfileSnapshot& snapshot : Instance->m_snapshots)
     {
-        if (snapshot.Name == a_scope.Name)
+        // Name is not terminated when it fills the buffer
+        if (strncmp(snapshot.Name.c_str(), a_scope.Name, ProfileNameMax) == 0)
         {
+            // When full the slot being written holds the oldest scope so drop it from the rolling statistics first
+            if (snapshot.Count >= ProfileMaxScopes)
+            {
+                RemoveStatistics(&snapshot, snapshot.Scopes[snapshot.Index]);
+            }
+
             snapshot.Scopes[snapshot.Index] = a_scope;
+            BuildHierarchy(a_scope, &snapshot.Hierarchy);
+            AddStatistics(&snapshot, a_scope);
 
             snapshot.Index = (snapshot.Index + 1) % ProfileMaxScopes;
             if (snapshot.Index == snapshot.StartIndex)
@@ -64,17 +96,418 @@ void ProfilerData::PushData(const ProfileScope& a_scope)
 
     // Stack is too small on windows and will crash so have to do everything on heap memory
     ProfileSnapshot& snapshot = Instance->m_snapshots.emplace_back();
-    snapshot.Name = a_scope.Name;
+    snapshot.Name = std::string(a_scope.Name, strnlen(a_scope.Name, ProfileNameMax));
     snapshot.Index = 1;
     snapshot.StartIndex = 0;
     snapshot.Count = 1;
+    snapshot.Unit = a_unit;
     snapshot.Scopes[0] = a_scope;
+    BuildHierarchy(a_scope, &snapshot.Hierarchy);
+
+    memset(snapshot.Statistics, 0, sizeof(snapshot.Statistics));
+    AddStatistics(&snapshot, a_scope);
 }
-std::vector<ProfileSnapshot> ProfilerData::GetSnapshots()
+const std::vector<ProfileSnapshot>& ProfilerData::GetSnapshots()
 {
     return Instance->m_snapshots;
 }
 
+void ProfilerData::BuildHierarchy(const ProfileScope& a_scope, ProfileHierarchy* a_hierarchy)
+{
+    // Frames are pushed depth first so the parent of a frame is the last frame seen one level up the stack
+    // Done once when the data arrives instead of rescanning the frames every time it is drawn
+    uint16_t lastAtDepth[UINT8_MAX + 1];
+    for (uint32_t i = 0; i <= UINT8_MAX; ++i)
+    {
+        lastAtDepth[i] = ProfileNoParent;
+    }
+
+    const uint16_t frameCount = std::min(a_scope.FrameCount, (uint16_t)ProfileFrameMax);
+    a_hierarchy->FrameCount = frameCount;
+
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        const uint8_t stack = a_scope.Frames[i].Stack;
+
+        a_hierarchy->Parents[i] = ProfileNoParent;
+        if (stack > 1)
+        {
+            a_hierarchy->Parents[i] = lastAtDepth[stack - 1];
+        }
+
+        a_hierarchy->ChildCount[i] = 0;
+
+        lastAtDepth[stack] = i;
+        if (stack < UINT8_MAX)
+        {
+            lastAtDepth[stack + 1] = ProfileNoParent;
+        }
+    }
+
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        const uint16_t parent = a_hierarchy->Parents[i];
+        if (parent != ProfileNoParent)
+        {
+            ++a_hierarchy->ChildCount[parent];
+        }
+    }
+
+    uint16_t offset = 0;
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        a_hierarchy->ChildStart[i] = offset;
+        offset += a_hierarchy->ChildCount[i];
+
+        a_hierarchy->ChildCount[i] = 0;
+    }
+
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        const uint16_t parent = a_hierarchy->Parents[i];
+        if (parent != ProfileNoParent)
+        {
+            a_hierarchy->Children[a_hierarchy->ChildStart[parent] + a_hierarchy->ChildCount[parent]++] = i;
+        }
+    }
+}
+
+static void ResetStatistics(ProfileStatistics* a_statistics, const char* a_name)
+{
+    memset(a_statistics, 0, sizeof(ProfileStatistics));
+    strncpy(a_statistics->Name, a_name, ProfileNameMax);
+}
+
+static bool IsStatisticsFrame(const ProfileStatistics& a_statistics, const ProfileFrame& a_frame)
+{
+    return strncmp(a_statistics.Name, a_frame.Name, ProfileNameMax) == 0;
+}
+
+uint32_t ProfilerData::GetHistogramBucket(float a_time)
+{
+    static const float LogMin = std::log(ProfileHistogramMinTime);
+    static const float BucketScale = ProfileHistogramBuckets / (std::log(ProfileHistogramMaxTime) - LogMin);
+
+    if (!(a_time > ProfileHistogramMinTime))
+    {
+        return 0;
+    }
+
+    const uint32_t bucket = (uint32_t)((std::log(a_time) - LogMin) * BucketScale);
+
+    return std::min(bucket, (uint32_t)ProfileHistogramBuckets - 1);
+}
+float ProfilerData::GetHistogramBucketTime(uint32_t a_bucket)
+{
+    static const float LogMin = std::log(ProfileHistogramMinTime);
+    static const float BucketSize = (std::log(ProfileHistogramMaxTime) - LogMin) / ProfileHistogramBuckets;
+
+    return std::exp(LogMin + a_bucket * BucketSize);
+}
+float ProfilerData::GetQuantile(const ProfileStatistics& a_statistics, float a_quantile)
+{
+    if (a_statistics.Count <= 0)
+    {
+        return 0.0f;
+    }
+
+    const uint32_t rank = (uint32_t)(a_quantile * (a_statistics.Count - 1));
+
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < ProfileHistogramBuckets; ++i)
+    {
+        count += a_statistics.Buckets[i];
+        if (count > rank)
+        {
+            // Geometric center of the bucket clamped to the exact extremes as the outer buckets are open ended
+            const float time = std::sqrt(GetHistogramBucketTime(i) * GetHistogramBucketTime(i + 1));
+
+            return std::clamp(time, a_statistics.Min, a_statistics.Max);
+        }
+    }
+
+    return a_statistics.Max;
+}
+
+void ProfilerData::AddStatistics(ProfileSnapshot* a_snapshot, const ProfileScope& a_scope)
+{
+    const uint16_t frameCount = std::min(a_scope.FrameCount, (uint16_t)ProfileFrameMax);
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        const ProfileFrame& frame = a_scope.Frames[i];
+        ProfileStatistics& statistics = a_snapshot->Statistics[i];
+
+        // Frame layout changed so the old values no longer mean anything
+        if (!IsStatisticsFrame(statistics, frame))
+        {
+            ResetStatistics(&statistics, frame.Name);
+        }
+
+        if (statistics.Count <= 0)
+        {
+            statistics.Min = frame.Time;
+            statistics.Max = frame.Time;
+        }
+        else
+        {
+            statistics.Min = std::min(statistics.Min, frame.Time);
+            statistics.Max = std::max(statistics.Max, frame.Time);
+        }
+
+        ++statistics.Count;
+        statistics.Sum += frame.Time;
+        ++statistics.Buckets[GetHistogramBucket(frame.Time)];
+    }
+}
+void ProfilerData::RemoveStatistics(ProfileSnapshot* a_snapshot, const ProfileScope& a_scope)
+{
+    const uint16_t frameCount = std::min(a_scope.FrameCount, (uint16_t)ProfileFrameMax);
+    for (uint16_t i = 0; i < frameCount; ++i)
+    {
+        const ProfileFrame& frame = a_scope.Frames[i];
+        ProfileStatistics& statistics = a_snapshot->Statistics[i];
+
+        if (statistics.Count <= 0 || !IsStatisticsFrame(statistics, frame))
+        {
+            continue;
+        }
+
+        const uint32_t bucket = GetHistogramBucket(frame.Time);
+        if (statistics.Buckets[bucket] <= 0)
+        {
+            continue;
+        }
+
+        --statistics.Count;
+        statistics.Sum -= frame.Time;
+        --statistics.Buckets[bucket];
+
+        if (statistics.Count <= 0)
+        {
+            statistics.Sum = 0.0;
+
+            continue;
+        }
+
+        // Extremes can only be recovered by rescanning so only do it when the value leaving was one
+        // The scope leaving is still in its slot at this point so skip it rather then rely on where the start is
+        if (frame.Time <= statistics.Min || frame.Time >= statistics.Max)
+        {
+            statistics.Min = std::numeric_limits<float>::max();
+            statistics.Max = 0.0f;
+
+            for (uint32_t j = 0; j < a_snapshot->Count; ++j)
+            {
+                const uint32_t slot = (a_snapshot->StartIndex + j) % ProfileMaxScopes;
+                if (slot == a_snapshot->Index)
+                {
+                    continue;
+                }
+
+                const ProfileScope& scope = a_snapshot->Scopes[slot];
+                if (i >= scope.FrameCount || !IsStatisticsFrame(statistics, scope.Frames[i]))
+                {
+                    continue;
+                }
+
+                statistics.Min = std::min(statistics.Min, scope.Frames[i].Time);
+                statistics.Max = std::max(statistics.Max, scope.Frames[i].Time);
+            }
+        }
+    }
+}
+
+static void WriteJSONString(std::ofstream& a_stream, const char* a_str, uint32_t a_maxLen)
+{
+    a_stream << '"';
+
+    for (uint32_t i = 0; i < a_maxLen && a_str[i] != 0; ++i)
+    {
+        const char c = a_str[i];
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        {
+            a_stream << '\\' << c;
+
+            break;
+        }
+        default:
+        {
+            if (c >= ' ')
+            {
+                a_stream << c;
+            }
+
+            break;
+        }
+        }
+    }
+
+    a_stream << '"';
+}
+
+bool ProfilerData::ExportChromeTrace(const std::filesystem::path& a_path)
+{
+    std::ofstream stream = std::ofstream(a_path);
+    if (!stream.good() || !stream.is_open())
+    {
+        Logger::Error("Failed to open profiler trace: " + a_path.string());
+
+        return false;
+    }
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    ProfileHierarchy hierarchy;
+    double frameStart[ProfileFrameMax];
+    double childCursor[ProfileFrameMax];
+
+    const uint32_t snapshotCount = (uint32_t)Instance->m_snapshots.size();
+    for (uint32_t i = 0; i < snapshotCount; ++i)
+    {
+        const ProfileSnapshot& snapshot = Instance->m_snapshots[i];
+
+        // Counters have no duration so would just turn into nonsense slices
+        if (snapshot.Unit != ProfileUnit_Milliseconds)
+        {
+            continue;
+        }
+
+        if (!first)
+        {
+            stream << ",";
+        }
+        first = false;
+
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"args\":{\"name\":";
+        WriteJSONString(stream, snapshot.Name.c_str(), (uint32_t)snapshot.Name.size());
+        stream << "}}";
+
+        // Only durations are sent by the engine so scopes are laid end to end and children are packed from the start of their parent
+        double time = 0.0;
+        for (uint32_t j = 0; j < snapshot.Count; ++j)
+        {
+            const ProfileScope& scope = snapshot.Scopes[(snapshot.StartIndex + j) % ProfileMaxScopes];
+            BuildHierarchy(scope, &hierarchy);
+
+            double rootCursor = time;
+            for (uint16_t k = 0; k < hierarchy.FrameCount; ++k)
+            {
+                const ProfileFrame& frame = scope.Frames[k];
+                const double duration = frame.Time * ProfileTimeToMicroseconds;
+
+                const uint16_t parent = hierarchy.Parents[k];
+                if (parent == ProfileNoParent)
+                {
+                    frameStart[k] = rootCursor;
+                    rootCursor += duration;
+                }
+                else
+                {
+                    frameStart[k] = childCursor[parent];
+                    childCursor[parent] += duration;
+                }
+
+                childCursor[k] = frameStart[k];
+
+                stream << ",{\"name\":";
+                WriteJSONString(stream, frame.Name, ProfileNameMax);
+                stream << ",\"cat\":";
+                WriteJSONString(stream, snapshot.Name.c_str(), (uint32_t)snapshot.Name.size());
+                stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << i << ",\"ts\":" << frameStart[k] << ",\"dur\":" << duration << "}";
+            }
+
+            time = rootCursor;
+        }
+    }
+
+    stream << "]}";
+
+    return stream.good();
+}
+
+bool ProfilerData::SaveCapture(const std::filesystem::path& a_path)
+{
+    std::ofstream stream = std::ofstream(a_path, std::ios::binary);
+    if (!stream.good() || !stream.is_open())
+    {
+        Logger::Error("Failed to open profiler capture: " + a_path.string());
+
+        return false;
+    }
+
+    ProfileCaptureHeader header;
+    memcpy(header.Magic, ProfileCaptureMagic, sizeof(header.Magic));
+    header.Version = ProfileCaptureVersion;
+    header.ScopeSize = (uint32_t)sizeof(ProfileScope);
+    header.SnapshotCount = (uint32_t)Instance->m_snapshots.size();
+
+    stream.write((const char*)&header, sizeof(header));
+
+    for (const ProfileSnapshot& snapshot : Instance->m_snapshots)
+    {
+        stream.write((const char*)&snapshot.Count, sizeof(snapshot.Count));
+        stream.write((const char*)&snapshot.Unit, sizeof(snapshot.Unit));
+
+        // Written oldest to newest so the ring buffer can be rebuilt by pushing the scopes back in
+        const uint32_t firstCount = std::min(snapshot.Count, (uint32_t)ProfileMaxScopes - snapshot.StartIndex);
+        stream.write((const char*)(snapshot.Scopes + snapshot.StartIndex), sizeof(ProfileScope) * firstCount);
+        stream.write((const char*)snapshot.Scopes, sizeof(ProfileScope) * (snapshot.Count - firstCount));
+    }
+
+    return stream.good();
+}
+bool ProfilerData::LoadCapture(const std::filesystem::path& a_path)
+{
+    std::ifstream stream = std::ifstream(a_path, std::ios::binary);
+    if (!stream.good() || !stream.is_open())
+    {
+        Logger::Error("Failed to open profiler capture: " + a_path.string());
+
+        return false;
+    }
+
+    ProfileCaptureHeader header;
+    stream.read((char*)&header, sizeof(header));
+    if (!stream.good() || memcmp(header.Magic, ProfileCaptureMagic, sizeof(header.Magic)) != 0 || header.Version != ProfileCaptureVersion || header.ScopeSize != sizeof(ProfileScope))
+    {
+        Logger::Error("Invalid profiler capture: " + a_path.string());
+
+        return false;
+    }
+
+    Clear();
+
+    ProfileScope* scope = new ProfileScope();
+    IDEFER(delete scope);
+
+    for (uint32_t i = 0; i < header.SnapshotCount; ++i)
+    {
+        uint32_t count;
+        stream.read((char*)&count, sizeof(count));
+        e_ProfileUnit unit;
+        stream.read((char*)&unit, sizeof(unit));
+
+        for (uint32_t j = 0; j < count; ++j)
+        {
+            stream.read((char*)scope, sizeof(ProfileScope));
+            if (!stream.good())
+            {
+                Logger::Error("Truncated profiler capture: " + a_path.string());
+
+                return false;
+            }
+
+            PushData(*scope, unit);
+        }
+    }
+
+    return true;
+}
+
 // MIT License
 // 
 // Copyright (c) 2024 River Govers
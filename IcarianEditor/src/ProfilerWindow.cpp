@@ -4,75 +4,79 @@
 
 #include "Windows/ProfilerWindow.h"
 
+#include <algorithm>
+#include <cstring>
+#include <imgui.h>
 #include <implot.h>
 
+#include "AppMain.h"
 #include "Core/IcarianDefer.h"
+#include "Modals/ProfilerCaptureModal.h"
 #include "ProfilerData.h"
 
-static uint32_t GetParent(uint32_t a_index, const ProfileSnapshot& a_snapshot)
+enum e_ProfileStatisticsColumn
+{
+    ProfileStatisticsColumn_Scope,
+    ProfileStatisticsColumn_Name,
+    ProfileStatisticsColumn_Count,
+    ProfileStatisticsColumn_Min,
+    ProfileStatisticsColumn_Max,
+    ProfileStatisticsColumn_Mean,
+    ProfileStatisticsColumn_P50,
+    ProfileStatisticsColumn_P95,
+    ProfileStatisticsColumn_P99,
+    ProfileStatisticsColumn_Last
+};
+
+struct ProfileStatisticsRow
 {
-    const ProfileFrame& frame = a_snapshot.Scopes[0].Frames[a_index];
+    const ProfileSnapshot* Snapshot;
+    const ProfileStatistics* Statistics;
+    float Values[ProfileStatisticsColumn_Last];
+};
 
-    if (frame.Stack > 1)
+static uint32_t GetParent(uint32_t a_index, const ProfileSnapshot& a_snapshot)
+{
+    if (a_index >= a_snapshot.Hierarchy.FrameCount)
     {
-        const uint32_t parentStack = frame.Stack - 1;
-
-        uint32_t i = a_index;
-        while (i > 0)
-        {
-            --i;
-
-            if (a_snapshot.Scopes[0].Frames[i].Stack == parentStack)
-            {
-                return i;
-            }
-        }
+        return 0;
     }
-    
-    return 0;
-}
-static std::vector<uint32_t> GetChildren(uint32_t a_index, const ProfileSnapshot& a_snapshot)
-{
-    std::vector<uint32_t> children;
-
-    const ProfileFrame& frame = a_snapshot.Scopes[0].Frames[a_index];
-    const uint32_t childFrame = frame.Stack + 1;
 
-    for (uint32_t i = a_index + 1; i < a_snapshot.Scopes[0].FrameCount; ++i)
+    const uint16_t parent = a_snapshot.Hierarchy.Parents[a_index];
+    if (parent == ProfileNoParent)
     {
-        const ProfileFrame& sFrame = a_snapshot.Scopes[0].Frames[i];
-
-        if (sFrame.Stack == frame.Stack)
-        {
-            break;
-        }
-        else if (sFrame.Stack == childFrame)
-        {
-            children.emplace_back(i);
-        }
+        return 0;
     }
 
-    return children;
+    return parent;
 }
 
-ProfilerWindow::ProfilerWindow() : Window("Profiler", "Textures/WindowIcons/WindowIcon_Profiler.png")
+ProfilerWindow::ProfilerWindow(AppMain* a_app) : Window("Profiler", "Textures/WindowIcons/WindowIcon_Profiler.png")
 {
-    
+    m_app = a_app;
 }
 ProfilerWindow::~ProfilerWindow()
 {
 
 }
 
+// Frame names are fixed buffers that are not terminated when full
+static bool IsFrameName(const char* a_name, const std::string& a_str)
+{
+    return strncmp(a_name, a_str.c_str(), ProfileNameMax) == 0;
+}
+
 uint32_t ProfilerWindow::GetFrameIndex(const ProfileSnapshot& a_snapshot) const
 {
     for (const ProfileFrameSelection& selection : m_selections)
     {
         if (a_snapshot.Name == selection.SnapshotName)
         {
-            for (uint32_t i = 0; i < ProfileFrameMax; ++i)
+            const ProfileScope& scope = a_snapshot.GetLatestScope();
+
+            for (uint32_t i = 0; i < a_snapshot.Hierarchy.FrameCount; ++i)
             {
-                if (a_snapshot.Scopes[0].Frames[i].Name == selection.FrameName)
+                if (IsFrameName(scope.Frames[i].Name, selection.FrameName))
                 {
                     return i;
                 }
@@ -103,26 +107,33 @@ void ProfilerWindow::SetFrameIndex(const std::string_view& a_snapshotName, const
     m_selections.emplace_back(selection);
 }
 
-void ProfilerWindow::Update(double a_delta)
+void ProfilerWindow::PlotView(const std::vector<ProfileSnapshot>& a_snapshots)
 {
-    const std::vector<ProfileSnapshot> snapshots = ProfilerData::GetSnapshots();
-
     constexpr int TimeOffset = offsetof(ProfileFrame, Time);
     constexpr int FramesOffset = offsetof(ProfileScope, Frames);
 
     constexpr int FrameSize = sizeof(ProfileFrame);
     constexpr int ScopeSize = sizeof(ProfileScope);
 
-    for (const ProfileSnapshot& snapshot : snapshots)
+    for (const ProfileSnapshot& snapshot : a_snapshots)
     {
+        const ProfileHierarchy& hierarchy = snapshot.Hierarchy;
+        const ProfileScope& scope = snapshot.GetLatestScope();
+
         const uint32_t index = GetFrameIndex(snapshot);
-        const std::vector<uint32_t> childIndices = GetChildren(index, snapshot);
+        if (index >= hierarchy.FrameCount)
+        {
+            continue;
+        }
+
+        const uint16_t* childIndices = hierarchy.Children + hierarchy.ChildStart[index];
+        const uint16_t childCount = hierarchy.ChildCount[index];
 
         const std::string windowName = "ProfilerWindow[" + std::to_string(index) + "]";
         ImGui::PushID(windowName.c_str());
         IDEFER(ImGui::PopID());
 
-        const ProfileFrame& frame = snapshot.Scopes[0].Frames[index];
+        const ProfileFrame& frame = scope.Frames[index];
 
         const uint32_t timeOff = FramesOffset + (index * FrameSize) + TimeOffset;
 
@@ -137,19 +148,21 @@ void ProfilerWindow::Update(double a_delta)
             if (ImGui::Button("<"))
             {
                 const uint32_t parentIndex = GetParent(index, snapshot);
-                const ProfileFrame& pFrame = snapshot.Scopes[0].Frames[parentIndex];
+                const ProfileFrame& pFrame = scope.Frames[parentIndex];
 
                 SetFrameIndex(snapshot.Name, pFrame.Name);
             }
         }
 
-        for (uint32_t cIndex : childIndices)
+        for (uint16_t i = 0; i < childCount; ++i)
         {
+            const uint32_t cIndex = childIndices[i];
+
             const std::string cName = "Child[" + std::to_string(cIndex) + "][" + std::to_string(index) + "]";
             ImGui::PushID(cName.c_str());
             IDEFER(ImGui::PopID());
 
-            const ProfileFrame& cFrame = snapshot.Scopes[0].Frames[cIndex];
+            const ProfileFrame& cFrame = scope.Frames[cIndex];
             if (ImGui::Button(cFrame.Name))
             {
                 SetFrameIndex(snapshot.Name, cFrame.Name);
@@ -165,9 +178,10 @@ void ProfilerWindow::Update(double a_delta)
         {
             ImPlot::PlotBars(frame.Name, (float*)((char*)&snapshot.Scopes + timeOff), (int)snapshot.Count, 1.0f, 0.0f, 0, snapshot.StartIndex, ScopeSize);
 
-            for (uint32_t cIndex : childIndices)
+            for (uint16_t i = 0; i < childCount; ++i)
             {
-                const ProfileFrame& cFrame = snapshot.Scopes[0].Frames[cIndex];
+                const uint32_t cIndex = childIndices[i];
+                const ProfileFrame& cFrame = scope.Frames[cIndex];
 
                 const uint32_t cTimeOff = FramesOffset + (cIndex * FrameSize) + TimeOffset;
 
@@ -179,6 +193,357 @@ void ProfilerWindow::Update(double a_delta)
     }
 }
 
+void ProfilerWindow::FlameGraphView(const std::vector<ProfileSnapshot>& a_snapshots)
+{
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImGuiStyle& style = ImGui::GetStyle();
+
+    const ImU32 frameColor = ImGui::GetColorU32(ImGuiCol_Button);
+    const ImU32 hoveredColor = ImGui::GetColorU32(ImGuiCol_ButtonHovered);
+    const ImU32 borderColor = ImGui::GetColorU32(ImGuiCol_WindowBg);
+    const ImU32 textColor = ImGui::GetColorU32(ImGuiCol_Text);
+
+    float xStart[ProfileFrameMax];
+    float childCursor[ProfileFrameMax];
+
+    for (const ProfileSnapshot& snapshot : a_snapshots)
+    {
+        // Counters do not add up to anything so there is nothing to lay out
+        if (snapshot.Unit != ProfileUnit_Milliseconds)
+        {
+            continue;
+        }
+
+        const ProfileHierarchy& hierarchy = snapshot.Hierarchy;
+        const ProfileScope& scope = snapshot.GetLatestScope();
+
+        if (!ImGui::CollapsingHeader(snapshot.Name.c_str(), ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            continue;
+        }
+
+        float totalTime = 0.0f;
+        uint8_t minStack = UINT8_MAX;
+        uint8_t maxStack = 0;
+        for (uint16_t i = 0; i < hierarchy.FrameCount; ++i)
+        {
+            const ProfileFrame& frame = scope.Frames[i];
+
+            if (hierarchy.Parents[i] == ProfileNoParent)
+            {
+                totalTime += frame.Time;
+            }
+
+            minStack = std::min(minStack, frame.Stack);
+            maxStack = std::max(maxStack, frame.Stack);
+        }
+
+        if (totalTime <= 0.0f)
+        {
+            continue;
+        }
+
+        const ImVec2 startPos = ImGui::GetCursorScreenPos();
+        const float width = ImGui::GetContentRegionAvail().x;
+        const float scale = width / totalTime;
+        const float height = (maxStack - minStack + 1) * FlameGraphRowHeight;
+
+        ImGui::Dummy(ImVec2(width, height));
+
+        const ImVec2 mousePos = ImGui::GetMousePos();
+        const bool windowHovered = ImGui::IsItemHovered();
+
+        // Frames are pushed depth first so parents always have their start set before their children
+        float rootCursor = startPos.x;
+        for (uint16_t i = 0; i < hierarchy.FrameCount; ++i)
+        {
+            const ProfileFrame& frame = scope.Frames[i];
+            const float frameWidth = frame.Time * scale;
+
+            const uint16_t parent = hierarchy.Parents[i];
+            if (parent == ProfileNoParent)
+            {
+                xStart[i] = rootCursor;
+                rootCursor += frameWidth;
+            }
+            else
+            {
+                xStart[i] = childCursor[parent];
+                childCursor[parent] += frameWidth;
+            }
+
+            childCursor[i] = xStart[i];
+
+            const float y = startPos.y + (frame.Stack - minStack) * FlameGraphRowHeight;
+            const ImVec2 min = ImVec2(xStart[i], y);
+            const ImVec2 max = ImVec2(xStart[i] + frameWidth, y + FlameGraphRowHeight - 1.0f);
+
+            const bool hovered = windowHovered && mousePos.x >= min.x && mousePos.x < max.x && mousePos.y >= min.y && mousePos.y < max.y;
+
+            drawList->AddRectFilled(min, max, hovered ? hoveredColor : frameColor);
+            drawList->AddRect(min, max, borderColor);
+
+            const char* nameEnd = frame.Name + strnlen(frame.Name, ProfileNameMax);
+            const ImVec2 textSize = ImGui::CalcTextSize(frame.Name, nameEnd);
+            if (textSize.x + style.FramePadding.x * 2.0f < frameWidth)
+            {
+                drawList->AddText(ImVec2(min.x + style.FramePadding.x, min.y + (FlameGraphRowHeight - textSize.y) * 0.5f), textColor, frame.Name, nameEnd);
+            }
+
+            if (hovered)
+            {
+                ImGui::BeginTooltip();
+                IDEFER(ImGui::EndTooltip());
+
+                ImGui::Text("%.*s", (int)(nameEnd - frame.Name), frame.Name);
+                ImGui::Text("%.3fms (%.1f%%)", frame.Time, (frame.Time / totalTime) * 100.0f);
+
+                if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+                {
+                    SetFrameIndex(snapshot.Name, std::string_view(frame.Name, nameEnd - frame.Name));
+                }
+            }
+        }
+    }
+}
+
+void ProfilerWindow::StatisticsView(const std::vector<ProfileSnapshot>& a_snapshots)
+{
+    std::vector<ProfileStatisticsRow> rows;
+
+    const ProfileStatistics* selectedStatistics = nullptr;
+    const ProfileSnapshot* selectedSnapshot = nullptr;
+
+    for (const ProfileSnapshot& snapshot : a_snapshots)
+    {
+        for (uint16_t i = 0; i < snapshot.Hierarchy.FrameCount; ++i)
+        {
+            const ProfileStatistics& statistics = snapshot.Statistics[i];
+            if (statistics.Count <= 0)
+            {
+                continue;
+            }
+
+            ProfileStatisticsRow row;
+            row.Snapshot = &snapshot;
+            row.Statistics = &statistics;
+            row.Values[ProfileStatisticsColumn_Scope] = 0.0f;
+            row.Values[ProfileStatisticsColumn_Name] = 0.0f;
+            row.Values[ProfileStatisticsColumn_Count] = (float)statistics.Count;
+            row.Values[ProfileStatisticsColumn_Min] = statistics.Min;
+            row.Values[ProfileStatisticsColumn_Max] = statistics.Max;
+            row.Values[ProfileStatisticsColumn_Mean] = (float)(statistics.Sum / statistics.Count);
+            row.Values[ProfileStatisticsColumn_P50] = 0.0f;
+            row.Values[ProfileStatisticsColumn_P95] = 0.0f;
+            row.Values[ProfileStatisticsColumn_P99] = 0.0f;
+
+            // Histogram buckets are laid out for times so counters past the top bucket would all read the same
+            if (snapshot.Unit == ProfileUnit_Milliseconds)
+            {
+                row.Values[ProfileStatisticsColumn_P50] = ProfilerData::GetQuantile(statistics, 0.50f);
+                row.Values[ProfileStatisticsColumn_P95] = ProfilerData::GetQuantile(statistics, 0.95f);
+                row.Values[ProfileStatisticsColumn_P99] = ProfilerData::GetQuantile(statistics, 0.99f);
+            }
+
+            rows.emplace_back(row);
+
+            if (snapshot.Name == m_statisticsSelection.SnapshotName && IsFrameName(statistics.Name, m_statisticsSelection.FrameName))
+            {
+                selectedStatistics = &statistics;
+                selectedSnapshot = &snapshot;
+            }
+        }
+    }
+
+    constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersInnerV;
+
+    // Histogram is only meaningful for times
+    const bool showHistogram = selectedStatistics != nullptr && selectedSnapshot->Unit == ProfileUnit_Milliseconds;
+
+    const float tableHeight = showHistogram ? ImGui::GetContentRegionAvail().y * 0.6f : 0.0f;
+
+    if (ImGui::BeginTable("##ProfilerStatistics", ProfileStatisticsColumn_Last, TableFlags, ImVec2(0.0f, tableHeight)))
+    {
+        IDEFER(ImGui::EndTable());
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Scope");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Count");
+        ImGui::TableSetupColumn("Min");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableSetupColumn("P50");
+        ImGui::TableSetupColumn("P95");
+        ImGui::TableSetupColumn("P99", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+        ImGui::TableHeadersRow();
+
+        // Values change every frame so always sort instead of only when the specs are dirty
+        const ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+        if (sortSpecs != nullptr && sortSpecs->SpecsCount > 0)
+        {
+            const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[0];
+            const int column = spec.ColumnIndex;
+            const bool ascending = spec.SortDirection == ImGuiSortDirection_Ascending;
+
+            std::sort(rows.begin(), rows.end(), [column, ascending](const ProfileStatisticsRow& a_lhs, const ProfileStatisticsRow& a_rhs)
+            {
+                int cmp;
+                switch (column)
+                {
+                case ProfileStatisticsColumn_Scope:
+                {
+                    cmp = a_lhs.Snapshot->Name.compare(a_rhs.Snapshot->Name);
+
+                    break;
+                }
+                case ProfileStatisticsColumn_Name:
+                {
+                    cmp = strncmp(a_lhs.Statistics->Name, a_rhs.Statistics->Name, ProfileNameMax);
+
+                    break;
+                }
+                default:
+                {
+                    const float lhs = a_lhs.Values[column];
+                    const float rhs = a_rhs.Values[column];
+
+                    cmp = (lhs > rhs) - (lhs < rhs);
+
+                    break;
+                }
+                }
+
+                return ascending ? cmp < 0 : cmp > 0;
+            });
+        }
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)rows.size());
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                const ProfileStatisticsRow& row = rows[i];
+
+                ImGui::PushID(i);
+                IDEFER(ImGui::PopID());
+
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                const bool selected = row.Statistics == selectedStatistics;
+                if (ImGui::Selectable(row.Snapshot->Name.c_str(), selected, ImGuiSelectableFlags_SpanAllColumns))
+                {
+                    m_statisticsSelection.SnapshotName = row.Snapshot->Name;
+                    m_statisticsSelection.FrameName = std::string(row.Statistics->Name, strnlen(row.Statistics->Name, ProfileNameMax));
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%.*s", (int)strnlen(row.Statistics->Name, ProfileNameMax), row.Statistics->Name);
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", row.Statistics->Count);
+
+                for (int j = ProfileStatisticsColumn_Min; j < ProfileStatisticsColumn_Last; ++j)
+                {
+                    ImGui::TableNextColumn();
+
+                    switch (row.Snapshot->Unit)
+                    {
+                    case ProfileUnit_Count:
+                    {
+                        if (j >= ProfileStatisticsColumn_P50)
+                        {
+                            ImGui::TextDisabled("-");
+                        }
+                        else
+                        {
+                            ImGui::Text("%.1f", row.Values[j]);
+                        }
+
+                        break;
+                    }
+                    default:
+                    {
+                        ImGui::Text("%.3fms", row.Values[j]);
+
+                        break;
+                    }
+                    }
+                }
+            }
+        }
+    }
+
+    if (showHistogram)
+    {
+        float bucketTimes[ProfileHistogramBuckets];
+        float bucketCounts[ProfileHistogramBuckets];
+        for (uint32_t i = 0; i < ProfileHistogramBuckets; ++i)
+        {
+            bucketTimes[i] = ProfilerData::GetHistogramBucketTime(i);
+            bucketCounts[i] = (float)selectedStatistics->Buckets[i];
+        }
+
+        if (ImPlot::BeginPlot("Frame Time Histogram", ImVec2(-1.0f, -1.0f)))
+        {
+            ImPlot::SetupAxes("Time (ms)", "Count", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+            ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Log10);
+
+            ImPlot::PlotStairs(m_statisticsSelection.FrameName.c_str(), bucketTimes, bucketCounts, ProfileHistogramBuckets);
+
+            ImPlot::EndPlot();
+        }
+    }
+}
+
+void ProfilerWindow::Update(double a_delta)
+{
+    const std::vector<ProfileSnapshot>& snapshots = ProfilerData::GetSnapshots();
+
+    if (ImGui::Button("Export Trace"))
+    {
+        m_app->PushModal(new ProfilerCaptureModal(m_app, ProfilerCaptureMode_ExportTrace));
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Save Capture"))
+    {
+        m_app->PushModal(new ProfilerCaptureModal(m_app, ProfilerCaptureMode_Save));
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Load Capture"))
+    {
+        m_app->PushModal(new ProfilerCaptureModal(m_app, ProfilerCaptureMode_Load));
+    }
+
+    if (ImGui::BeginTabBar("##ProfilerViews"))
+    {
+        IDEFER(ImGui::EndTabBar());
+
+        if (ImGui::BeginTabItem("Plots"))
+        {
+            IDEFER(ImGui::EndTabItem());
+
+            PlotView(snapshots);
+        }
+
+        if (ImGui::BeginTabItem("Flame Graph"))
+        {
+            IDEFER(ImGui::EndTabItem());
+
+            FlameGraphView(snapshots);
+        }
+
+        if (ImGui::BeginTabItem("Statistics"))
+        {
+            IDEFER(ImGui::EndTabItem());
+
+            StatisticsView(snapshots);
+        }
+    }
+}
+
 // MIT License
 // 
 // Copyright (c) 2024 River Govers
@@ -4,6 +4,7 @@
 
 #include "RenderCommand.h"
 
+#include "Application.h"
 #include "Core/IcarianAssert.h"
 #include "Core/IcarianDefer.h"
 #include "Gizmos.h"
@@ -28,6 +29,7 @@ static RenderCommand* Instance = nullptr;
     \
     F(uint32_t, IcarianEditor, AnimationMaster, GenerateSkeletonBuffer, { return RenderCommand::GenerateSkeletonBuffer(); }) \
     F(void, IcarianEditor, AnimationMaster, BindSkeletonBuffer, { RenderCommand::BindSkeletonBuffer(a_addr); }, uint32_t a_addr) \
+    F(void, IcarianEditor, AnimationMaster, RequestRedraw, { Application::RequestRedraw(); }) \
     \
     \
     F(void, IcarianEngine.Rendering.Animation, Animator, DestroyBuffer, { }, uint32_t a_addr) \
@@ -330,7 +332,11 @@ void RenderCommand::DrawModel(const glm::mat4& a_transform, uint32_t a_modelAddr
     const Model* model = Instance->m_storage->GetModel(a_modelAddr);
     if (model == nullptr)
     {
-        Logger::Warning("IcarianEditor: DrawModel invalid model address");
+        // Still importing so just skip it until it is ready
+        if (!Instance->m_storage->IsModelPending(a_modelAddr))
+        {
+            Logger::Warning("IcarianEditor: DrawModel invalid model address");
+        }
 
         return;
     }
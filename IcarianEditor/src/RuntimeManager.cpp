@@ -18,6 +18,7 @@
 #include "Core/IcarianDefer.h"
 #include "CUBE/CUBE.h"
 #include "EditorConfig.h"
+#include "EditorProfiler.h"
 #include "IO.h"
 #include "Logger.h"
 #include "MonoProjectGenerator.h"
@@ -29,21 +30,21 @@ RUNTIME_FUNCTION(void, Logger, PushMessage,
     char* str = mono_string_to_utf8(a_string);
     IDEFER(mono_free(str));
 
-    Logger::Message(str);
+    Logger::Message(str, LoggerMessageSource_Script);
 }, MonoString* a_string)
 RUNTIME_FUNCTION(void, Logger, PushWarning,
 {
     char* str = mono_string_to_utf8(a_string);
     IDEFER(mono_free(str));
 
-    Logger::Warning(str);
+    Logger::Warning(str, LoggerMessageSource_Script);
 }, MonoString* a_string)
 RUNTIME_FUNCTION(void, Logger, PushError,
 {
     char* str = mono_string_to_utf8(a_string);
     IDEFER(mono_free(str));
 
-    Logger::Error(str);
+    Logger::Error(str, LoggerMessageSource_Script);
 }, MonoString* a_string)
 
 RUNTIME_FUNCTION(uint32_t, Application, GetEditorState,
@@ -513,6 +514,9 @@ void RuntimeManager::ExecFunction(const std::string_view& a_namespace, const std
 {
     if (Instance->m_editorDomain != NULL)
     {
+        EDITOR_PROFILE_SCOPE("ExecFunction");
+        EDITOR_PROFILE_COUNTER_ADD("ExecFunction", 1);
+
         MonoClass* cls = GetClass(a_namespace, a_class);
         ICARIAN_ASSERT(cls != nullptr);
 
@@ -4,26 +4,26 @@
 
 #include "Runtime/RuntimeStorage.h"
 
-#define STBI_NO_STDIO
-#include <stb_image.h>
-
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
+#include <chrono>
 #include <cstring>
 
+#include "Application.h"
 #include "AssetLibrary.h"
 #include "Core/FlareShader.h"
 #include "Core/IcarianAssert.h"
 #include "Core/IcarianDefer.h"
 #include "Core/StringUtils.h"
-#include "KtxHelpers.h"
+#include "EditorConfig.h"
+#include "EditorProfiler.h"
 #include "Logger.h"
 #include "Model.h"
 #include "PixelShader.h"
+#include "Project.h"
+#include "Runtime/ModelImporter.h"
 #include "Runtime/RuntimeManager.h"
 #include "ShaderStorage.h"
 #include "Texture.h"
+#include "TextureLoader.h"
 #include "TextureSampler.h"
 #include "VertexShader.h"
 
@@ -194,328 +194,20 @@ RUNTIME_FUNCTION(uint32_t, Model, GenerateModel,
     return M_Model_GenerateModel(a_vertices, a_indices, a_vertexStride);
 }, MonoArray* a_vertices, MonoArray* a_indices, uint16_t a_vertexStride)
 
-static void LoadMesh(const aiMesh* a_mesh, std::vector<Vertex>* a_vertices, std::vector<uint32_t>* a_indices, float* a_rSqr)
-{
-    const bool hasNormals = a_mesh->HasNormals();
-    const bool hasTexCoordsA = a_mesh->HasTextureCoords(0);
-    const bool hasTexCoordsB = a_mesh->HasTextureCoords(1);
-    const bool hasColour = a_mesh->HasVertexColors(0);
-
-    for (uint32_t i = 0; i < a_mesh->mNumVertices; ++i) 
-    {
-        Vertex v;
-
-        const aiVector3D& pos = a_mesh->mVertices[i];
-        v.Position = glm::vec4(pos.x, -pos.y, pos.z, 1.0f);
-
-        *a_rSqr = glm::max(pos.SquareLength(), *a_rSqr);
-
-        if (hasNormals) 
-        {
-            const aiVector3D& norm = a_mesh->mNormals[i];
-            v.Normal = glm::vec3(norm.x, -norm.y, norm.z);
-        }
-
-        if (hasTexCoordsA) 
-        {
-            const aiVector3D& uv = a_mesh->mTextureCoords[0][i];
-            v.TexCoordsA = glm::vec2(uv.x, uv.y);
-        }
-
-        if (hasTexCoordsB)
-        {
-            const aiVector3D& uv = a_mesh->mTextureCoords[1][i];
-            v.TexCoordsB = glm::vec2(uv.x, uv.y);
-        }
-
-        if (hasColour) 
-        {
-            const aiColor4D& colour = a_mesh->mColors[0][i];
-            v.Color = glm::vec4(colour.r, colour.g, colour.b, colour.a);
-        }
-
-        a_vertices->emplace_back(v);
-    }
-
-    for (uint32_t i = 0; i < a_mesh->mNumFaces; ++i) 
-    {
-        const aiFace& face = a_mesh->mFaces[i];
-
-        a_indices->emplace_back(face.mIndices[0]);
-        a_indices->emplace_back(face.mIndices[2]);
-        a_indices->emplace_back(face.mIndices[1]);
-    }
-}
-
-static void WalkTreeMesh(const aiScene* a_scene, const aiNode* a_node, uint8_t a_data, std::vector<Vertex>* a_vertices, std::vector<uint32_t>* a_indices, float* a_radSqr, uint8_t* a_index)
-{
-    if (a_data == std::numeric_limits<uint8_t>::max())
-    {
-        for (uint32_t i = 0; i < a_node->mNumMeshes; ++i)
-        {
-            LoadMesh(a_scene->mMeshes[a_node->mMeshes[i]], a_vertices, a_indices, a_radSqr);
-        }
-    }
-    else 
-    {
-        if (*a_index > a_data)
-        {
-            return;
-        }
-
-        if (a_data < *a_index + a_node->mNumMeshes)
-        {
-            LoadMesh(a_scene->mMeshes[a_node->mMeshes[a_data - *a_index]], a_vertices, a_indices, a_radSqr);
-            *a_index = std::numeric_limits<uint8_t>::max();
-
-            return;
-        }
-
-        *a_index += a_node->mNumMeshes;
-    }
-
-    for (uint32_t i = 0; i < a_node->mNumChildren; ++i)
-    {
-        WalkTreeMesh(a_scene, a_node->mChildren[i], a_data, a_vertices, a_indices, a_radSqr, a_index);
-    }
-}
-
 RUNTIME_FUNCTION(uint32_t, Model, GenerateFromFile, 
 {
     char* str = mono_string_to_utf8(a_path);
     IDEFER(mono_free(str));
 
-    const std::filesystem::path p = std::filesystem::path(str);
-    const std::filesystem::path ext = p.extension();
-    const std::string extStr = ext.string();
-
-    AssetLibrary* library = Instance->GetLibrary();
-    switch (StringHash<uint32_t>(extStr.c_str())) 
-    {
-    case StringHash<uint32_t>(".obj"):
-    case StringHash<uint32_t>(".dae"):
-    case StringHash<uint32_t>(".fbx"):
-    case StringHash<uint32_t>(".glb"):
-    case StringHash<uint32_t>(".gltf"):
-    {
-        const uint8_t* dat;
-        uint32_t size;
-        library->GetAsset(p, &size, &dat);
-        if (size <= 0 || dat == nullptr)
-        {
-            Logger::Error(std::string("Cannot find mesh file: ") + str);
-
-            break;
-        }
-
-        Assimp::Importer importer; 
-
-        const aiScene* scene = importer.ReadFileFromMemory(dat, (size_t)size, aiProcess_Triangulate | aiProcess_PreTransformVertices, extStr.c_str() + 1);
-        ICARIAN_ASSERT(scene != nullptr);
-        const aiNode* root = scene->mRootNode;
-
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
-        float radSqr = 0.0f;
-        uint8_t index = 0;
-        WalkTreeMesh(scene, root, (uint8_t)a_index, &vertices, &indices, &radSqr, &index);
-
-        if (vertices.empty() || indices.empty() || radSqr <= 0.0f)
-        {
-            Logger::Warning(std::string("Empty model: ") + str);
-
-            break;
-        }
-
-        return Instance->GenerateModel(vertices.data(), (uint32_t)vertices.size(), indices.data(), (uint32_t)indices.size(), sizeof(Vertex));
-    }
-    default:
-    {
-        Logger::Error(std::string("Mesh invalid file extension: ") + str);
-
-        break;
-    }
-    }
-
-    return -1;
+    return Instance->GenerateModelFromFile(str, a_index, false);
 }, MonoString* a_path, uint32_t a_index)
 
-static void LoadSkinnedMesh(const aiMesh* a_mesh, std::vector<SkinnedVertex>* a_vertices, std::vector<uint32_t>* a_indices, const std::unordered_map<std::string, int>& a_boneMap, float* a_rSqr)
-{
-    for (uint32_t i = 0; i < a_mesh->mNumVertices; ++i) 
-    {
-        SkinnedVertex v;
-
-        const aiVector3D& pos = a_mesh->mVertices[i];
-        v.Position = glm::vec4(pos.x, -pos.y, pos.z, 1.0f);
-
-        *a_rSqr = glm::max(pos.SquareLength(), *a_rSqr);
-
-        if (a_mesh->HasNormals()) 
-        {
-            const aiVector3D& norm = a_mesh->mNormals[i];
-            v.Normal = glm::vec3(norm.x, -norm.y, norm.z);
-        }
-
-        if (a_mesh->HasTextureCoords(0)) 
-        {
-            const aiVector3D& uv = a_mesh->mTextureCoords[0][i];
-            v.TexCoords = glm::vec2(uv.x, uv.y);
-        }
-
-        if (a_mesh->HasVertexColors(0)) 
-        {
-            const aiColor4D& colour = a_mesh->mColors[0][i];
-            v.Color = glm::vec4(colour.r, colour.g, colour.b, colour.a);
-        }
-
-        if (a_mesh->HasBones())
-        {
-            const aiBone* bone = a_mesh->mBones[i];
-
-            const uint32_t weights = glm::min(uint32_t(4), (uint32_t)bone->mNumWeights);
-            for (uint32_t j = 0; j < weights; ++j)
-            {
-                const auto iter = a_boneMap.find(bone->mName.C_Str());
-                if (iter == a_boneMap.end())
-                {
-                    continue;
-                }
-
-                v.BoneIndices[j] = iter->second;
-                v.BoneWeights[j] = bone->mWeights[j].mWeight;
-            }
-        }
-
-        a_vertices->emplace_back(v);
-    }
-
-    for (uint32_t i = 0; i < a_mesh->mNumFaces; ++i) 
-    {
-        const aiFace& face = a_mesh->mFaces[i];
-
-        a_indices->emplace_back(face.mIndices[0]);
-        a_indices->emplace_back(face.mIndices[2]);
-        a_indices->emplace_back(face.mIndices[1]);
-    }
-}
-
-static void WalkTreeSkinned(const aiScene* a_scene, const aiNode* a_node, uint8_t a_data, std::vector<SkinnedVertex>* a_vertices, std::vector<uint32_t>* a_indices, const std::unordered_map<std::string, int>& a_boneMap, float* a_radSqr, uint8_t* a_index)
-{
-    if (a_data == std::numeric_limits<uint8_t>::max())
-    {
-        for (uint32_t i = 0; i < a_node->mNumMeshes; ++i)
-        {
-            LoadSkinnedMesh(a_scene->mMeshes[a_node->mMeshes[i]], a_vertices, a_indices, a_boneMap, a_radSqr);
-        }
-    }
-    else
-    {
-        if (*a_index > a_data)
-        {
-            return;
-        }
-
-        if (a_data < *a_index + a_node->mNumMeshes)
-        {
-            LoadSkinnedMesh(a_scene->mMeshes[a_node->mMeshes[a_data - *a_index]], a_vertices, a_indices, a_boneMap, a_radSqr);
-            *a_index = std::numeric_limits<uint8_t>::max();
-
-            return;
-        }
-
-        *a_index += a_node->mNumMeshes;
-    }
-
-    for (uint32_t i = 0; i < a_node->mNumChildren; ++i)
-    {
-        WalkTreeSkinned(a_scene, a_node->mChildren[i], a_data, a_vertices, a_indices, a_boneMap, a_radSqr, a_index);
-    }
-}
 RUNTIME_FUNCTION(uint32_t, Model, GenerateSkinnedFromFile, 
 {
     char* str = mono_string_to_utf8(a_path);
     IDEFER(mono_free(str));
 
-    const std::filesystem::path p = std::filesystem::path(str);
-    const std::filesystem::path ext = p.extension();
-
-    const std::string extStr = ext.string();
-
-    AssetLibrary* library = Instance->GetLibrary();
-    
-    switch (StringHash<uint32_t>(extStr.c_str()))
-    {
-    case StringHash<uint32_t>(".dae"):
-    case StringHash<uint32_t>(".fbx"):
-    case StringHash<uint32_t>(".glb"):
-    case StringHash<uint32_t>(".gltf"):
-    {
-        const uint8_t* dat;
-        uint32_t size;
-        library->GetAsset(p, &size, &dat);
-        if (size <= 0 || dat == nullptr)
-        {
-            Logger::Error(std::string("Cannot find skinned mesh file: ") + str);
-
-            break;
-        }
-
-        Assimp::Importer importer; 
-
-        const aiScene* scene = importer.ReadFileFromMemory(dat, (size_t)size, aiProcess_Triangulate | aiProcess_PreTransformVertices, extStr.c_str() + 1);
-        ICARIAN_ASSERT(scene != nullptr);
-
-        if (scene->mNumSkeletons <= 0)
-        {
-            Logger::Warning(std::string("No skeletons: ") + str);
-
-            break;
-        }
-
-        // Hic sunt dracones
-        // Compiler is being weird this is a dodgy hack
-        // This should not be broken and inserting the arguments directly should work and using a macro should not fix it but it does
-        // I think the compiler has had enough of my preprocessor shannigans
-        // DO NOT REMOVE otherwise compiler error on GCC and clang
-#define MCR_GenerateSkinnedFromFile_MAPKEYS std::string, int
-        std::unordered_map<MCR_GenerateSkinnedFromFile_MAPKEYS> boneMap;
-
-        const aiSkeleton* skeleton = scene->mSkeletons[0];
-        for (int i = 0; i < skeleton->mNumBones; ++i)
-        {
-            const aiSkeletonBone* bone = skeleton->mBones[i];
-            const std::string name = bone->mNode->mName.C_Str();
-
-            boneMap.emplace(name, i);
-        }
-
-        const aiNode* root = scene->mRootNode;
-
-        std::vector<SkinnedVertex> vertices;
-        std::vector<uint32_t> indices;
-        float radSqr = 0.0f;
-        uint8_t index = 0;
-        WalkTreeSkinned(scene, root, (uint8_t)a_index, &vertices, &indices, boneMap, &radSqr, &index);
-
-        if (vertices.empty() || indices.empty() || radSqr <= 0)
-        {
-            Logger::Warning(std::string("Empty Model: ") + str);
-
-            break;
-        }
-
-        return Instance->GenerateModel(vertices.data(), (uint32_t)vertices.size(), indices.data(), (uint32_t)indices.size(), sizeof(SkinnedVertex));
-    }
-    default:
-    {
-        Logger::Error(std::string("Skinned mesh invalid file extension: ") + str);
-
-        break;
-    }
-    }
-
-    return -1;
+    return Instance->GenerateModelFromFile(str, a_index, true);
 }, MonoString* a_path, uint32_t a_index)
 
 RUNTIME_FUNCTION(RuntimeImportBoneData, Skeleton, LoadBoneData, 
@@ -523,85 +215,7 @@ RUNTIME_FUNCTION(RuntimeImportBoneData, Skeleton, LoadBoneData,
     char* str = mono_string_to_utf8(a_path);
     IDEFER(mono_free(str));
 
-    const std::filesystem::path p = std::filesystem::path(str);
-    const std::filesystem::path ext = p.extension();
-    const std::string extStr = ext.string();
-
-    RuntimeImportBoneData data = { 0 };
-
-    AssetLibrary* library = Instance->GetLibrary();
-
-    switch (StringHash<uint32_t>(extStr.c_str())) 
-    {
-    case StringHash<uint32_t>(".dae"):
-    case StringHash<uint32_t>(".fbx"):
-    case StringHash<uint32_t>(".glb"):
-    case StringHash<uint32_t>(".gltf"):
-    {
-        const uint8_t* dat;
-        uint32_t size;
-        library->GetAsset(p, &size, &dat);
-        if (size <= 0 || dat == nullptr)
-        {
-            Logger::Error(std::string("Cannot find skeleton file: ") + str);
-
-            break;
-        }
-
-        Assimp::Importer importer;
-
-        const aiScene* scene = importer.ReadFileFromMemory(dat, (size_t)size, 0, extStr.c_str() + 1);
-        ICARIAN_ASSERT(scene != nullptr);
-
-        if (scene->mNumSkeletons <= 0)
-        {
-            break;
-        }
-
-        const aiSkeleton* skeleton = scene->mSkeletons[0];
-
-        const uint32_t boneCount = (uint32_t)skeleton->mNumBones;
-        if (boneCount <= 0)
-        {
-            break;
-        }
-
-        MonoDomain* domain = mono_domain_get();
-        MonoClass* fClass = mono_get_single_class();
-
-        data.BindPoses = mono_array_new(domain, mono_get_array_class(), (uintptr_t)boneCount);
-        data.Names = mono_array_new(domain, mono_get_string_class(), (uintptr_t)boneCount);
-        data.Parents = mono_array_new(domain, mono_get_uint32_class(), (uintptr_t)boneCount);
-
-        for (uint32_t i = 0; i < boneCount; ++i)
-        {
-            const aiSkeletonBone* bone = skeleton->mBones[i];
-
-            aiMatrix4x4 bindPose = bone->mOffsetMatrix;
-            bindPose.Inverse();
-
-            MonoArray* bindPoseArr = mono_array_new(domain, fClass, 16);
-            for (uint32_t j = 0; j < 16; ++j)
-            {
-                mono_array_set(bindPoseArr, float, j, bindPose[j / 4][j % 4]);
-            }
-
-            mono_array_set(data.BindPoses, MonoArray*, i, bindPoseArr);
-            mono_array_set(data.Names, MonoString*, i, mono_string_new(domain, bone->mNode->mName.C_Str()));
-            mono_array_set(data.Parents, uint32_t, i, (uint32_t)bone->mParent);
-        }
-
-        break;
-    }
-    default:
-    {
-        Logger::Error(std::string("Skeleton invalid file extension: ") + str);
-
-        break;
-    }
-    }
-
-    return data;
+    return Instance->LoadBoneData(str);
 }, MonoString* a_path)
 
 RUNTIME_FUNCTION(MonoArray*, AnimationClip, LoadExternalAnimationData, 
@@ -617,77 +231,15 @@ RUNTIME_FUNCTION(uint32_t, Texture, GenerateFromFile,
     char* str = mono_string_to_utf8(a_path);
     IDEFER(mono_free(str));
     
-    const std::filesystem::path p = std::filesystem::path(str);
-    const std::filesystem::path ext = p.extension();
-
-    AssetLibrary* library = Instance->GetLibrary();
-    if (ext == ".png")
-    {
-        const uint8_t* dat;
-        uint32_t size;
-        library->GetAsset(p, &size, &dat);
-
-        if (dat != nullptr && size > 0)
-        {
-            int width;
-            int height;
-            int channels;
-
-            stbi_uc* pixels = stbi_load_from_memory((stbi_uc*)dat, (int)size, &width, &height, &channels, STBI_rgb_alpha);
-            IDEFER(stbi_image_free(pixels));
-
-            return Instance->GenerateTexture((uint32_t)width, (uint32_t)height, (unsigned char*)pixels);
-        }
-    }
-    else if (ext == ".ktx2")
-    {
-        const uint8_t* dat;
-        uint32_t size;
-        library->GetAsset(p, &size, &dat);
-
-        if (dat != nullptr && size > 0)
-        {
-            ktxTexture2* ktxTex;
-            if (ktxTexture2_CreateFromMemory((ktx_uint8_t*)dat, (ktx_size_t)size, KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &ktxTex) == KTX_SUCCESS)
-            {
-                IDEFER(ktxTexture_Destroy((ktxTexture*)ktxTex));
-
-                if (ktxTexture2_NeedsTranscoding(ktxTex))
-                {
-                    ktxTexture2_TranscodeBasis(ktxTex, KTX_TTF_BC3_RGBA, 0);
-                }
-
-                GLuint handle;
-                glGenTextures(1, &handle);
-                glBindTexture(GL_TEXTURE_2D, handle);
-                
-                const GLenum glInternalFormat = GLInternalFormatFromKtxVkFormat(ktxTex->vkFormat);
-                
-                if (ktxTex->isCompressed)
-                {
-                    const GLsizei size = (GLsizei)ktxTexture_GetImageSize((ktxTexture*)ktxTex, 0);
-
-                    glCompressedTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, ktxTex->baseWidth, ktxTex->baseHeight, 0, size, ktxTex->pData);
-                }
-                else 
-                {
-                    const GLenum glFormat = GLFormatFromKtxVkFormat(ktxTex->vkFormat);
-                    const GLenum glType = GLTypeFromKtxVkFormat(ktxTex->vkFormat);
-
-                    glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, ktxTex->baseWidth, ktxTex->baseHeight, 0, glFormat, glType, ktxTex->pData);
-                }
-                
-                return Instance->GenerateTextureFromHandle((uint32_t)handle);
-            }
-        }
-    }
-
-    return -1;
+    return Instance->GenerateTextureFromFile(str);
 }, MonoString* a_path)
 
-RuntimeStorage::RuntimeStorage(AssetLibrary* a_assets)
+RuntimeStorage::RuntimeStorage(AssetLibrary* a_assets, Project* a_project)
 {
     m_assets = a_assets;
+    m_project = a_project;
+    m_modelImporter = new ModelImporter();
+    m_textureLoader = new TextureLoader();
 
     BIND_FUNCTION(IcarianEngine.Rendering.Shaders, VertexShader, AddImport);
     BIND_FUNCTION(IcarianEngine.Rendering.Shaders, PixelShader, AddImport);
@@ -712,64 +264,118 @@ RuntimeStorage::RuntimeStorage(AssetLibrary* a_assets)
 RuntimeStorage::~RuntimeStorage()
 {
     Clear();
+
+    delete m_modelImporter;
+    delete m_textureLoader;
 }
 
-void RuntimeStorage::Clear()
+std::filesystem::path RuntimeStorage::GetCachePath() const
+{
+    return m_project->GetCachePath();
+}
+
+void RuntimeStorage::Update()
 {
-    for (const Model* mdl : m_models)
     {
-        if (mdl != nullptr)
+        EDITOR_PROFILE_SCOPE("ModelUpload");
+
+        // Uploads get batched up here as GL can only be used from the main thread
+        for (auto iter = m_pendingModels.begin(); iter != m_pendingModels.end();)
         {
-            delete mdl;
+            if (iter->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++iter;
+
+                continue;
+            }
+
+            const ModelImportResult result = iter->second.get();
+            if (result.Valid)
+            {
+                m_models.Set(iter->first, new Model(result.Vertices.data(), result.VertexCount, (const GLuint*)result.Indices.data(), (uint32_t)result.Indices.size(), result.VertexStride));
+            }
+
+            iter = m_pendingModels.erase(iter);
         }
+
+        EDITOR_PROFILE_COUNTER("Pending Models", m_pendingModels.size());
+    }
+
+    EDITOR_PROFILE_COUNTER("Runtime Models", m_models.GetAliveCount());
+    EDITOR_PROFILE_COUNTER("Runtime Textures", m_textures.GetAliveCount());
+    EDITOR_PROFILE_COUNTER("Runtime Programs", m_renderPrograms.GetAliveCount());
+
+    m_textureLoader->Update();
+
+    // Keep drawing until everything is in otherwise it only shows up on the next idle tick
+    if (!m_pendingModels.empty() || m_textureLoader->GetPendingCount() > 0)
+    {
+        Application::RequestRedraw();
     }
-    m_models.clear();
+}
+
+void RuntimeStorage::Clear()
+{
+    EDITOR_PROFILE_SCOPE("RuntimeStorageClear");
+
+    m_modelImporter->Clear();
+    m_pendingModels.clear();
+
+    m_models.ForEach([](const Model* a_model)
+    {
+        if (a_model != nullptr)
+        {
+            delete a_model;
+        }
+    });
+    m_models.Clear();
+
+    m_textureLoader->Clear();
 
     // May have forgotten about this and been leaking bout 1GB of VRAM.......
     // Opps :D fixed now
     // No idea how this has not caused more issues
-    for (const Texture* t : m_textures)
+    m_textures.ForEach([](const Texture* a_texture)
     {
-        if (t != nullptr)
+        if (a_texture != nullptr)
         {
-            delete t;
+            delete a_texture;
         }
-    }
-    m_textures.clear();
+    });
+    m_textures.Clear();
 
-    for (const TextureSamplerBuffer& sampler : m_samplers)
+    m_samplers.ForEach([](const TextureSamplerBuffer& a_sampler)
     {
-        if (sampler.Data != nullptr)
+        if (a_sampler.Data != nullptr)
         {
-            delete (TextureSampler*)sampler.Data;
+            delete (TextureSampler*)a_sampler.Data;
         }
-    }
-    m_samplers.clear();
+    });
+    m_samplers.Clear();
 
     m_vertexImports.clear();
 
-    for (const VertexShader* v : m_vertexShaders)
+    m_vertexShaders.ForEach([](const VertexShader* a_shader)
     {
-        if (v != nullptr)
+        if (a_shader != nullptr)
         {
-            delete v;
+            delete a_shader;
         }
-    }
-    m_vertexShaders.clear();
+    });
+    m_vertexShaders.Clear();
 
     m_pixelImports.clear();
 
-    for (const PixelShader* p : m_pixelShaders)
+    m_pixelShaders.ForEach([](const PixelShader* a_shader)
     {
-        if (p != nullptr)
+        if (a_shader != nullptr)
         {
-            delete p;
+            delete a_shader;
         }
-    }
-    m_pixelShaders.clear();
+    });
+    m_pixelShaders.Clear();
 
-    m_renderPrograms.clear();
-    m_samplers.clear();
+    m_renderPrograms.Clear();
 }
 
 uint32_t RuntimeStorage::GenerateVertexShader(const std::filesystem::path& a_path)
@@ -803,20 +409,15 @@ uint32_t RuntimeStorage::GenerateVertexShader(const std::filesystem::path& a_pat
             break;
         }
 
-        const uint32_t shaderCount = (uint32_t)m_vertexShaders.size();
-        for (uint32_t i = 0; i < shaderCount; ++i)
+        const uint32_t addr = m_vertexShaders.Allocate(vShader);
+        if (addr == -1)
         {
-            if (m_vertexShaders[i] == nullptr)
-            {
-                m_vertexShaders[i] = vShader;
+            Logger::Error("Out of VertexShader slots: " + a_path.string());
 
-                return i;
-            }
+            delete vShader;
         }
 
-        m_vertexShaders.emplace_back(vShader);
-
-        return shaderCount;
+        return addr;
     }
     }
 
@@ -839,8 +440,15 @@ void RuntimeStorage::AddVertexImport(const std::string_view& a_key, const std::s
 }
 void RuntimeStorage::DestroyVertexShader(uint32_t a_addr)
 {
-    delete m_vertexShaders[a_addr];
-    m_vertexShaders[a_addr] = nullptr;
+    const VertexShader* shader = m_vertexShaders.Get(a_addr);
+    if (!m_vertexShaders.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale VertexShader address");
+
+        return;
+    }
+
+    delete shader;
 }
 
 uint32_t RuntimeStorage::GeneratePixelShader(const std::filesystem::path& a_path)
@@ -875,20 +483,15 @@ uint32_t RuntimeStorage::GeneratePixelShader(const std::filesystem::path& a_path
             break;
         }
 
-        const uint32_t shaderCount = (uint32_t)m_pixelShaders.size();
-        for (uint32_t i = 0; i < shaderCount; ++i)
+        const uint32_t addr = m_pixelShaders.Allocate(pShader);
+        if (addr == -1)
         {
-            if (m_pixelShaders[i] == nullptr)
-            {
-                m_pixelShaders[i] = pShader;
+            Logger::Error("Out of PixelShader slots: " + a_path.string());
 
-                return i;
-            }
+            delete pShader;
         }
 
-        m_pixelShaders.emplace_back(pShader);
-
-        return shaderCount;
+        return addr;
     }
     }
 
@@ -911,8 +514,15 @@ void RuntimeStorage::AddPixelImport(const std::string_view& a_key, const std::st
 }
 void RuntimeStorage::DestroyPixelShader(uint32_t a_addr)
 {
-    delete m_pixelShaders[a_addr];
-    m_pixelShaders[a_addr] = nullptr;
+    const PixelShader* shader = m_pixelShaders.Get(a_addr);
+    if (!m_pixelShaders.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale PixelShader address");
+
+        return;
+    }
+
+    delete shader;
 }
 
 static void SetRenderBuffers(const Shader* a_shader, const RenderProgram& a_program)
@@ -983,31 +593,58 @@ uint32_t RuntimeStorage::GenerateRenderProgram(const RenderProgram& a_program)
         SetRenderBuffers(pShader, program);
     }
 
-    const uint32_t programCount = (uint32_t)m_renderPrograms.size();
-    for (uint32_t i = 0; i < programCount; ++i)
+    const uint32_t addr = m_renderPrograms.Allocate(program);
+    if (addr == -1)
     {
-        if (m_renderPrograms[i].Flags & 0b1 << RenderProgram::FreeFlag)
-        {            
-            m_renderPrograms[i] = program;
+        Logger::Error("Out of RenderProgram slots");
 
-            return i;
-        }
+        delete storage;
     }
 
-    m_renderPrograms.emplace_back(program);
+    return addr;
+}
+RenderProgram RuntimeStorage::GetRenderProgram(uint32_t a_addr) const
+{
+    RenderProgram invalid;
+    memset(&invalid, 0, sizeof(RenderProgram));
+    invalid.VertexShader = -1;
+    invalid.PixelShader = -1;
+    invalid.ShadowVertexShader = -1;
+    invalid.Flags = 0b1 << RenderProgram::FreeFlag;
 
-    return programCount;
+    return m_renderPrograms.Get(a_addr, invalid);
+}
+void RuntimeStorage::SetRenderProgram(uint32_t a_addr, const RenderProgram& a_program)
+{
+    if (!m_renderPrograms.Set(a_addr, a_program))
+    {
+        Logger::Warning("Setting stale RenderProgram address");
+    }
 }
 void RuntimeStorage::SetProgramTexture(uint32_t a_addr, uint32_t a_slot, uint32_t a_textureAddr)
 {
-    const RenderProgram& program = m_renderPrograms[a_addr];
+    const RenderProgram program = m_renderPrograms.Get(a_addr);
 
     ShaderStorage* storage = (ShaderStorage*)program.Data;
+    if (storage == nullptr)
+    {
+        Logger::Warning("Setting texture on stale RenderProgram address");
+
+        return;
+    }
+
     storage->SetTexture(a_slot, a_textureAddr);
 }
 void RuntimeStorage::DestroyRenderProgram(uint32_t a_addr)
 {
-    RenderProgram& program = m_renderPrograms[a_addr];
+    const RenderProgram program = m_renderPrograms.Get(a_addr);
+    if (!m_renderPrograms.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale RenderProgram address");
+
+        return;
+    }
+
     if (program.Flags & 0b1 << RenderProgram::DestroyFlag)
     {
         DestroyVertexShader(program.VertexShader);
@@ -1015,78 +652,172 @@ void RuntimeStorage::DestroyRenderProgram(uint32_t a_addr)
     }
 
     delete (ShaderStorage*)program.Data;
-    program.Data = nullptr;
+}
 
-    program.Flags = 0b1 << RenderProgram::FreeFlag;
+static bool IsModelExtension(const std::filesystem::path& a_ext, bool a_allowObj)
+{
+    const std::string extStr = a_ext.string();
+    switch (StringHash<uint32_t>(extStr.c_str()))
+    {
+    case StringHash<uint32_t>(".obj"):
+    {
+        return a_allowObj;
+    }
+    case StringHash<uint32_t>(".dae"):
+    case StringHash<uint32_t>(".fbx"):
+    case StringHash<uint32_t>(".glb"):
+    case StringHash<uint32_t>(".gltf"):
+    {
+        return true;
+    }
+    }
+
+    return false;
 }
 
 uint32_t RuntimeStorage::GenerateModel(const void* a_vertices, uint32_t a_vertexCount, const uint32_t* a_indices, uint32_t a_indexCount, uint16_t a_vertexStride)
 {
-    Model* mdl = new Model(a_vertices, a_vertexCount, (GLuint*)a_indices, a_indexCount, a_vertexStride);
+    Model* model = new Model(a_vertices, a_vertexCount, (GLuint*)a_indices, a_indexCount, a_vertexStride);
 
-    const uint32_t modelCount = (uint32_t)m_models.size();
-    for (uint32_t i = 0; i < modelCount; ++i)
+    const uint32_t addr = m_models.Allocate(model);
+    if (addr == -1)
     {
-        if (m_models[i] == nullptr)
-        {
-            m_models[i] = mdl;
+        Logger::Error("Out of Model slots");
 
-            return i;
-        }
+        delete model;
+    }
+
+    return addr;
+}
+uint32_t RuntimeStorage::GenerateModelFromFile(const std::filesystem::path& a_path, uint32_t a_index, bool a_skinned)
+{
+    // Obj has no skinning data
+    if (!IsModelExtension(a_path.extension(), !a_skinned))
+    {
+        Logger::Error((a_skinned ? "Skinned mesh invalid file extension: " : "Mesh invalid file extension: ") + a_path.string());
+
+        return -1;
+    }
+
+    const uint8_t* dat;
+    uint32_t size;
+    m_assets->GetAsset(a_path, &size, &dat);
+    if (size <= 0 || dat == nullptr)
+    {
+        Logger::Error((a_skinned ? "Cannot find skinned mesh file: " : "Cannot find mesh file: ") + a_path.string());
+
+        return -1;
+    }
+
+    // Hand back the address straight away and fill it in once the import lands so scenes with a lot of meshes import in parallel
+    // Slot is held with a null model until the import lands
+    const uint32_t addr = m_models.Allocate(nullptr);
+    if (addr == -1)
+    {
+        Logger::Error("Out of Model slots: " + a_path.string());
+
+        return -1;
     }
 
-    m_models.emplace_back(mdl);
+    m_pendingModels.emplace(addr, m_modelImporter->Import(a_skinned ? ModelImportType_SkinnedMesh : ModelImportType_Mesh, a_path, dat, size, a_index, GetCachePath()));
 
-    return modelCount;
+    return addr;
 }
 void RuntimeStorage::DestroyModel(uint32_t a_addr)
 {
-    delete m_models[a_addr];
-    m_models[a_addr] = nullptr;
+    const Model* model = m_models.Get(a_addr);
+    if (!m_models.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale Model address");
+
+        return;
+    }
+
+    // Result gets dropped when the import finishes
+    m_pendingModels.erase(a_addr);
+
+    delete model;
 }
 
 uint32_t RuntimeStorage::GenerateTexture(uint32_t a_width, uint32_t a_height, const unsigned char* a_data)
 {
     Texture* texture = Texture::CreateRGBA(a_width, a_height, a_data);
 
-    const uint32_t textureCount = (uint32_t)m_textures.size();
-    for (uint32_t i = 0; i < textureCount; ++i)
+    const uint32_t addr = m_textures.Allocate(texture);
+    if (addr == -1)
     {
-        if (m_textures[i] == nullptr)
-        {
-            m_textures[i] = texture;
+        Logger::Error("Out of Texture slots");
 
-            return i;
-        }
+        delete texture;
     }
 
-    m_textures.emplace_back(texture);
-
-    return textureCount;
+    return addr;
 }
 uint32_t RuntimeStorage::GenerateTextureFromHandle(uint32_t a_handle)
 {
     Texture* texture = new Texture((GLuint)a_handle);
 
-    const uint32_t textureCount = (uint32_t)m_textures.size();
-    for (uint32_t i = 0; i < textureCount; ++i)
+    const uint32_t addr = m_textures.Allocate(texture);
+    if (addr == -1)
     {
-        if (m_textures[i] == nullptr)
-        {
-            m_textures[i] = texture;
+        Logger::Error("Out of Texture slots");
 
-            return i;
-        }
+        delete texture;
+    }
+
+    return addr;
+}
+uint32_t RuntimeStorage::GenerateTextureFromFile(const std::filesystem::path& a_path)
+{
+    const std::filesystem::path ext = a_path.extension();
+    if (ext != ".png" && ext != ".ktx2")
+    {
+        return -1;
+    }
+
+    const uint8_t* dat;
+    uint32_t size;
+    m_assets->GetAsset(a_path, &size, &dat);
+
+    if (dat == nullptr || size <= 0)
+    {
+        return -1;
     }
 
-    m_textures.emplace_back(texture);
+    constexpr uint8_t Placeholder[] = { 128, 128, 128, 255 };
 
-    return textureCount;
+    GLuint handle;
+    glGenTextures(1, &handle);
+    glBindTexture(GL_TEXTURE_2D, handle);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, Placeholder);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+
+    const uint32_t addr = GenerateTextureFromHandle((uint32_t)handle);
+    if (addr == -1)
+    {
+        return -1;
+    }
+
+    m_textureLoader->Load(handle, a_path, dat, size, m_project->GetCachePath(), EditorConfig::GetTextureQuality());
+
+    return addr;
 }
 void RuntimeStorage::DestroyTexture(uint32_t a_addr)
 {
-    delete m_textures[a_addr];
-    m_textures[a_addr] = nullptr;
+    Texture* texture = m_textures.Get(a_addr);
+    if (!m_textures.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale Texture address");
+
+        return;
+    }
+
+    if (texture != nullptr)
+    {
+        m_textureLoader->Cancel(texture->GetHandle());
+    }
+
+    delete texture;
 }
 
 uint32_t RuntimeStorage::GenerateTextureSampler(uint32_t a_texture, e_TextureFilter a_filter, e_TextureAddress a_address)
@@ -1102,179 +833,156 @@ uint32_t RuntimeStorage::GenerateTextureSampler(uint32_t a_texture, e_TextureFil
         .Data = sampler
     };
 
-    const uint32_t samplerCount = (uint32_t)m_samplers.size();
-    for (uint32_t i = 0; i < samplerCount; ++i)
+    const uint32_t addr = m_samplers.Allocate(buffer);
+    if (addr == -1)
     {
-        if (m_samplers[i].Data == nullptr)
-        {
-            m_samplers[i] = buffer;
+        Logger::Error("Out of TextureSampler slots");
 
-            return i;
-        }
+        delete sampler;
     }
 
-    m_samplers.emplace_back(buffer);
-
-    return samplerCount;
+    return addr;
 }
 void RuntimeStorage::DestroyTextureSampler(uint32_t a_addr)
 {
-    delete (TextureSampler*)m_samplers[a_addr].Data;
-    m_samplers[a_addr].Data = nullptr;
+    const TextureSamplerBuffer buffer = m_samplers.Get(a_addr);
+    if (!m_samplers.Free(a_addr))
+    {
+        Logger::Warning("Destroying stale TextureSampler address");
+
+        return;
+    }
+
+    delete (TextureSampler*)buffer.Data;
 }
 
-MonoArray* RuntimeStorage::LoadExternalAnimationClip(const std::filesystem::path& a_path)
+RuntimeImportBoneData RuntimeStorage::LoadBoneData(const std::filesystem::path& a_path)
 {
-    const std::filesystem::path ext = a_path.extension();
-    const std::string extStr = ext.string();
+    RuntimeImportBoneData data = { 0 };
 
-    AssetLibrary* library = Instance->GetLibrary();
-    switch (StringHash<uint32_t>(extStr.c_str())) 
+    if (!IsModelExtension(a_path.extension(), false))
     {
-    case StringHash<uint32_t>(".dae"):
-    case StringHash<uint32_t>(".fbx"):
-    case StringHash<uint32_t>(".glb"):
-    case StringHash<uint32_t>(".gltf"):
+        Logger::Error("Skeleton invalid file extension: " + a_path.string());
+
+        return data;
+    }
+
+    const uint8_t* dat;
+    uint32_t size;
+    m_assets->GetAsset(a_path, &size, &dat);
+    if (size <= 0 || dat == nullptr)
     {
-        uint32_t size;
-        const uint8_t* dat;
-        library->GetAsset(a_path, &size, &dat);
-        if (size <= 0 || dat == nullptr)
-        {
-            Logger::Error("Cannot find animation clip file: " + a_path.string());
+        Logger::Error("Cannot find skeleton file: " + a_path.string());
 
-            break;
-        }
+        return data;
+    }
+
+    // Mono wants the data back straight away so import here rather then waiting behind the queue
+    // Still goes through the model cache
+    const ModelImportResult result = m_modelImporter->ImportImmediate(ModelImportType_Bones, a_path, dat, size, 0, GetCachePath());
+
+    const uint32_t boneCount = (uint32_t)result.Bones.size();
+    if (!result.Valid || boneCount <= 0)
+    {
+        return data;
+    }
 
-        Assimp::Importer importer;
+    MonoDomain* domain = mono_domain_get();
+    MonoClass* fClass = mono_get_single_class();
 
-        const aiScene* scene = importer.ReadFileFromMemory(dat, (size_t)size, 0, extStr.c_str() + 1);
-        ICARIAN_ASSERT(scene != nullptr);
+    data.BindPoses = mono_array_new(domain, mono_get_array_class(), (uintptr_t)boneCount);
+    data.Names = mono_array_new(domain, mono_get_string_class(), (uintptr_t)boneCount);
+    data.Parents = mono_array_new(domain, mono_get_uint32_class(), (uintptr_t)boneCount);
 
-        if (scene->mNumAnimations <= 0)
+    for (uint32_t i = 0; i < boneCount; ++i)
+    {
+        const ModelCacheBone& bone = result.Bones[i];
+
+        MonoArray* bindPoseArr = mono_array_new(domain, fClass, 16);
+        for (uint32_t j = 0; j < 16; ++j)
         {
-            break;
+            mono_array_set(bindPoseArr, float, j, bone.BindPose[j]);
         }
 
-        const aiAnimation* animation = scene->mAnimations[0];
+        mono_array_set(data.BindPoses, MonoArray*, i, bindPoseArr);
+        mono_array_set(data.Names, MonoString*, i, mono_string_new(domain, result.BoneNames[i].c_str()));
+        mono_array_set(data.Parents, uint32_t, i, bone.Parent);
+    }
 
-        std::vector<AnimationDataExternal> dataArray;
+    return data;
+}
 
-        MonoDomain* domain = RuntimeManager::GetEditorDomain();
-        MonoClass* frameClass = RuntimeManager::GetClass("IcarianEngine.Rendering.Animation", "AnimationFrameExternal");
-        ICARIAN_ASSERT(frameClass != NULL);
+MonoArray* RuntimeStorage::LoadExternalAnimationClip(const std::filesystem::path& a_path)
+{
+    if (!IsModelExtension(a_path.extension(), false))
+    {
+        Logger::Error("Animation clip invalid file extension: " + a_path.string());
 
-        const uint32_t channelCount = (uint32_t)animation->mNumChannels;
-        for (uint32_t i = 0; i < channelCount; ++i)
-        {
-            const aiNodeAnim* anim = animation->mChannels[i];
+        return NULL;
+    }
 
-            const uint32_t posCount = (uint32_t)anim->mNumPositionKeys;
-            if (posCount > 0)
-            {
-                const AnimationDataExternal dat =
-                {
-                    .Name = mono_string_new(domain, anim->mNodeName.C_Str()),
-                    .Target = mono_string_new(domain, "Translation"),
-                    .Frames = mono_array_new(domain, frameClass, (uintptr_t)posCount),
-                };
-
-                for (uint32_t j = 0; j < posCount; ++j)
-                {
-                    const aiVectorKey& posKey = anim->mPositionKeys[j];
-
-                    const AnimationFrameExternal frame =
-                    {
-                        .Time = (float)posKey.mTime,
-                        .Data = glm::vec4(posKey.mValue.x, -posKey.mValue.y, posKey.mValue.z, 1.0f),
-                    };
-
-                    mono_array_set(dat.Frames, AnimationFrameExternal, j, frame);
-                }
-
-                dataArray.emplace_back(dat);
-            }
+    uint32_t size;
+    const uint8_t* dat;
+    m_assets->GetAsset(a_path, &size, &dat);
+    if (size <= 0 || dat == nullptr)
+    {
+        Logger::Error("Cannot find animation clip file: " + a_path.string());
 
-            const uint32_t rotCount = (uint32_t)anim->mNumRotationKeys;
-            if (rotCount > 0)
-            {
-                const AnimationDataExternal dat =
-                {
-                    .Name = mono_string_new(domain, anim->mNodeName.C_Str()),
-                    .Target = mono_string_new(domain, "Rotation"),
-                    .Frames = mono_array_new(domain, frameClass, (uintptr_t)rotCount),
-                };
-
-                for (uint32_t j = 0; j < rotCount; ++j)
-                {
-                    const aiQuatKey& rotKey = anim->mRotationKeys[j];
-
-                    const AnimationFrameExternal frame = 
-                    {
-                        .Time = (float)rotKey.mTime,
-                        .Data = glm::vec4(rotKey.mValue.x, -rotKey.mValue.y, rotKey.mValue.z, rotKey.mValue.w),
-                    };
-
-                    mono_array_set(dat.Frames, AnimationFrameExternal, j, frame);
-                }
-
-                dataArray.emplace_back(dat);
-            }
+        return NULL;
+    }
 
-            const uint32_t scaleCount = (uint32_t)anim->mNumScalingKeys;
-            if (scaleCount > 0)
-            {
-                const AnimationDataExternal dat =
-                {
-                    .Name = mono_string_new(domain, anim->mNodeName.C_Str()),
-                    .Target = mono_string_new(domain, "Scale"),
-                    .Frames = mono_array_new(domain, frameClass, (uintptr_t)scaleCount)
-                };
-
-                for (uint32_t j = 0; j < scaleCount; ++j)
-                {
-                    const aiVectorKey& scaleKey = anim->mScalingKeys[j];
-
-                    const AnimationFrameExternal frame = 
-                    {
-                        .Time = (float)scaleKey.mTime,
-                        .Data = glm::vec4(scaleKey.mValue.x, scaleKey.mValue.y, scaleKey.mValue.z, 0.0f)
-                    };
-
-                    mono_array_set(dat.Frames, AnimationFrameExternal, j, frame);
-                }
-
-                dataArray.emplace_back(dat);
-            }
-        }
+    const ModelImportResult result = m_modelImporter->ImportImmediate(ModelImportType_Animation, a_path, dat, size, 0, GetCachePath());
+
+    const uint32_t channelCount = (uint32_t)result.Channels.size();
+    if (!result.Valid || channelCount <= 0)
+    {
+        return NULL;
+    }
+
+    MonoDomain* domain = RuntimeManager::GetEditorDomain();
+    MonoClass* frameClass = RuntimeManager::GetClass("IcarianEngine.Rendering.Animation", "AnimationFrameExternal");
+    ICARIAN_ASSERT(frameClass != NULL);
+    MonoClass* dataClass = RuntimeManager::GetClass("IcarianEngine.Rendering.Animation", "AnimationDataExternal");
+    ICARIAN_ASSERT(dataClass != NULL);
+
+    MonoString* targets[] = 
+    {
+        mono_string_new(domain, "Translation"),
+        mono_string_new(domain, "Rotation"),
+        mono_string_new(domain, "Scale")
+    };
 
-        const uint32_t dataCount = (uint32_t)dataArray.size();
-        if (dataCount > 0)
+    MonoArray* array = mono_array_new(domain, dataClass, (uintptr_t)channelCount);
+
+    for (uint32_t i = 0; i < channelCount; ++i)
+    {
+        const ModelImportChannel& channel = result.Channels[i];
+        const uint32_t frameCount = (uint32_t)channel.Frames.size();
+
+        const AnimationDataExternal dat =
         {
-            MonoClass* dataClass = RuntimeManager::GetClass("IcarianEngine.Rendering.Animation", "AnimationDataExternal");
-            ICARIAN_ASSERT(dataClass != NULL);
+            .Name = mono_string_new(domain, channel.Name.c_str()),
+            .Target = targets[channel.Target],
+            .Frames = mono_array_new(domain, frameClass, (uintptr_t)frameCount)
+        };
 
-            MonoArray* array = mono_array_new(domain, dataClass, (uintptr_t)dataCount);
+        for (uint32_t j = 0; j < frameCount; ++j)
+        {
+            const ModelImportFrame& importFrame = channel.Frames[j];
 
-            for (uint32_t i = 0; i < dataCount; ++i)
+            const AnimationFrameExternal frame =
             {
-                mono_array_set(array, AnimationDataExternal, i, dataArray[i]);
-            }
+                .Time = importFrame.Time,
+                .Data = importFrame.Data
+            };
 
-            return array;
+            mono_array_set(dat.Frames, AnimationFrameExternal, j, frame);
         }
 
-        break;
-    }
-    default:
-    {
-        Logger::Error("Animation clip invalid file extension: " + a_path.string());
-
-        break;
-    }
+        mono_array_set(array, AnimationDataExternal, i, dat);
     }
 
-    return NULL;
+    return array;
 }
 
 // MIT License
@@ -0,0 +1,88 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "ScratchArena.h"
+
+static constexpr uint32_t Alignment = 8;
+
+ScratchArena::ScratchArena(uint32_t a_blockSize)
+{
+    m_blockSize = a_blockSize;
+    m_block = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+ScratchArena::~ScratchArena()
+{
+    for (const Block& block : m_blocks)
+    {
+        delete[] block.Data;
+    }
+}
+
+void* ScratchArena::Allocate(uint32_t a_size)
+{
+    const uint32_t size = (a_size + (Alignment - 1)) & ~(Alignment - 1);
+
+    while (m_block < m_blocks.size())
+    {
+        const Block& block = m_blocks[m_block];
+        if (m_offset + size <= block.Size)
+        {
+            char* data = block.Data + m_offset;
+
+            m_offset += size;
+            m_used += size;
+
+            return data;
+        }
+
+        ++m_block;
+        m_offset = 0;
+    }
+
+    const uint32_t blockSize = size > m_blockSize ? size : m_blockSize;
+
+    const Block block = 
+    {
+        .Data = new char[blockSize],
+        .Size = blockSize
+    };
+    m_blocks.emplace_back(block);
+
+    m_block = (uint32_t)m_blocks.size() - 1;
+    m_offset = size;
+    m_used += size;
+
+    return block.Data;
+}
+
+void ScratchArena::Reset()
+{
+    m_block = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -34,6 +34,11 @@ void ShaderStorage::Bind()
         const TextureSamplerBuffer buffer = m_storage->GetSamplerBuffer(binding.Sampler);
         const Texture* tex = m_storage->GetTexture(buffer.Addr);
         const TextureSampler* sampler = (TextureSampler*)buffer.Data;
+        // Sampler or texture may have been destroyed out from under the material
+        if (tex == nullptr || sampler == nullptr)
+        {
+            continue;
+        }
 
         glActiveTexture(GL_TEXTURE0 + i);
         glBindTexture(GL_TEXTURE_2D, tex->GetHandle());
@@ -25,7 +25,9 @@ Texture* Texture::CreateRGBA(uint32_t a_width, uint32_t a_height, const unsigned
     GLuint handle;
     glGenTextures(1, &handle);
     glBindTexture(GL_TEXTURE_2D, handle);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA, (GLsizei)a_width, (GLsizei)a_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, a_data);
+    // Explicit format so the driver does not compress on the main thread, compression is done up front by TextureLoader instead
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei)a_width, (GLsizei)a_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, a_data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
 
     return new Texture(handle);
 }
@@ -0,0 +1,231 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "TextureCompressor.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "Core/IcarianDefer.h"
+#include "Hash.h"
+#include "IO.h"
+#include "KtxHelpers.h"
+
+static constexpr const char* QualityNames[] =
+{
+    "Uncompressed",
+    "Fast",
+    "Normal",
+    "High"
+};
+static_assert(sizeof(QualityNames) / sizeof(*QualityNames) == TextureQuality_End);
+
+static ktx_uint32_t GetUASTCLevel(e_TextureQuality a_quality)
+{
+    switch (a_quality)
+    {
+    case TextureQuality_Fast:
+    {
+        return KTX_PACK_UASTC_LEVEL_FASTEST;
+    }
+    case TextureQuality_High:
+    {
+        return KTX_PACK_UASTC_LEVEL_SLOWER;
+    }
+    default:
+    {
+        break;
+    }
+    }
+
+    return KTX_PACK_UASTC_LEVEL_DEFAULT;
+}
+
+void TextureCompressor::GenerateMips(std::vector<TextureLevel>* a_levels, std::vector<uint8_t>* a_data)
+{
+    TextureLevel level = a_levels->back();
+    while (level.Width > 1 || level.Height > 1)
+    {
+        const uint32_t width = std::max(1U, level.Width / 2);
+        const uint32_t height = std::max(1U, level.Height / 2);
+        const uint64_t offset = a_data->size();
+        const uint64_t size = (uint64_t)width * height * 4;
+
+        a_data->resize(offset + size);
+
+        const uint8_t* src = a_data->data() + level.Offset;
+        uint8_t* dst = a_data->data() + offset;
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const uint32_t y0 = std::min(y * 2, level.Height - 1);
+            const uint32_t y1 = std::min(y * 2 + 1, level.Height - 1);
+
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const uint32_t x0 = std::min(x * 2, level.Width - 1);
+                const uint32_t x1 = std::min(x * 2 + 1, level.Width - 1);
+
+                const uint8_t* p00 = src + (y0 * level.Width + x0) * 4;
+                const uint8_t* p01 = src + (y0 * level.Width + x1) * 4;
+                const uint8_t* p10 = src + (y1 * level.Width + x0) * 4;
+                const uint8_t* p11 = src + (y1 * level.Width + x1) * 4;
+
+                uint8_t* out = dst + (y * width + x) * 4;
+                for (uint32_t i = 0; i < 4; ++i)
+                {
+                    out[i] = (uint8_t)(((uint32_t)p00[i] + p01[i] + p10[i] + p11[i] + 2) / 4);
+                }
+            }
+        }
+
+        level = TextureLevel{ width, height, offset, size };
+        a_levels->emplace_back(level);
+    }
+}
+
+bool TextureCompressor::Compress(uint32_t a_width, uint32_t a_height, const uint8_t* a_pixels, e_TextureQuality a_quality, std::vector<uint8_t>* a_ktx)
+{
+    const uint64_t size = (uint64_t)a_width * a_height * 4;
+
+    std::vector<TextureLevel> levels;
+    levels.emplace_back(TextureLevel{ a_width, a_height, 0, size });
+
+    std::vector<uint8_t> data;
+    data.reserve(size + size / 2);
+    data.assign(a_pixels, a_pixels + size);
+
+    // Mips are built from the source pixels rather then left to the driver so they get compressed with everything else
+    GenerateMips(&levels, &data);
+
+    const uint32_t levelCount = (uint32_t)levels.size();
+
+    const ktxTextureCreateInfo createInfo = 
+    {
+        .vkFormat = KTX_VKFORMAT_R8G8B8A8_UNORM,
+        .baseWidth = (ktx_uint32_t)a_width,
+        .baseHeight = (ktx_uint32_t)a_height,
+        .baseDepth = 1,
+        .numDimensions = 2,
+        .numLevels = (ktx_uint32_t)levelCount,
+        .numLayers = 1,
+        .numFaces = 1,
+        .generateMipmaps = KTX_FALSE
+    };
+
+    ktxTexture2* ktxTex;
+    if (ktxTexture2_Create(&createInfo, KTX_TEXTURE_CREATE_ALLOC_STORAGE, &ktxTex) != KTX_SUCCESS)
+    {
+        return false;
+    }
+    IDEFER(ktxTexture_Destroy((ktxTexture*)ktxTex));
+
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        const TextureLevel& level = levels[i];
+        if (ktxTexture_SetImageFromMemory((ktxTexture*)ktxTex, i, 0, 0, data.data() + level.Offset, (ktx_size_t)level.Size) != KTX_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    // UASTC transcodes to BC7 nearly losslessly so the quality tier only trades encode time against block quality
+    ktxBasisParams basisParam = { 0 };
+    basisParam.structSize = sizeof(basisParam);
+    basisParam.uastc = KTX_TRUE;
+    basisParam.uastcFlags = GetUASTCLevel(a_quality);
+    // Already running on a worker with other textures alongside
+    basisParam.threadCount = 1;
+
+    if (ktxTexture2_CompressBasisEx(ktxTex, &basisParam) != KTX_SUCCESS)
+    {
+        return false;
+    }
+
+    if (ktxTexture2_TranscodeBasis(ktxTex, KTX_TTF_BC7_RGBA, 0) != KTX_SUCCESS)
+    {
+        return false;
+    }
+
+    ktx_uint8_t* ktxDat;
+    ktx_size_t ktxDatSize;
+    if (ktxTexture_WriteToMemory((ktxTexture*)ktxTex, &ktxDat, &ktxDatSize) != KTX_SUCCESS)
+    {
+        return false;
+    }
+    IDEFER(free(ktxDat));
+
+    a_ktx->assign(ktxDat, ktxDat + ktxDatSize);
+
+    return true;
+}
+
+std::filesystem::path TextureCompressor::GetCacheFile(const std::filesystem::path& a_cachePath, const uint8_t* a_data, uint64_t a_size, e_TextureQuality a_quality)
+{
+    const uint64_t hash = FNVHash(a_data, a_size);
+
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx_%u_%u.ktx2", (unsigned long long)hash, (uint32_t)a_quality, CacheVersion);
+
+    return a_cachePath / "Textures" / name;
+}
+bool TextureCompressor::ReadCache(const std::filesystem::path& a_path, std::vector<uint8_t>* a_ktx)
+{
+    std::ifstream file = std::ifstream(a_path, std::ios::binary | std::ios::ate);
+    if (!file.good())
+    {
+        return false;
+    }
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0)
+    {
+        return false;
+    }
+
+    file.seekg(0, std::ios::beg);
+
+    a_ktx->resize((size_t)size);
+    file.read((char*)a_ktx->data(), size);
+
+    return file.good();
+}
+void TextureCompressor::WriteCache(const std::filesystem::path& a_path, const std::vector<uint8_t>& a_ktx)
+{
+    IO::WriteFileAtomic(a_path, { { a_ktx.data(), (uint32_t)a_ktx.size() } });
+}
+
+const char* TextureCompressor::GetQualityName(e_TextureQuality a_quality)
+{
+    if (a_quality >= TextureQuality_End)
+    {
+        return "Unknown";
+    }
+
+    return QualityNames[a_quality];
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
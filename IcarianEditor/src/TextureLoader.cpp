@@ -0,0 +1,457 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "TextureLoader.h"
+
+#define STBI_NO_STDIO
+#include <stb_image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Core/IcarianDefer.h"
+#include "EditorProfiler.h"
+#include "KtxHelpers.h"
+#include "Logger.h"
+
+TextureLoader::TextureLoader()
+{
+    m_shutdown = false;
+    m_nextTicket = 0;
+    m_residentTotal = 0;
+
+    for (uint32_t i = 0; i < StagingBufferCount; ++i)
+    {
+        StagingBuffer& staging = m_stagingBuffers[i];
+
+        glGenBuffers(1, &staging.Buffer);
+        staging.Size = 0;
+        staging.Fence = nullptr;
+    }
+    m_stagingIndex = 0;
+
+    const uint32_t workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1U, 4U);
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&TextureLoader::Run, this);
+    }
+}
+TextureLoader::~TextureLoader()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_shutdown = true;
+        m_jobs.clear();
+    }
+    m_jobSignal.notify_all();
+
+    for (std::thread& thread : m_workers)
+    {
+        thread.join();
+    }
+
+    for (uint32_t i = 0; i < StagingBufferCount; ++i)
+    {
+        StagingBuffer& staging = m_stagingBuffers[i];
+        if (staging.Fence != nullptr)
+        {
+            glDeleteSync(staging.Fence);
+        }
+
+        glDeleteBuffers(1, &staging.Buffer);
+    }
+}
+
+bool TextureLoader::DecodeKTX(const uint8_t* a_data, uint64_t a_size, TextureResult* a_result)
+{
+    ktxTexture2* ktxTex;
+    if (ktxTexture2_CreateFromMemory((const ktx_uint8_t*)a_data, (ktx_size_t)a_size, KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &ktxTex) != KTX_SUCCESS)
+    {
+        return false;
+    }
+    IDEFER(ktxTexture_Destroy((ktxTexture*)ktxTex));
+
+    if (ktxTexture2_NeedsTranscoding(ktxTex))
+    {
+        if (ktxTexture2_TranscodeBasis(ktxTex, KTX_TTF_BC3_RGBA, 0) != KTX_SUCCESS)
+        {
+            return false;
+        }
+    }
+
+    a_result->InternalFormat = GLInternalFormatFromKtxVkFormat(ktxTex->vkFormat);
+    a_result->Format = GLFormatFromKtxVkFormat(ktxTex->vkFormat);
+    a_result->Type = GLTypeFromKtxVkFormat(ktxTex->vkFormat);
+    a_result->Compressed = ktxTex->isCompressed;
+
+    const ktx_uint8_t* data = ktxTexture_GetData((ktxTexture*)ktxTex);
+    const ktx_size_t dataSize = ktxTexture_GetDataSize((ktxTexture*)ktxTex);
+    a_result->Data.assign(data, data + dataSize);
+
+    for (uint32_t i = 0; i < ktxTex->numLevels; ++i)
+    {
+        ktx_size_t offset;
+        if (ktxTexture_GetImageOffset((ktxTexture*)ktxTex, i, 0, 0, &offset) != KTX_SUCCESS)
+        {
+            return false;
+        }
+
+        const TextureLevel level =
+        {
+            .Width = std::max(1U, ktxTex->baseWidth >> i),
+            .Height = std::max(1U, ktxTex->baseHeight >> i),
+            .Offset = (uint64_t)offset,
+            .Size = (uint64_t)ktxTexture_GetImageSize((ktxTexture*)ktxTex, i)
+        };
+
+        a_result->Levels.emplace_back(level);
+    }
+
+    // Can only build the chain ourselves for plain RGBA, compressed files have to ship their own mips
+    if (a_result->Levels.size() == 1 && a_result->Format == GL_RGBA && a_result->Type == GL_UNSIGNED_BYTE && !a_result->Compressed)
+    {
+        TextureCompressor::GenerateMips(&a_result->Levels, &a_result->Data);
+    }
+
+    return !a_result->Levels.empty();
+}
+bool TextureLoader::DecodePNG(const TextureJob& a_job, TextureResult* a_result)
+{
+    std::filesystem::path cacheFile;
+    if (a_job.Quality != TextureQuality_Uncompressed && !a_job.CachePath.empty())
+    {
+        cacheFile = TextureCompressor::GetCacheFile(a_job.CachePath, a_job.Data.data(), (uint64_t)a_job.Data.size(), a_job.Quality);
+
+        std::vector<uint8_t> cached;
+        if (TextureCompressor::ReadCache(cacheFile, &cached) && DecodeKTX(cached.data(), (uint64_t)cached.size(), a_result))
+        {
+            return true;
+        }
+
+        a_result->Levels.clear();
+        a_result->Data.clear();
+    }
+
+    int width;
+    int height;
+    int channels;
+
+    stbi_uc* pixels = stbi_load_from_memory((const stbi_uc*)a_job.Data.data(), (int)a_job.Data.size(), &width, &height, &channels, STBI_rgb_alpha);
+    if (pixels == nullptr)
+    {
+        return false;
+    }
+    IDEFER(stbi_image_free(pixels));
+
+    if (a_job.Quality != TextureQuality_Uncompressed)
+    {
+        std::vector<uint8_t> ktx;
+        if (TextureCompressor::Compress((uint32_t)width, (uint32_t)height, pixels, a_job.Quality, &ktx) && DecodeKTX(ktx.data(), (uint64_t)ktx.size(), a_result))
+        {
+            if (!cacheFile.empty())
+            {
+                TextureCompressor::WriteCache(cacheFile, ktx);
+            }
+
+            return true;
+        }
+
+        // Still usable uncompressed so just fall through
+        Logger::Warning("Failed to compress texture: " + a_job.Path.string());
+
+        a_result->Levels.clear();
+        a_result->Data.clear();
+    }
+
+    const uint64_t size = (uint64_t)width * height * 4;
+
+    a_result->InternalFormat = GL_RGBA8;
+    a_result->Format = GL_RGBA;
+    a_result->Type = GL_UNSIGNED_BYTE;
+    a_result->Compressed = false;
+    a_result->Levels.emplace_back(TextureLevel{ (uint32_t)width, (uint32_t)height, 0, size });
+
+    // Reserve for the full chain up front, mips add roughly a third
+    a_result->Data.reserve(size + size / 2);
+    a_result->Data.assign(pixels, pixels + size);
+
+    TextureCompressor::GenerateMips(&a_result->Levels, &a_result->Data);
+
+    return true;
+}
+bool TextureLoader::Decode(const TextureJob& a_job, TextureResult* a_result)
+{
+    const std::filesystem::path ext = a_job.Path.extension();
+
+    if (ext == ".png")
+    {
+        return DecodePNG(a_job, a_result);
+    }
+    else if (ext == ".ktx2")
+    {
+        return DecodeKTX(a_job.Data.data(), (uint64_t)a_job.Data.size(), a_result);
+    }
+
+    return false;
+}
+
+void TextureLoader::Run()
+{
+    while (true)
+    {
+        TextureJob job;
+
+        {
+            std::unique_lock l = std::unique_lock(m_jobLock);
+            m_jobSignal.wait(l, [this]() { return m_shutdown || !m_jobs.empty(); });
+
+            if (m_shutdown)
+            {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        TextureResult result;
+        result.Handle = job.Handle;
+        result.Ticket = job.Ticket;
+
+        if (!Decode(job, &result))
+        {
+            // Nothing to upload so the placeholder just stays
+            result.Levels.clear();
+            result.Data.clear();
+        }
+
+        const std::unique_lock l = std::unique_lock(m_resultLock);
+
+        m_results.emplace_back(std::move(result));
+    }
+}
+
+bool TextureLoader::Upload(const TextureResult& a_result)
+{
+    StagingBuffer& staging = m_stagingBuffers[m_stagingIndex];
+
+    // Ring has wrapped back onto a buffer the GPU may still be reading from
+    if (staging.Fence != nullptr)
+    {
+        const GLenum status = glClientWaitSync(staging.Fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            return false;
+        }
+
+        glDeleteSync(staging.Fence);
+        staging.Fence = nullptr;
+    }
+
+    const uint64_t size = (uint64_t)a_result.Data.size();
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, staging.Buffer);
+    IDEFER(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+    if (size > staging.Size)
+    {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size, nullptr, GL_STREAM_DRAW);
+        staging.Size = size;
+    }
+
+    void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (dst == nullptr)
+    {
+        // Treat as done otherwise it would just keep failing
+        return true;
+    }
+
+    memcpy(dst, a_result.Data.data(), (size_t)size);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    const uint32_t levelCount = (uint32_t)a_result.Levels.size();
+
+    glBindTexture(GL_TEXTURE_2D, a_result.Handle);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        const TextureLevel& level = a_result.Levels[i];
+        const void* offset = (const void*)(uintptr_t)level.Offset;
+
+        if (a_result.Compressed)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, a_result.InternalFormat, (GLsizei)level.Width, (GLsizei)level.Height, 0, (GLsizei)level.Size, offset);
+        }
+        else
+        {
+            glTexImage2D(GL_TEXTURE_2D, (GLint)i, (GLint)a_result.InternalFormat, (GLsizei)level.Width, (GLsizei)level.Height, 0, a_result.Format, a_result.Type, offset);
+        }
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)levelCount - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+
+    uint64_t residentSize = 0;
+    for (const TextureLevel& level : a_result.Levels)
+    {
+        residentSize += level.Size;
+    }
+    SetResidentSize(a_result.Handle, residentSize);
+
+    staging.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_stagingIndex = (m_stagingIndex + 1) % StagingBufferCount;
+
+    return true;
+}
+
+void TextureLoader::Load(GLuint a_handle, const std::filesystem::path& a_path, const uint8_t* a_data, uint32_t a_size, const std::filesystem::path& a_cachePath, e_TextureQuality a_quality)
+{
+    const uint64_t ticket = ++m_nextTicket;
+    m_pending[a_handle] = ticket;
+
+    // Copy the data as the asset library can be refreshed while the job is still queued
+    TextureJob job;
+    job.Handle = a_handle;
+    job.Ticket = ticket;
+    job.Quality = a_quality;
+    job.Path = a_path;
+    job.CachePath = a_cachePath;
+    job.Data.assign(a_data, a_data + a_size);
+
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_jobs.emplace_back(std::move(job));
+    }
+    m_jobSignal.notify_one();
+}
+void TextureLoader::Cancel(GLuint a_handle)
+{
+    m_pending.erase(a_handle);
+
+    SetResidentSize(a_handle, 0);
+}
+void TextureLoader::Clear()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_jobs.clear();
+    }
+
+    {
+        const std::unique_lock l = std::unique_lock(m_resultLock);
+
+        m_results.clear();
+    }
+
+    // Anything still in flight on a worker gets dropped by the ticket check
+    m_pending.clear();
+
+    m_residentSize.clear();
+    m_residentTotal = 0;
+}
+
+void TextureLoader::SetResidentSize(GLuint a_handle, uint64_t a_size)
+{
+    const auto iter = m_residentSize.find(a_handle);
+    if (iter != m_residentSize.end())
+    {
+        m_residentTotal -= iter->second;
+
+        if (a_size == 0)
+        {
+            m_residentSize.erase(iter);
+        }
+        else
+        {
+            iter->second = a_size;
+        }
+    }
+    else if (a_size != 0)
+    {
+        m_residentSize.emplace(a_handle, a_size);
+    }
+
+    m_residentTotal += a_size;
+}
+
+void TextureLoader::Update()
+{
+    EDITOR_PROFILE_SCOPE("TextureUpload");
+
+    const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    while (true)
+    {
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+        if (elapsed.count() >= UploadBudget)
+        {
+            break;
+        }
+
+        TextureResult result;
+        {
+            const std::unique_lock l = std::unique_lock(m_resultLock);
+            if (m_results.empty())
+            {
+                break;
+            }
+
+            result = std::move(m_results.front());
+            m_results.pop_front();
+        }
+
+        const auto iter = m_pending.find(result.Handle);
+        if (iter == m_pending.end() || iter->second != result.Ticket)
+        {
+            continue;
+        }
+
+        if (!result.Levels.empty() && !Upload(result))
+        {
+            // Staging ring is full so put it back and try again next frame
+            const std::unique_lock l = std::unique_lock(m_resultLock);
+
+            m_results.emplace_front(std::move(result));
+
+            break;
+        }
+
+        m_pending.erase(iter);
+    }
+
+    const std::chrono::duration<double, std::milli> uploadTime = std::chrono::high_resolution_clock::now() - start;
+
+    // Multiple loaders can be running so these get summed
+    EDITOR_PROFILE_COUNTER_ADD("Pending Textures", m_pending.size());
+    EDITOR_PROFILE_COUNTER_ADD("Texture Upload (ms)", uploadTime.count());
+    EDITOR_PROFILE_COUNTER_ADD("Texture Memory (MB)", (double)m_residentTotal / (1024.0 * 1024.0));
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
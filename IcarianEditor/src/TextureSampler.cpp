@@ -24,6 +24,25 @@ constexpr static GLenum GetGLFilterMode(e_TextureFilter a_filter)
 
     return GL_LINEAR;
 }
+constexpr static GLenum GetGLMinFilterMode(e_TextureFilter a_filter)
+{
+    // Textures without a mip chain have their max level clamped so these are still complete
+    switch (a_filter) 
+    {
+    case TextureFilter_Linear:
+    {
+        return GL_LINEAR_MIPMAP_LINEAR;
+    }
+    case TextureFilter_Nearest:
+    {
+        return GL_NEAREST_MIPMAP_NEAREST;
+    }
+    }
+
+    ICARIAN_ASSERT_MSG(0, "Invalid filter mode");
+
+    return GL_LINEAR_MIPMAP_LINEAR;
+}
 constexpr static GLenum GetGLWrapMode(e_TextureAddress a_address)
 {
     switch (a_address) 
@@ -65,7 +84,7 @@ TextureSampler* TextureSampler::CreateSampler(e_TextureFilter a_filter, e_Textur
     const GLenum filterMode = GetGLFilterMode(a_filter);
     const GLenum addressMode = GetGLWrapMode(a_addressMode);
     glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, filterMode);
-    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, filterMode);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GetGLMinFilterMode(a_filter));
     glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, addressMode);
     glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, addressMode);
     glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, addressMode);
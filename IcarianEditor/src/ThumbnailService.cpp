@@ -0,0 +1,693 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+#include "ThumbnailService.h"
+
+#include <algorithm>
+#include <assimp/Importer.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <ktx.h>
+#include <limits>
+#include <stb_image.h>
+
+#include "Application.h"
+#include "Core/IcarianDefer.h"
+#include "Hash.h"
+#include "IO.h"
+#include "KtxHelpers.h"
+
+static constexpr uint32_t ThumbnailMagic = 0x48544349; // ICTH
+static constexpr uint32_t ThumbnailVersion = 1;
+
+struct ThumbnailHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Size;
+};
+
+static bool ReadFile(const std::filesystem::path& a_path, std::vector<uint8_t>* a_data)
+{
+    std::ifstream file = std::ifstream(a_path, std::ios::binary | std::ios::ate);
+    if (!file.good())
+    {
+        return false;
+    }
+
+    const std::streamsize size = file.tellg();
+    if (size <= 0)
+    {
+        return false;
+    }
+
+    file.seekg(0);
+
+    a_data->resize((std::size_t)size);
+    file.read((char*)a_data->data(), size);
+
+    return file.good();
+}
+
+static bool ReadCache(const std::filesystem::path& a_path, std::vector<uint8_t>* a_pixels)
+{
+    constexpr uint32_t PixelSize = ThumbnailService::ThumbnailSize * ThumbnailService::ThumbnailSize * 4;
+
+    std::ifstream file = std::ifstream(a_path, std::ios::binary);
+    if (!file.good())
+    {
+        return false;
+    }
+
+    ThumbnailHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file.good() || header.Magic != ThumbnailMagic || header.Version != ThumbnailVersion || header.Size != ThumbnailService::ThumbnailSize)
+    {
+        return false;
+    }
+
+    a_pixels->resize(PixelSize);
+    file.read((char*)a_pixels->data(), PixelSize);
+
+    return file.good();
+}
+static void WriteCache(const std::filesystem::path& a_path, const std::vector<uint8_t>& a_pixels)
+{
+    const ThumbnailHeader header =
+    {
+        .Magic = ThumbnailMagic,
+        .Version = ThumbnailVersion,
+        .Size = ThumbnailService::ThumbnailSize
+    };
+
+    IO::WriteFileAtomic(a_path, { { &header, sizeof(header) }, { a_pixels.data(), (uint32_t)a_pixels.size() } });
+}
+
+// Box filters the image down to fit the thumbnail keeping the aspect ratio
+static void Downscale(uint32_t a_width, uint32_t a_height, const uint8_t* a_data, std::vector<uint8_t>* a_pixels)
+{
+    constexpr uint32_t Size = ThumbnailService::ThumbnailSize;
+
+    a_pixels->assign(Size * Size * 4, 0);
+
+    const float scale = std::min((float)Size / a_width, (float)Size / a_height);
+    const uint32_t width = std::max(1U, std::min(Size, (uint32_t)(a_width * scale)));
+    const uint32_t height = std::max(1U, std::min(Size, (uint32_t)(a_height * scale)));
+    const uint32_t xOffset = (Size - width) / 2;
+    const uint32_t yOffset = (Size - height) / 2;
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const uint32_t sYStart = y * a_height / height;
+        const uint32_t sYEnd = std::max(sYStart + 1, (y + 1) * a_height / height);
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const uint32_t sXStart = x * a_width / width;
+            const uint32_t sXEnd = std::max(sXStart + 1, (x + 1) * a_width / width);
+
+            uint32_t sum[4] = { 0 };
+            for (uint32_t sY = sYStart; sY < sYEnd; ++sY)
+            {
+                for (uint32_t sX = sXStart; sX < sXEnd; ++sX)
+                {
+                    const uint8_t* pixel = a_data + (sY * a_width + sX) * 4;
+
+                    sum[0] += pixel[0];
+                    sum[1] += pixel[1];
+                    sum[2] += pixel[2];
+                    sum[3] += pixel[3];
+                }
+            }
+
+            const uint32_t count = (sYEnd - sYStart) * (sXEnd - sXStart);
+            uint8_t* out = a_pixels->data() + ((y + yOffset) * Size + x + xOffset) * 4;
+            for (uint32_t i = 0; i < 4; ++i)
+            {
+                out[i] = (uint8_t)(sum[i] / count);
+            }
+        }
+    }
+}
+
+static bool GenerateTexture(const std::filesystem::path& a_path, const std::vector<uint8_t>& a_data, std::vector<uint8_t>* a_pixels)
+{
+    const std::filesystem::path ext = a_path.extension();
+
+    if (ext == ".png")
+    {
+        int width;
+        int height;
+        int channels;
+
+        stbi_uc* pixels = stbi_load_from_memory((const stbi_uc*)a_data.data(), (int)a_data.size(), &width, &height, &channels, STBI_rgb_alpha);
+        if (pixels == nullptr)
+        {
+            return false;
+        }
+        IDEFER(stbi_image_free(pixels));
+
+        Downscale((uint32_t)width, (uint32_t)height, pixels, a_pixels);
+
+        return true;
+    }
+    else if (ext == ".ktx2")
+    {
+        ktxTexture2* ktxTex;
+        if (ktxTexture2_CreateFromMemory((const ktx_uint8_t*)a_data.data(), (ktx_size_t)a_data.size(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &ktxTex) != KTX_SUCCESS)
+        {
+            return false;
+        }
+        IDEFER(ktxTexture_Destroy((ktxTexture*)ktxTex));
+
+        // Need plain pixels on the CPU so transcode to RGBA instead of the usual BC3
+        if (ktxTexture2_NeedsTranscoding(ktxTex))
+        {
+            if (ktxTexture2_TranscodeBasis(ktxTex, KTX_TTF_RGBA32, 0) != KTX_SUCCESS)
+            {
+                return false;
+            }
+        }
+
+        switch (ktxTex->vkFormat)
+        {
+        case KTX_VKFORMAT_R8G8B8A8_UNORM:
+        case KTX_VKFORMAT_R8G8B8A8_SRGB:
+        {
+            break;
+        }
+        default:
+        {
+            // Anything else is block compressed or an odd format and not worth decoding for a preview
+            return false;
+        }
+        }
+
+        ktx_size_t offset;
+        if (ktxTexture_GetImageOffset((ktxTexture*)ktxTex, 0, 0, 0, &offset) != KTX_SUCCESS)
+        {
+            return false;
+        }
+
+        Downscale(ktxTex->baseWidth, ktxTex->baseHeight, ktxTex->pData + offset, a_pixels);
+
+        return true;
+    }
+
+    return false;
+}
+
+// No GL context on the workers so models get drawn with a small software rasterizer
+static bool GenerateModel(const std::filesystem::path& a_path, const std::vector<uint8_t>& a_data, std::vector<uint8_t>* a_pixels)
+{
+    constexpr uint32_t Size = ThumbnailService::ThumbnailSize;
+
+    const std::string extStr = a_path.extension().string();
+
+    Assimp::Importer importer;
+    const aiScene* scene = importer.ReadFileFromMemory(a_data.data(), a_data.size(), aiProcess_Triangulate | aiProcess_PreTransformVertices, extStr.c_str() + 1);
+    if (scene == nullptr || scene->mNumMeshes == 0)
+    {
+        return false;
+    }
+
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(-std::numeric_limits<float>::max());
+    for (uint32_t i = 0; i < scene->mNumMeshes; ++i)
+    {
+        const aiMesh* mesh = scene->mMeshes[i];
+        for (uint32_t j = 0; j < mesh->mNumVertices; ++j)
+        {
+            const aiVector3D& v = mesh->mVertices[j];
+
+            min = glm::min(min, glm::vec3(v.x, v.y, v.z));
+            max = glm::max(max, glm::vec3(v.x, v.y, v.z));
+        }
+    }
+
+    const glm::vec3 center = (min + max) * 0.5f;
+    const float extent = glm::length(max - min) * 0.5f;
+    if (extent <= 0.0f)
+    {
+        return false;
+    }
+
+    // Fixed three quarter view
+    const float yaw = glm::radians(35.0f);
+    const float pitch = glm::radians(25.0f);
+    const glm::mat3 yawMat = glm::mat3(std::cos(yaw), 0.0f, -std::sin(yaw), 0.0f, 1.0f, 0.0f, std::sin(yaw), 0.0f, std::cos(yaw));
+    const glm::mat3 pitchMat = glm::mat3(1.0f, 0.0f, 0.0f, 0.0f, std::cos(pitch), std::sin(pitch), 0.0f, -std::sin(pitch), std::cos(pitch));
+    const glm::mat3 view = pitchMat * yawMat;
+    const glm::vec3 lightDir = glm::normalize(glm::vec3(0.4f, 0.6f, 1.0f));
+
+    a_pixels->assign(Size * Size * 4, 0);
+    std::vector<float> depth = std::vector<float>(Size * Size, std::numeric_limits<float>::max());
+
+    const auto toScreen = [&](const aiVector3D& a_vert) -> glm::vec3
+    {
+        const glm::vec3 p = view * ((glm::vec3(a_vert.x, a_vert.y, a_vert.z) - center) / extent);
+
+        // Flip y as the image is stored top down
+        return glm::vec3((p.x * 0.45f + 0.5f) * Size, (0.5f - p.y * 0.45f) * Size, -p.z);
+    };
+
+    for (uint32_t i = 0; i < scene->mNumMeshes; ++i)
+    {
+        const aiMesh* mesh = scene->mMeshes[i];
+        for (uint32_t j = 0; j < mesh->mNumFaces; ++j)
+        {
+            const aiFace& face = mesh->mFaces[j];
+            if (face.mNumIndices != 3)
+            {
+                continue;
+            }
+
+            const aiVector3D& a = mesh->mVertices[face.mIndices[0]];
+            const aiVector3D& b = mesh->mVertices[face.mIndices[1]];
+            const aiVector3D& c = mesh->mVertices[face.mIndices[2]];
+
+            const glm::vec3 vA = view * glm::vec3(a.x, a.y, a.z);
+            const glm::vec3 vB = view * glm::vec3(b.x, b.y, b.z);
+            const glm::vec3 vC = view * glm::vec3(c.x, c.y, c.z);
+            const glm::vec3 cross = glm::cross(vB - vA, vC - vA);
+            const float crossLen = glm::length(cross);
+            if (crossLen <= 0.0f)
+            {
+                continue;
+            }
+
+            // Winding is not reliable across formats so light both sides
+            const float light = std::abs(glm::dot(cross / crossLen, lightDir));
+            const float intensity = 0.25f + 0.75f * light;
+            const uint8_t r = (uint8_t)(200.0f * intensity);
+            const uint8_t g = (uint8_t)(200.0f * intensity);
+            const uint8_t bl = (uint8_t)(210.0f * intensity);
+
+            const glm::vec3 sA = toScreen(a);
+            const glm::vec3 sB = toScreen(b);
+            const glm::vec3 sC = toScreen(c);
+
+            const float area = (sB.x - sA.x) * (sC.y - sA.y) - (sB.y - sA.y) * (sC.x - sA.x);
+            if (std::abs(area) <= std::numeric_limits<float>::epsilon())
+            {
+                continue;
+            }
+
+            const int32_t minX = std::max(0, (int32_t)std::floor(std::min({ sA.x, sB.x, sC.x })));
+            const int32_t maxX = std::min((int32_t)Size - 1, (int32_t)std::ceil(std::max({ sA.x, sB.x, sC.x })));
+            const int32_t minY = std::max(0, (int32_t)std::floor(std::min({ sA.y, sB.y, sC.y })));
+            const int32_t maxY = std::min((int32_t)Size - 1, (int32_t)std::ceil(std::max({ sA.y, sB.y, sC.y })));
+
+            for (int32_t y = minY; y <= maxY; ++y)
+            {
+                for (int32_t x = minX; x <= maxX; ++x)
+                {
+                    const float pX = x + 0.5f;
+                    const float pY = y + 0.5f;
+
+                    const float w0 = ((sB.x - pX) * (sC.y - pY) - (sB.y - pY) * (sC.x - pX)) / area;
+                    const float w1 = ((sC.x - pX) * (sA.y - pY) - (sC.y - pY) * (sA.x - pX)) / area;
+                    const float w2 = 1.0f - w0 - w1;
+                    if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+                    {
+                        continue;
+                    }
+
+                    const float z = w0 * sA.z + w1 * sB.z + w2 * sC.z;
+                    float& d = depth[y * Size + x];
+                    if (z >= d)
+                    {
+                        continue;
+                    }
+
+                    d = z;
+
+                    uint8_t* out = a_pixels->data() + (y * Size + x) * 4;
+                    out[0] = r;
+                    out[1] = g;
+                    out[2] = bl;
+                    out[3] = 255;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+ThumbnailService::ThumbnailService()
+{
+    m_shutdown = false;
+
+    m_nextSlot = 0;
+    m_generation = 0;
+
+    const uint32_t workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1U, 4U);
+    for (uint32_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&ThumbnailService::Run, this);
+    }
+}
+ThumbnailService::~ThumbnailService()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_shutdown = true;
+        m_jobs.clear();
+    }
+    m_jobSignal.notify_all();
+
+    for (std::thread& thread : m_workers)
+    {
+        thread.join();
+    }
+
+    if (!m_atlases.empty())
+    {
+        glDeleteTextures((GLsizei)m_atlases.size(), m_atlases.data());
+    }
+}
+
+bool ThumbnailService::GenerateThumbnail(const ThumbnailJob& a_job, std::vector<uint8_t>* a_pixels)
+{
+    std::filesystem::path cacheFile;
+    if (!a_job.CachePath.empty())
+    {
+        std::error_code ec;
+        const uint64_t fileSize = (uint64_t)std::filesystem::file_size(a_job.Path, ec);
+        if (ec)
+        {
+            return false;
+        }
+        const int64_t writeTime = (int64_t)std::filesystem::last_write_time(a_job.Path, ec).time_since_epoch().count();
+        if (ec)
+        {
+            return false;
+        }
+
+        // Key off what the filesystem already knows so unchanged files never get read
+        const std::string pathStr = a_job.Path.string();
+
+        uint64_t hash = FNVHash(pathStr.data(), pathStr.size());
+        hash = FNVHash(&fileSize, sizeof(fileSize), hash);
+        hash = FNVHash(&writeTime, sizeof(writeTime), hash);
+
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.thumb", (unsigned long long)hash);
+
+        cacheFile = a_job.CachePath / "Thumbnails" / name;
+
+        if (ReadCache(cacheFile, a_pixels))
+        {
+            return true;
+        }
+    }
+
+    std::vector<uint8_t> data;
+    if (!ReadFile(a_job.Path, &data))
+    {
+        return false;
+    }
+
+    bool generated = false;
+    switch (a_job.Type)
+    {
+    case ThumbnailType_Texture:
+    {
+        generated = GenerateTexture(a_job.Path, data, a_pixels);
+
+        break;
+    }
+    case ThumbnailType_Model:
+    {
+        generated = GenerateModel(a_job.Path, data, a_pixels);
+
+        break;
+    }
+    }
+
+    if (generated && !cacheFile.empty())
+    {
+        WriteCache(cacheFile, *a_pixels);
+    }
+
+    return generated;
+}
+
+void ThumbnailService::Run()
+{
+    while (true)
+    {
+        ThumbnailJob job;
+
+        {
+            std::unique_lock l = std::unique_lock(m_jobLock);
+            m_jobSignal.wait(l, [this]() { return m_shutdown || !m_jobs.empty(); });
+
+            if (m_shutdown)
+            {
+                return;
+            }
+
+            job = m_jobs.front();
+            m_jobs.pop_front();
+        }
+
+        ThumbnailResult result;
+        result.Path = job.Path.native();
+        result.Generation = job.Generation;
+
+        // Empty pixels mark a failure
+        if (!GenerateThumbnail(job, &result.Pixels))
+        {
+            result.Pixels.clear();
+        }
+
+        {
+            const std::unique_lock l = std::unique_lock(m_resultLock);
+
+            m_results.emplace_back(std::move(result));
+        }
+
+        // Wake the main thread so the preview gets uploaded without waiting on the idle tick
+        Application::RequestRedraw();
+    }
+}
+
+void ThumbnailService::Update()
+{
+    std::vector<ThumbnailResult> results;
+    {
+        const std::unique_lock l = std::unique_lock(m_resultLock);
+        
+        if (m_results.empty())
+        {
+            return;
+        }
+
+        const uint32_t count = std::min((uint32_t)m_results.size(), MaxUploadsPerFrame);
+
+        results.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            results.emplace_back(std::move(m_results[i]));
+        }
+
+        m_results.erase(m_results.begin(), m_results.begin() + count);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    for (const ThumbnailResult& result : results)
+    {
+        // Came in from before a clear so the entry no longer exists
+        if (result.Generation != m_generation)
+        {
+            continue;
+        }
+
+        const auto iter = m_entries.find(result.Path);
+        if (iter == m_entries.end())
+        {
+            continue;
+        }
+
+        ThumbnailEntry& entry = iter->second;
+        entry.Queued = false;
+
+        if (result.Pixels.empty())
+        {
+            ReleaseSlot(&entry);
+
+            continue;
+        }
+
+        // Regenerated previews go back into the slot they already had
+        if (entry.Slot == -1)
+        {
+            entry.Slot = AllocateSlot();
+            entry.LRU = m_lru.emplace(m_lru.end(), result.Path);
+        }
+
+        const uint32_t slot = entry.Slot;
+        const uint32_t atlasIndex = slot / AtlasSlots;
+        const uint32_t cell = slot % AtlasSlots;
+
+        if (atlasIndex >= m_atlases.size())
+        {
+            GLuint atlas;
+            glGenTextures(1, &atlas);
+            glBindTexture(GL_TEXTURE_2D, atlas);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei)AtlasSize, (GLsizei)AtlasSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+            m_atlases.emplace_back(atlas);
+        }
+
+        glBindTexture(GL_TEXTURE_2D, m_atlases[atlasIndex]);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint)((cell % AtlasCells) * ThumbnailSize), (GLint)((cell / AtlasCells) * ThumbnailSize), (GLsizei)ThumbnailSize, (GLsizei)ThumbnailSize, GL_RGBA, GL_UNSIGNED_BYTE, result.Pixels.data());
+    }
+
+    // Need to draw for new previews to show and keeps ticking at frame rate while there is a backlog
+    Application::RequestRedraw();
+}
+void ThumbnailService::Clear()
+{
+    {
+        const std::unique_lock l = std::unique_lock(m_jobLock);
+
+        m_jobs.clear();
+    }
+
+    // Atlas textures are kept and just get written over
+    m_entries.clear();
+    m_lru.clear();
+    m_freeSlots.clear();
+    m_nextSlot = 0;
+    ++m_generation;
+}
+
+uint32_t ThumbnailService::AllocateSlot()
+{
+    if (!m_freeSlots.empty())
+    {
+        const uint32_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+
+        return slot;
+    }
+
+    if (m_nextSlot < MaxSlots)
+    {
+        return m_nextSlot++;
+    }
+
+    // Out of atlas space so take the slot of whatever has gone the longest without being drawn
+    // Entry gets dropped so it is requested again if it comes back into view
+    const auto iter = m_entries.find(m_lru.front());
+    m_lru.pop_front();
+
+    const uint32_t slot = iter->second.Slot;
+    m_entries.erase(iter);
+
+    return slot;
+}
+void ThumbnailService::ReleaseSlot(ThumbnailEntry* a_entry)
+{
+    if (a_entry->Slot == -1)
+    {
+        return;
+    }
+
+    m_freeSlots.emplace_back(a_entry->Slot);
+    m_lru.erase(a_entry->LRU);
+
+    a_entry->Slot = -1;
+}
+
+void ThumbnailService::Invalidate(const std::filesystem::path& a_path)
+{
+    const auto iter = m_entries.find(a_path.native());
+    if (iter != m_entries.end())
+    {
+        iter->second.Stale = true;
+    }
+}
+void ThumbnailService::InvalidateAll()
+{
+    for (auto& iter : m_entries)
+    {
+        iter.second.Stale = true;
+    }
+}
+
+bool ThumbnailService::GetThumbnail(const std::filesystem::path& a_path, const std::filesystem::path& a_cachePath, e_ThumbnailType a_type, GLuint* a_texture, glm::vec2* a_uv0, glm::vec2* a_uv1)
+{
+    auto iter = m_entries.find(a_path.native());
+    if (iter == m_entries.end())
+    {
+        iter = m_entries.emplace(a_path.native(), ThumbnailEntry{ (uint32_t)-1, m_lru.end(), false, true }).first;
+    }
+
+    ThumbnailEntry& entry = iter->second;
+
+    // Only one job in flight per path, a stale entry gets picked up again once it comes back
+    if (entry.Stale && !entry.Queued)
+    {
+        entry.Stale = false;
+        entry.Queued = true;
+
+        {
+            const std::unique_lock l = std::unique_lock(m_jobLock);
+
+            m_jobs.emplace_back(ThumbnailJob{ a_path, a_cachePath, a_type, m_generation });
+        }
+        m_jobSignal.notify_one();
+    }
+
+    if (entry.Slot == -1)
+    {
+        return false;
+    }
+
+    m_lru.splice(m_lru.end(), m_lru, entry.LRU);
+
+    const uint32_t cell = entry.Slot % AtlasSlots;
+    const glm::vec2 pos = glm::vec2((float)(cell % AtlasCells), (float)(cell / AtlasCells)) * (float)ThumbnailSize;
+
+    *a_texture = m_atlases[entry.Slot / AtlasSlots];
+    *a_uv0 = pos / (float)AtlasSize;
+    *a_uv1 = (pos + (float)ThumbnailSize) / (float)AtlasSize;
+
+    return true;
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
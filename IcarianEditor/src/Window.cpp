@@ -13,6 +13,7 @@
 
 #include "Core/IcarianDefer.h"
 #include "Datastore.h"
+#include "EditorProfiler.h"
 #include "FlareImGui.h"
 #include "Texture.h"
 
@@ -83,6 +84,8 @@ bool Window::Display(double a_delta)
                 }                
             }
             
+            EDITOR_PROFILE_SCOPE(m_displayName.c_str());
+
             Update(a_delta);
         }
 
@@ -23,6 +23,7 @@
 
 #include "AppMain.h"
 #include "Core/IcarianDefer.h"
+#include "IO.h"
 #include "Logger.h"
 
 #define ICARIANEDITOR_VERSION_STRX(x) #x
@@ -37,6 +38,9 @@ void PrintVersion()
 
 int main(int a_argc, char* a_argv[])
 {
+    Logger::Init((IO::GetEditorDataPath() / "IcarianEditor.log").string());
+    IDEFER(Logger::Destroy());
+
     PrintVersion();
 
 #ifdef WIN32
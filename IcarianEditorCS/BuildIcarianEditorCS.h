@@ -23,14 +23,19 @@ static CUBE_CSProject BuildIcarianEditorCSProject(CBBOOL a_optimise)
         "src/AnimationMaster.cs",
         "src/ClipBoard.cs",
         "src/ColliderRenderer.cs",
+        "src/DefFieldAccessor.cs",
         "src/EditorConfig.cs",
         "src/EditorDefLibrary.cs",
         "src/EditorScene.cs",
         "src/FileHandler.cs",
         "src/Gizmos.cs",
         "src/GUI.cs",
+        "src/GUICommandBuffer.cs",
+        "src/ParsedCache.cs",
         "src/Program.cs",
+        "src/ReferenceComparer.cs",
         "src/Workspace.cs",
+        "src/XmlStream.cs",
 
         "src/Editor/EditorDisplay.cs",
         "src/Editor/MeshRendererEditorDisplay.cs",
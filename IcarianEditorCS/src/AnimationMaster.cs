@@ -24,6 +24,8 @@ namespace IcarianEditor
         extern static void BindSkeletonBuffer(uint a_addr);
         [MethodImpl(MethodImplOptions.InternalCall)]
         extern static void DrawBones(uint a_addr, float[] a_transform);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        extern static void RequestRedraw();
         
         struct SkeletonData
         {
@@ -151,6 +153,9 @@ namespace IcarianEditor
                 propertyInfo.SetValue(anim, a_def);
 
                 anim.Update(s_deltaTime);
+
+                // Editor only draws on request so animated previews need to keep asking
+                RequestRedraw();
             }
 
             s_updatedSkeletons.Add(skeleton);
@@ -0,0 +1,191 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+using IcarianEngine.Definitions;
+using System;
+using System.Collections.Generic;
+using System.Linq.Expressions;
+using System.Reflection;
+
+namespace IcarianEditor
+{
+    internal class FieldAccessor
+    {
+        public FieldInfo              Field;
+        public string                 Name;
+        public Type                   FieldType;
+        public bool                   IsDef;
+
+        public Func<object, object>   Get;
+        public Action<object, object> Set;
+    }
+
+    // Compiled once per type so walking def fields does not go through FieldInfo every time
+    internal class TypeAccessor
+    {
+        public Type                              Type;
+        public Func<object>                      Create;
+
+        // Everything public on the instance, what FindDefs walks
+        public FieldAccessor[]                   Fields;
+        // Fields that end up in def data, skips constants and NonSerialized fields
+        public FieldAccessor[]                   DataFields;
+
+        Dictionary<string, FieldAccessor>        m_lookup;
+
+        static Dictionary<Type, TypeAccessor>    s_accessors = new Dictionary<Type, TypeAccessor>();
+
+        static Func<object, object> CompileGetter(FieldInfo a_field)
+        {
+            ParameterExpression obj = Expression.Parameter(typeof(object), "obj");
+
+            Expression instance = Expression.Convert(obj, a_field.DeclaringType);
+            Expression field = Expression.Field(instance, a_field);
+
+            return Expression.Lambda<Func<object, object>>(Expression.Convert(field, typeof(object)), obj).Compile();
+        }
+        static Action<object, object> CompileSetter(FieldInfo a_field)
+        {
+            // Structs get unboxed into a copy and readonly fields cannot be assigned so leave those to reflection
+            if (a_field.DeclaringType.IsValueType || a_field.IsInitOnly)
+            {
+                return a_field.SetValue;
+            }
+
+            ParameterExpression obj = Expression.Parameter(typeof(object), "obj");
+            ParameterExpression value = Expression.Parameter(typeof(object), "value");
+
+            Expression instance = Expression.Convert(obj, a_field.DeclaringType);
+            Expression field = Expression.Field(instance, a_field);
+            Expression assign = Expression.Assign(field, Expression.Convert(value, a_field.FieldType));
+
+            return Expression.Lambda<Action<object, object>>(assign, obj, value).Compile();
+        }
+        static Func<object> CompileCreate(Type a_type)
+        {
+            if (a_type.IsAbstract || a_type.IsInterface)
+            {
+                return null;
+            }
+
+            if (!a_type.IsValueType && a_type.GetConstructor(Type.EmptyTypes) == null)
+            {
+                return null;
+            }
+
+            return Expression.Lambda<Func<object>>(Expression.Convert(Expression.New(a_type), typeof(object))).Compile();
+        }
+
+        TypeAccessor(Type a_type)
+        {
+            Type = a_type;
+            Create = CompileCreate(a_type);
+
+            FieldInfo[] fields = a_type.GetFields(BindingFlags.Instance | BindingFlags.Public);
+
+            List<FieldAccessor> dataFields = new List<FieldAccessor>();
+
+            Fields = new FieldAccessor[fields.Length];
+            m_lookup = new Dictionary<string, FieldAccessor>();
+
+            for (int i = 0; i < fields.Length; ++i)
+            {
+                FieldInfo field = fields[i];
+                Type fieldType = field.FieldType;
+
+                FieldAccessor accessor = new FieldAccessor()
+                {
+                    Field = field,
+                    Name = field.Name,
+                    FieldType = fieldType,
+                    IsDef = fieldType == typeof(Def) || fieldType.IsSubclassOf(typeof(Def)),
+                    Get = CompileGetter(field),
+                    Set = CompileSetter(field)
+                };
+
+                Fields[i] = accessor;
+                // Hidden fields from a derived type come first so keep those
+                if (!m_lookup.ContainsKey(field.Name))
+                {
+                    m_lookup.Add(field.Name, accessor);
+                }
+
+                if (field.IsStatic || field.IsLiteral)
+                {
+                    continue;
+                }
+
+                if (field.GetCustomAttribute<NonSerializedAttribute>() != null)
+                {
+                    continue;
+                }
+
+                dataFields.Add(accessor);
+            }
+
+            DataFields = dataFields.ToArray();
+        }
+
+        public static TypeAccessor GetAccessor(Type a_type)
+        {
+            TypeAccessor accessor;
+            if (!s_accessors.TryGetValue(a_type, out accessor))
+            {
+                accessor = new TypeAccessor(a_type);
+                s_accessors.Add(a_type, accessor);
+            }
+
+            return accessor;
+        }
+
+        public FieldAccessor GetField(string a_name)
+        {
+            FieldAccessor accessor;
+            if (m_lookup.TryGetValue(a_name, out accessor))
+            {
+                return accessor;
+            }
+
+            return null;
+        }
+
+        public object CreateInstance()
+        {
+            if (Create != null)
+            {
+                return Create();
+            }
+
+            return Activator.CreateInstance(Type);
+        }
+
+        // Types come and go with script reloads
+        public static void Clear()
+        {
+            s_accessors.Clear();
+        }
+    }
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -24,7 +24,7 @@ namespace IcarianEditor.Editor
                 return false;
             }
 
-            CollisionShapeDef shapeDef = EditorDefLibrary.GenerateDef(def.CollisionShape.DefName) as CollisionShapeDef;
+            CollisionShapeDef shapeDef = EditorDefLibrary.GetDef(def.CollisionShape.DefName) as CollisionShapeDef;
             if (shapeDef == null)
             {
                 return false;
@@ -21,7 +21,7 @@ namespace IcarianEditor.Editor
             }
 
             // Engine need full def to work properly cannot do partial generation
-            SkeletonAnimatorDef skeletonAnimatorDef = EditorDefLibrary.GenerateDef<SkeletonAnimatorDef>(def.DefName, true);
+            SkeletonAnimatorDef skeletonAnimatorDef = EditorDefLibrary.GetDef<SkeletonAnimatorDef>(def.DefName, true);
             if (skeletonAnimatorDef == null)
             {
                 return false;
@@ -33,7 +33,7 @@ namespace IcarianEditor.Editor
                 return false;
             }
 
-            MaterialDef matDef = EditorDefLibrary.GenerateDef<MaterialDef>(def.MaterialDef.DefName);
+            MaterialDef matDef = EditorDefLibrary.GetDef<MaterialDef>(def.MaterialDef.DefName);
             if (matDef == null)
             {
                 return false;
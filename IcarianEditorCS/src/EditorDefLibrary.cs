@@ -37,6 +37,17 @@ namespace IcarianEditor
 
         static Dictionary<string, int> s_sceneDefLookup = new Dictionary<string, int>();
 
+        // Defs edited since the last save, scene defs get saved with their scene so those mark the scene instead
+        static HashSet<string>         s_dirtyDefs = new HashSet<string>();
+
+        // Shared instances handed out by GetDef, they get dropped whenever the data they were built from changes
+        // Recursive defs pull in other defs so those just get thrown out on any change
+        static Dictionary<string, Def> s_defCache = new Dictionary<string, Def>();
+        static Dictionary<string, Def> s_recursiveDefCache = new Dictionary<string, Def>();
+
+        // Bumped whenever def data changes so views can tell when what they built from defs is stale
+        static uint                    s_version = 0;
+
         static DefDataLoader           s_defDataLoader = null;
         static DefGenerator            s_createDef = null;
 
@@ -61,58 +72,96 @@ namespace IcarianEditor
             s_defs.Clear();
             s_defPathLookup.Clear();
             s_defNameLookup.Clear();
+            s_dirtyDefs.Clear();
+
+            ClearDefCache();
+            TypeAccessor.Clear();
 
             DefLibrary.Clear();
         }
 
-        static void Load(byte[][] a_data, string[] a_paths)
+        static bool ReadDefXml(byte[] a_data, string a_path, XmlDocument a_doc, out DefData a_def)
+        {
+            a_def = default(DefData);
+
+            using (XmlReader reader = XmlStream.CreateReader(a_data))
+            {
+                if (reader.MoveToContent() != XmlNodeType.Element)
+                {
+                    return false;
+                }
+
+                if (a_doc.ReadNode(reader) is XmlElement root)
+                {
+                    a_def = s_defDataLoader(a_path, root);
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Cache entries are only handed over when they match the file, anything missing or stale goes through the xml and gets cached for next time
+        static void Load(byte[][] a_data, string[] a_paths, byte[][] a_cache)
         {
             uint defCount = (uint)a_data.Length;
 
             s_defs.Clear();
+            s_dirtyDefs.Clear();
+
+            ClearDefCache();
 
             int index = 0;
 
+            // The def loader wants an element so only the root gets built, shared document just owns the nodes
+            XmlDocument doc = new XmlDocument();
+
             for (uint i = 0; i < defCount; ++i)
             {
                 string path = a_paths[i];
+                byte[] cache = a_cache[i];
 
-                MemoryStream stream = new MemoryStream(a_data[i]);
+                DefData data;
+                if (cache == null || !ParsedCache.ReadDef(cache, out data))
+                {
+                    if (!ReadDefXml(a_data[i], path, doc, out data))
+                    {
+                        continue;
+                    }
 
-                XmlDocument doc = new XmlDocument();
-                doc.Load(stream);
+                    EditorDefLibraryInterop.WriteDefCache(path, ParsedCache.WriteDef(data));
+                }
 
-                if (doc.DocumentElement is XmlElement root)
+                if (!string.IsNullOrWhiteSpace(data.Name))
                 {
-                    DefData data = s_defDataLoader(path, root);
-
-                    if (!string.IsNullOrWhiteSpace(data.Name))
-                    {
-                        s_defs.Add(data);
+                    s_defs.Add(data);
 
-                        s_defPathLookup.Add(path, index);
-                        s_defNameLookup.Add(data.Name, index);
+                    s_defPathLookup.Add(path, index);
+                    s_defNameLookup.Add(data.Name, index);
 
-                        ++index;
-                    }
+                    ++index;
                 }
             }
         }
 
-        internal static IEnumerable<string> LoadSceneDefs(XmlElement a_defs)
+        // Reader needs to be sitting on the Defs element and is left after it
+        internal static IEnumerable<string> LoadSceneDefs(XmlReader a_reader, XmlDocument a_doc)
         {
-            if (a_defs == null)
-            {
-                return null;
-            }
-
             List<string> sceneDefNames = new List<string>();
 
+            ClearDefCache();
+
             int index = s_defs.Count;
 
-            foreach (XmlNode node in a_defs.ChildNodes)
+            if (!XmlStream.EnterElement(a_reader))
+            {
+                return sceneDefNames;
+            }
+
+            while (XmlStream.NextElement(a_reader))
             {
-                if (node is XmlElement element)
+                if (a_doc.ReadNode(a_reader) is XmlElement element)
                 {
                     DefData dat = s_defDataLoader(Def.SceneDefPath, element);
 
@@ -127,6 +176,41 @@ namespace IcarianEditor
 
             return sceneDefNames;
         }
+        // Same as above for scene defs that came out of the parsed cache
+        internal static IEnumerable<string> LoadSceneDefs(IEnumerable<DefData> a_defs)
+        {
+            List<string> sceneDefNames = new List<string>();
+
+            ClearDefCache();
+
+            int index = s_defs.Count;
+
+            foreach (DefData dat in a_defs)
+            {
+                if (!string.IsNullOrWhiteSpace(dat.Name))
+                {
+                    s_defs.Add(dat);
+                    s_sceneDefLookup.Add(dat.Name, index++);
+                    sceneDefNames.Add(dat.Name);
+                }
+            }
+
+            return sceneDefNames;
+        }
+        internal static bool GetSceneDefData(string a_name, out DefData a_data)
+        {
+            int index;
+            if (s_sceneDefLookup.TryGetValue(a_name, out index))
+            {
+                a_data = s_defs[index];
+
+                return true;
+            }
+
+            a_data = default(DefData);
+
+            return false;
+        }
 
         static void WriteDataObject(XmlDocument a_doc, XmlElement a_parent, DefDataObject a_object)
         {
@@ -188,36 +272,109 @@ namespace IcarianEditor
             return null;
         }
 
+        static void WriteDataObject(XmlWriter a_writer, DefDataObject a_object)
+        {
+            a_writer.WriteStartElement(a_object.Name);
+
+            if (a_object.Children != null && a_object.Children.Count > 0)
+            {
+                foreach (DefDataObject child in a_object.Children)
+                {
+                    WriteDataObject(a_writer, child);
+                }
+            }
+            else
+            {
+                a_writer.WriteString(a_object.Text);
+            }
+
+            // Always the long form to match what setting InnerText on an element wrote
+            a_writer.WriteFullEndElement();
+        }
+
+        internal static void WriteDef(XmlWriter a_writer, DefData a_data)
+        {
+            a_writer.WriteStartElement(a_data.Type);
+
+            a_writer.WriteAttributeString("Name", a_data.Name);
+            if (a_data.Abstract)
+            {
+                a_writer.WriteAttributeString("Abstract", "true");
+            }
+            if (!string.IsNullOrWhiteSpace(a_data.Parent))
+            {
+                a_writer.WriteAttributeString("Parent", a_data.Parent);
+            }
+
+            bool empty = true;
+            foreach (DefDataObject dataObject in a_data.DefDataObjects)
+            {
+                WriteDataObject(a_writer, dataObject);
+
+                empty = false;
+            }
+
+            if (empty)
+            {
+                a_writer.WriteEndElement();
+            }
+            else
+            {
+                a_writer.WriteFullEndElement();
+            }
+        }
+        internal static bool WriteDef(XmlWriter a_writer, string a_defName, bool a_sceneDef = false)
+        {
+            int index;
+            if (a_sceneDef)
+            {
+                if (s_sceneDefLookup.TryGetValue(a_defName, out index))
+                {
+                    WriteDef(a_writer, s_defs[index]);
+
+                    return true;
+                }
+            }
+            else
+            {
+                if (s_defNameLookup.TryGetValue(a_defName, out index))
+                {
+                    WriteDef(a_writer, s_defs[index]);
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Only what has been edited gets written, the native side then skips anything that comes out the same as the file
         static void SerializeDefs()
         {
-            foreach (DefData defData in s_defs)
+            foreach (string defName in s_dirtyDefs)
             {
-                if (string.IsNullOrWhiteSpace(defData.Name) || defData.Path == Def.SceneDefPath)
+                int index;
+                if (!s_defNameLookup.TryGetValue(defName, out index))
                 {
                     continue;
                 }
 
-                XmlDocument doc = new XmlDocument();
-                doc.AppendChild(doc.CreateXmlDeclaration("1.0", "UTF-8", null));
-
-                XmlElement root = CreateDef(doc, defData);
-                doc.AppendChild(root);
+                DefData defData = s_defs[index];
+                if (string.IsNullOrWhiteSpace(defData.Name) || defData.Path == Def.SceneDefPath)
+                {
+                    continue;
+                }
 
                 MemoryStream stream = new MemoryStream();
-                XmlTextWriter writer = new XmlTextWriter(stream, Encoding.UTF8);
-                writer.Formatting = Formatting.Indented;
+                XmlTextWriter writer = XmlStream.CreateWriter(stream);
 
-                doc.WriteContentTo(writer);
+                WriteDef(writer, defData);
                 writer.Flush();
-                stream.Flush();
-
-                stream.Position = 0;
-
-                StreamReader reader = new StreamReader(stream);
-                byte[] data = Encoding.UTF8.GetBytes(reader.ReadToEnd());
 
-                EditorDefLibraryInterop.WriteDef(defData.Path, data);
+                EditorDefLibraryInterop.WriteDef(defData.Path, stream.ToArray());
             }
+
+            s_dirtyDefs.Clear();
         }
 
         public static bool IsAbstract(string a_name)
@@ -261,6 +418,58 @@ namespace IcarianEditor
             return string.Empty;
         }
 
+        internal static uint Version
+        {
+            get
+            {
+                return s_version;
+            }
+        }
+
+        static void ClearDefCache()
+        {
+            s_defCache.Clear();
+            s_recursiveDefCache.Clear();
+
+            ++s_version;
+        }
+        // Children inherit data from their parent so they need to go as well
+        static void InvalidateDef(string a_name)
+        {
+            s_recursiveDefCache.Clear();
+
+            ++s_version;
+
+            if (string.IsNullOrEmpty(a_name) || s_defCache.Count <= 0)
+            {
+                return;
+            }
+
+            Queue<string> queue = new Queue<string>();
+            queue.Enqueue(a_name);
+
+            HashSet<string> visited = new HashSet<string>();
+
+            while (queue.Count > 0)
+            {
+                string name = queue.Dequeue();
+                if (!visited.Add(name))
+                {
+                    continue;
+                }
+
+                s_defCache.Remove(name);
+
+                foreach (DefData data in s_defs)
+                {
+                    if (data.Parent == name && !string.IsNullOrEmpty(data.Name))
+                    {
+                        queue.Enqueue(data.Name);
+                    }
+                }
+            }
+        }
+
         static void FindDefs(object a_object)
         {
             if (a_object == null)
@@ -270,19 +479,16 @@ namespace IcarianEditor
 
             // NOTE: Only going one field deep may change this in the future
 
-            Type type = a_object.GetType();
-            FieldInfo[] fields = type.GetFields(BindingFlags.Instance | BindingFlags.Public);
+            TypeAccessor accessor = TypeAccessor.GetAccessor(a_object.GetType());
 
-            foreach (FieldInfo f in fields)
+            foreach (FieldAccessor f in accessor.Fields)
             {
-                Type fieldType = f.FieldType;
-
-                if (fieldType == typeof(Def) || fieldType.IsSubclassOf(typeof(Def)))
+                if (f.IsDef)
                 {
-                    Def def = f.GetValue(a_object) as Def;
+                    Def def = f.Get(a_object) as Def;
                     if (def != null)
                     {
-                        f.SetValue(a_object, GenerateDef(def.DefName, true));
+                        f.Set(a_object, GenerateDef(def.DefName, true));
                     }
                 }
             }
@@ -343,6 +549,51 @@ namespace IcarianEditor
             return GenerateDef(a_name, a_recursive) as T;
         }
 
+        // Returns a shared instance that must not be modified, use GenerateDef for a copy that can be edited
+        // Meant for anything that reads defs every frame
+        public static Def GetDef(string a_name, bool a_recursive = false)
+        {
+            if (string.IsNullOrEmpty(a_name))
+            {
+                return null;
+            }
+
+            Dictionary<string, Def> cache = a_recursive ? s_recursiveDefCache : s_defCache;
+
+            Def def;
+            if (cache.TryGetValue(a_name, out def))
+            {
+                return def;
+            }
+
+            def = GenerateDef(a_name, a_recursive);
+            if (def != null)
+            {
+                cache.Add(a_name, def);
+            }
+
+            return def;
+        }
+        public static T GetDef<T>(string a_name, bool a_recursive = false) where T : Def
+        {
+            return GetDef(a_name, a_recursive) as T;
+        }
+
+        public static Def GetPathDef(string a_path)
+        {
+            int index;
+            if (s_defPathLookup.TryGetValue(a_path, out index))
+            {
+                return GetDef(s_defs[index].Name);
+            }
+
+            return null;
+        }
+        public static T GetPathDef<T>(string a_path) where T : Def
+        {
+            return GetPathDef(a_path) as T;
+        }
+
         public static Def GeneratePathDef(string a_path)
         {
             int index;
@@ -399,19 +650,17 @@ namespace IcarianEditor
             {
                 Type gType = a_type.GetGenericArguments()[0];
 
-                PropertyInfo countProp = a_type.GetProperty("Count");
+                IList list = a_value as IList;
 
-                int count = (int)countProp.GetValue(a_value);
+                int count = list.Count;
                 int pCount = 0;
                 if (a_default != null)
                 {
-                    pCount = (int)countProp.GetValue(a_default);
+                    pCount = (a_default as IList).Count;
                 }
 
                 if (count > pCount)
                 {
-                    IList list = a_value as IList;
-
                     for (int i = pCount; i < count; ++i)
                     {
                         DefDataObject child = new DefDataObject();
@@ -461,8 +710,8 @@ namespace IcarianEditor
                 return;
             }
 
-            FieldInfo[] fields = a_type.GetFields(BindingFlags.Instance | BindingFlags.Public);
-            if (fields.Length == 0)
+            TypeAccessor accessor = TypeAccessor.GetAccessor(a_type);
+            if (accessor.Fields.Length == 0)
             {
                 a_dataObject.Text = a_value.ToString();
             }
@@ -470,23 +719,13 @@ namespace IcarianEditor
             {
                 if (a_value != null)
                 {
-                    foreach (FieldInfo field in fields)
+                    foreach (FieldAccessor field in accessor.DataFields)
                     {
-                        if (field.IsStatic || field.IsLiteral)
-                        {
-                            continue;
-                        }
-
-                        if (field.GetCustomAttribute<NonSerializedAttribute>() != null)
-                        {
-                            continue;
-                        }
-
-                        object value = field.GetValue(a_value);
+                        object value = field.Get(a_value);
                         object defaultValue = null;
                         if (a_default != null)
                         {
-                            defaultValue = field.GetValue(a_default);
+                            defaultValue = field.Get(a_default);
                         }
 
                         DefDataObject dataObject = new DefDataObject();
@@ -508,10 +747,17 @@ namespace IcarianEditor
         {
             Type defType = a_def.GetType();
 
-            object baseDef = Activator.CreateInstance(defType);
+            TypeAccessor accessor = TypeAccessor.GetAccessor(defType);
+
+            object baseDef = null;
+            // Only read from so the shared instance will do
             if (!string.IsNullOrWhiteSpace(a_def.DefParentName))
             {
-                baseDef = GenerateDef(a_def.DefParentName);
+                baseDef = GetDef(a_def.DefParentName);
+            }
+            if (baseDef == null)
+            {
+                baseDef = accessor.CreateInstance();
             }
 
             string typeName = defType.ToString();
@@ -530,26 +776,16 @@ namespace IcarianEditor
             };
             data.DefDataObjects = new List<DefDataObject>();
 
-            Type baseType = baseDef.GetType();
+            TypeAccessor baseAccessor = TypeAccessor.GetAccessor(baseDef.GetType());
 
-            FieldInfo[] fields = defType.GetFields(BindingFlags.Instance | BindingFlags.Public);
-            foreach (FieldInfo field in fields)
+            foreach (FieldAccessor field in accessor.DataFields)
             {
-                if (field.IsStatic || field.IsLiteral)
-                {
-                    continue;
-                }
-
-                if (field.GetCustomAttribute<NonSerializedAttribute>() != null)
-                {
-                    continue;
-                }
-
-                object value = field.GetValue(a_def);
+                object value = field.Get(a_def);
                 object defaultValue = null;
-                if (baseType.GetField(field.Name) != null)
+                FieldAccessor baseField = baseAccessor.GetField(field.Name);
+                if (baseField != null)
                 {
-                    defaultValue = field.GetValue(baseDef);
+                    defaultValue = baseField.Get(baseDef);
                 }
 
                 DefDataObject dataObject = new DefDataObject();
@@ -586,6 +822,9 @@ namespace IcarianEditor
                     s_defs[i] = data;
                     s_defPathLookup.Add(data.Path, i);
                     s_defNameLookup.Add(data.Name, i);
+                    s_dirtyDefs.Add(data.Name);
+
+                    InvalidateDef(data.Name);
 
                     return true;
                 }
@@ -594,6 +833,9 @@ namespace IcarianEditor
             s_defs.Add(data);
             s_defPathLookup.Add(data.Path, count);
             s_defNameLookup.Add(data.Name, count);
+            s_dirtyDefs.Add(data.Name);
+
+            InvalidateDef(data.Name);
 
             return true;
         }
@@ -617,6 +859,8 @@ namespace IcarianEditor
                     s_defs[i] = data;
                     s_sceneDefLookup.Add(data.Name, i);
 
+                    InvalidateDef(data.Name);
+
                     return true;
                 }
             }
@@ -624,6 +868,8 @@ namespace IcarianEditor
             s_defs.Add(data);
             s_sceneDefLookup.Add(data.Name, count);
 
+            InvalidateDef(data.Name);
+
             return true;
         }
         internal static bool RemoveSceneDef(string a_defName)
@@ -634,12 +880,75 @@ namespace IcarianEditor
                 s_defs[index] = new DefData();
                 s_sceneDefLookup.Remove(a_defName);
 
+                InvalidateDef(a_defName);
+
                 return true;
             }
 
             return false;
         }
 
+        // Compares what would end up in the xml so null and empty are the same thing
+        static bool DataObjectsEquals(List<DefDataObject> a_lhs, List<DefDataObject> a_rhs)
+        {
+            int lhsCount = a_lhs != null ? a_lhs.Count : 0;
+            int rhsCount = a_rhs != null ? a_rhs.Count : 0;
+            if (lhsCount != rhsCount)
+            {
+                return false;
+            }
+
+            for (int i = 0; i < lhsCount; ++i)
+            {
+                DefDataObject lhs = a_lhs[i];
+                DefDataObject rhs = a_rhs[i];
+
+                if (lhs.Name != rhs.Name)
+                {
+                    return false;
+                }
+
+                bool lhsChildren = lhs.Children != null && lhs.Children.Count > 0;
+                bool rhsChildren = rhs.Children != null && rhs.Children.Count > 0;
+                if (lhsChildren != rhsChildren)
+                {
+                    return false;
+                }
+
+                if (lhsChildren)
+                {
+                    if (!DataObjectsEquals(lhs.Children, rhs.Children))
+                    {
+                        return false;
+                    }
+                }
+                else if ((lhs.Text ?? string.Empty) != (rhs.Text ?? string.Empty))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+        static bool DefDataEquals(DefData a_lhs, DefData a_rhs)
+        {
+            if (a_lhs.Type != a_rhs.Type || a_lhs.Name != a_rhs.Name || a_lhs.Path != a_rhs.Path || a_lhs.Abstract != a_rhs.Abstract)
+            {
+                return false;
+            }
+
+            if (string.IsNullOrWhiteSpace(a_lhs.Parent) != string.IsNullOrWhiteSpace(a_rhs.Parent))
+            {
+                return false;
+            }
+            if (!string.IsNullOrWhiteSpace(a_lhs.Parent) && a_lhs.Parent != a_rhs.Parent)
+            {
+                return false;
+            }
+
+            return DataObjectsEquals(a_lhs.DefDataObjects, a_rhs.DefDataObjects);
+        }
+
         public static void RebuildDefData(Def a_def)
         {
             if (a_def == null)
@@ -650,17 +959,37 @@ namespace IcarianEditor
             }        
 
             int index;
-            if (s_defNameLookup.TryGetValue(a_def.DefName, out index))
+            bool sceneDef = false;
+            if (!s_defNameLookup.TryGetValue(a_def.DefName, out index))
+            {
+                if (!s_sceneDefLookup.TryGetValue(a_def.DefName, out index))
+                {
+                    Logger.Error("Cannot find def to rebuild");
+
+                    return;
+                }
+
+                sceneDef = true;
+            }
+
+            // Properties window rebuilds every frame so only count it as an edit if something actually changed
+            DefData data = GenerateData(a_def);
+            if (DefDataEquals(s_defs[index], data))
             {
-                s_defs[index] = GenerateData(a_def);
+                return;
             }
-            else if (s_sceneDefLookup.TryGetValue(a_def.DefName, out index))
+
+            s_defs[index] = data;
+
+            InvalidateDef(a_def.DefName);
+
+            if (sceneDef)
             {
-                s_defs[index] = GenerateData(a_def);
+                EditorScene.MarkDefDirty(a_def.DefName);
             }
             else
             {
-                Logger.Error("Cannot find def to rebuild");
+                s_dirtyDefs.Add(a_def.DefName);
             }
         }
     }
@@ -36,10 +36,21 @@ namespace IcarianEditor
     {
         static Dictionary<string, EditorScene> s_scenes = new Dictionary<string, EditorScene>();
 
-        string                     m_path;
-        List<SceneObjectData>      m_sceneObjects;
-        List<SceneObjectArrayData> m_sceneObjectArrays;
-        List<string>               m_defNames;
+        string                                m_path;
+        List<SceneObjectData>                 m_sceneObjects;
+        List<SceneObjectArrayData>            m_sceneObjectArrays;
+        List<string>                          m_defNames;
+
+        // IDs map to where the object sits in the list, removal swaps the last object into the hole to keep these valid
+        Dictionary<ulong, int>                m_objectLookup;
+        Dictionary<SceneObject, ulong>        m_objectIDs;
+        Dictionary<ulong, int>                m_arrayLookup;
+        Dictionary<SceneObjectArray, ulong>   m_arrayIDs;
+
+        // Set by anything that changes what gets saved, clean scenes are skipped on save
+        bool                                  m_dirty;
+        // Bumped when objects come and go or change state so views built off the scene know to rebuild
+        uint                                  m_version;
 
         public IEnumerable<SceneObjectData> SceneObjects
         {
@@ -70,28 +81,94 @@ namespace IcarianEditor
             m_sceneObjects = new List<SceneObjectData>();
             m_sceneObjectArrays = new List<SceneObjectArrayData>();
             m_defNames = new List<string>();
+
+            m_objectLookup = new Dictionary<ulong, int>();
+            m_objectIDs = new Dictionary<SceneObject, ulong>(new ReferenceComparer<SceneObject>());
+            m_arrayLookup = new Dictionary<ulong, int>();
+            m_arrayIDs = new Dictionary<SceneObjectArray, ulong>(new ReferenceComparer<SceneObjectArray>());
+
+            m_dirty = false;
+            m_version = 0;
         }
 
-        public ulong GetID(SceneObject a_sceneObject)
+        public uint Version
         {
-            foreach (SceneObjectData dat in m_sceneObjects)
+            get
+            {
+                return m_version;
+            }
+        }
+
+        public bool IsDirty
+        {
+            get
             {
-                if (dat.Object == a_sceneObject)
+                return m_dirty;
+            }
+        }
+
+        public void MarkDirty()
+        {
+            m_dirty = true;
+        }
+        // Scene defs live in the scene file so an edit to one has to dirty whichever scene owns it
+        internal static void MarkDefDirty(string a_defName)
+        {
+            foreach (EditorScene scene in s_scenes.Values)
+            {
+                if (scene.m_defNames.Contains(a_defName))
                 {
-                    return dat.ID;
+                    scene.m_dirty = true;
                 }
             }
+        }
+
+        public int SceneObjectCount
+        {
+            get
+            {
+                return m_sceneObjects.Count;
+            }
+        }
+        public int SceneObjectArrayCount
+        {
+            get
+            {
+                return m_sceneObjectArrays.Count;
+            }
+        }
+
+        void AddSceneObjectData(SceneObjectData a_data)
+        {
+            m_objectLookup.Add(a_data.ID, m_sceneObjects.Count);
+            m_objectIDs.Add(a_data.Object, a_data.ID);
+
+            m_sceneObjects.Add(a_data);
+        }
+        void AddSceneObjectArrayData(SceneObjectArrayData a_data)
+        {
+            m_arrayLookup.Add(a_data.ID, m_sceneObjectArrays.Count);
+            m_arrayIDs.Add(a_data.Array, a_data.ID);
+
+            m_sceneObjectArrays.Add(a_data);
+        }
+
+        public ulong GetID(SceneObject a_sceneObject)
+        {
+            ulong id;
+            if (a_sceneObject != null && m_objectIDs.TryGetValue(a_sceneObject, out id))
+            {
+                return id;
+            }
 
             return ulong.MaxValue;
         }
         public ulong GetID(SceneObjectArray a_sceneObjectArray)
         {
-            foreach (SceneObjectArrayData dat in m_sceneObjectArrays)
+            ulong id;
+            if (a_sceneObjectArray != null && m_arrayIDs.TryGetValue(a_sceneObjectArray, out id))
             {
-                if (dat.Array == a_sceneObjectArray)
-                {
-                    return dat.ID;
-                }
+                return id;
             }
 
             return ulong.MaxValue;
@@ -99,24 +176,20 @@ namespace IcarianEditor
 
         public SceneObject GetSceneObject(ulong a_id)
         {
-            foreach (SceneObjectData dat in m_sceneObjects)
+            int index;
+            if (m_objectLookup.TryGetValue(a_id, out index))
             {
-                if (dat.ID == a_id)
-                {
-                    return dat.Object;
-                }
+                return m_sceneObjects[index].Object;
             }
 
             return null;
         }
         public SceneObjectArray GetSceneObjectArray(ulong a_id)
         {
-            foreach (SceneObjectArrayData dat in m_sceneObjectArrays)
+            int index;
+            if (m_arrayLookup.TryGetValue(a_id, out index))
             {
-                if (dat.ID == a_id)
-                {
-                    return dat.Array;
-                }
+                return m_sceneObjectArrays[index].Array;
             }
 
             return null;
@@ -127,6 +200,9 @@ namespace IcarianEditor
             if (EditorDefLibrary.AddSceneDef(a_def))
             {
                 m_defNames.Add(a_def.DefName);
+
+                m_dirty = true;
+                ++m_version;
             }
         }
         public void RemoveDef(string a_defName)
@@ -134,6 +210,9 @@ namespace IcarianEditor
             if (EditorDefLibrary.RemoveSceneDef(a_defName))
             {
                 m_defNames.Remove(a_defName);
+
+                m_dirty = true;
+                ++m_version;
             }
         }
 
@@ -143,7 +222,7 @@ namespace IcarianEditor
         }
         public void AddSceneObject(string a_defName, Vector3 a_translation, Quaternion a_rotation, Vector3 a_scale)
         {
-            GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(a_defName);
+            GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(a_defName);
             if (def != null)
             {
                 SceneObject obj = new SceneObject()
@@ -160,20 +239,36 @@ namespace IcarianEditor
                     Object = obj
                 };
 
-                m_sceneObjects.Add(dat);
+                AddSceneObjectData(dat);
+
+                m_dirty = true;
+                ++m_version;
             }
         }
         public void RemoveSceneObject(ulong a_id)
         {
-            foreach (SceneObjectData dat in m_sceneObjects)
+            int index;
+            if (!m_objectLookup.TryGetValue(a_id, out index))
             {
-                if (dat.ID == a_id)
-                {
-                    m_sceneObjects.Remove(dat);
+                return;
+            }
 
-                    break;
-                }
+            m_objectIDs.Remove(m_sceneObjects[index].Object);
+            m_objectLookup.Remove(a_id);
+
+            int last = m_sceneObjects.Count - 1;
+            if (index != last)
+            {
+                SceneObjectData moved = m_sceneObjects[last];
+
+                m_sceneObjects[index] = moved;
+                m_objectLookup[moved.ID] = index;
             }
+
+            m_sceneObjects.RemoveAt(last);
+
+            m_dirty = true;
+            ++m_version;
         }
 
         public void AddSceneObjectArray(string a_defName)
@@ -182,7 +277,7 @@ namespace IcarianEditor
         }
         public void AddSceneObjectArray(string a_defName, Vector3 a_translation, Quaternion a_rotation)
         {
-            GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(a_defName);
+            GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(a_defName);
             if (def != null)
             {
                 SceneObjectArray array = new SceneObjectArray()
@@ -200,50 +295,59 @@ namespace IcarianEditor
                     Array = array
                 };
 
-                m_sceneObjectArrays.Add(dat);
+                AddSceneObjectArrayData(dat);
+
+                m_dirty = true;
+                ++m_version;
             }
         }
         public void RemoveSceneObjectArray(ulong a_id)
         {
-            foreach (SceneObjectArrayData dat in m_sceneObjectArrays)
+            int index;
+            if (!m_arrayLookup.TryGetValue(a_id, out index))
             {
-                if (dat.ID == a_id)
-                {
-                    m_sceneObjectArrays.Remove(dat);
+                return;
+            }
 
-                    break;
-                }
+            m_arrayIDs.Remove(m_sceneObjectArrays[index].Array);
+            m_arrayLookup.Remove(a_id);
+
+            int last = m_sceneObjectArrays.Count - 1;
+            if (index != last)
+            {
+                SceneObjectArrayData moved = m_sceneObjectArrays[last];
+
+                m_sceneObjectArrays[index] = moved;
+                m_arrayLookup[moved.ID] = index;
             }
+
+            m_sceneObjectArrays.RemoveAt(last);
+
+            m_dirty = true;
+            ++m_version;
         }
 
         public void SetVisible(ulong a_id, bool a_state)
         {
-            int objectCount = m_sceneObjects.Count;
-            for (int i = 0; i < objectCount; ++i)
+            int index;
+            if (m_objectLookup.TryGetValue(a_id, out index))
             {
-                SceneObjectData dat = m_sceneObjects[i];
-                if (dat.ID == a_id)
-                {
-                    dat.Visible = a_state;
+                SceneObjectData dat = m_sceneObjects[index];
+                dat.Visible = a_state;
 
-                    m_sceneObjects[i] = dat;
+                m_sceneObjects[index] = dat;
+                ++m_version;
 
-                    return;
-                }
+                return;
             }
 
-            int arrayCount = m_sceneObjectArrays.Count;
-            for (int i = 0; i < arrayCount; ++i)
+            if (m_arrayLookup.TryGetValue(a_id, out index))
             {
-                SceneObjectArrayData dat = m_sceneObjectArrays[i];
-                if (dat.ID == a_id)
-                {
-                    dat.Visible = a_state;
-
-                    m_sceneObjectArrays[i] = dat;
+                SceneObjectArrayData dat = m_sceneObjectArrays[index];
+                dat.Visible = a_state;
 
-                    return;
-                }
+                m_sceneObjectArrays[index] = dat;
+                ++m_version;
             }
         }
 
@@ -306,7 +410,7 @@ namespace IcarianEditor
 
             if (!string.IsNullOrWhiteSpace(obj.DefName))
             {
-                m_sceneObjects.Add(new SceneObjectData()
+                AddSceneObjectData(new SceneObjectData()
                 {
                     Visible = true,
                     ID = Workspace.NewID(),
@@ -384,7 +488,7 @@ namespace IcarianEditor
 
             if (!string.IsNullOrWhiteSpace(arr.DefName))
             {
-                m_sceneObjectArrays.Add(new SceneObjectArrayData()
+                AddSceneObjectArrayData(new SceneObjectArrayData()
                 {
                     Visible = true,
                     ID = Workspace.NewID(),
@@ -397,40 +501,45 @@ namespace IcarianEditor
             }
         }
 
-        void LoadObjects(XmlElement a_element)
+        // Objects are small so each one gets read into an element on its own instead of building the whole scene
+        void LoadObjects(XmlReader a_reader, XmlDocument a_doc)
         {
-            foreach (XmlNode node in a_element.ChildNodes)
+            if (!XmlStream.EnterElement(a_reader))
             {
-                if (node is XmlElement element)
+                return;
+            }
+
+            while (XmlStream.NextElement(a_reader))
+            {
+                switch (a_reader.Name)
                 {
-                    switch (element.Name)
-                    {
-                    case "GameObject":
-                    {
-                        LoadSceneObject(element);
+                case "GameObject":
+                {
+                    LoadSceneObject(a_doc.ReadNode(a_reader) as XmlElement);
 
-                        break;
-                    }
-                    case "GameObjectArray":
-                    {   
-                        LoadSceneObjectArray(element);
+                    break;
+                }
+                case "GameObjectArray":
+                {   
+                    LoadSceneObjectArray(a_doc.ReadNode(a_reader) as XmlElement);
 
-                        break;
-                    }
-                    default:
-                    {
-                        Logger.Error($"IcarianEditorCS: Invalid object element {element.Name}");
+                    break;
+                }
+                default:
+                {
+                    Logger.Error($"IcarianEditorCS: Invalid object element {a_reader.Name}");
 
-                        break;
-                    }
-                    }
+                    a_reader.Skip();
+
+                    break;
+                }
                 }
             }
         }
 
-        void LoadDefs(XmlElement a_element)
+        void LoadDefs(XmlReader a_reader, XmlDocument a_doc)
         {
-            IEnumerable<string> defNames = EditorDefLibrary.LoadSceneDefs(a_element);
+            IEnumerable<string> defNames = EditorDefLibrary.LoadSceneDefs(a_reader, a_doc);
 
             foreach (string defName in defNames)
             {
@@ -448,167 +557,322 @@ namespace IcarianEditor
             return null;
         }
 
-        internal static EditorScene Load(XmlDocument a_doc, string a_path)
+        internal static EditorScene Load(XmlReader a_reader, string a_path)
         {
             EditorScene scene = new EditorScene(a_path);
 
-            if (a_doc.DocumentElement is XmlElement root)
+            // Only owns the nodes for each object while it is being read
+            XmlDocument doc = new XmlDocument();
+
+            if (a_reader.MoveToContent() == XmlNodeType.Element && XmlStream.EnterElement(a_reader))
+            {
+                while (XmlStream.NextElement(a_reader))
+                {
+                    switch (a_reader.Name)
+                    {
+                    case "Objects":
+                    {
+                        scene.LoadObjects(a_reader, doc);
+
+                        break;
+                    }
+                    case "Defs":
+                    {
+                        scene.LoadDefs(a_reader, doc);
+
+                        break;
+                    }
+                    default:
+                    {
+                        Logger.Error($"IcarianEditorCS: Invalid scene element {a_reader.Name}");
+
+                        a_reader.Skip();
+
+                        break;
+                    }
+                    }
+                }
+            }
+
+            s_scenes.Add(a_path, scene);
+
+            return scene;
+        }
+
+        byte[] WriteCache()
+        {
+            using (MemoryStream stream = new MemoryStream())
+            using (BinaryWriter writer = new BinaryWriter(stream))
+            {
+                ParsedCache.WriteHeader(writer);
+
+                writer.Write(m_sceneObjects.Count);
+                foreach (SceneObjectData dat in m_sceneObjects)
+                {
+                    SceneObject obj = dat.Object;
+
+                    ParsedCache.WriteVector3(writer, obj.Translation);
+                    ParsedCache.WriteQuaternion(writer, obj.Rotation);
+                    ParsedCache.WriteVector3(writer, obj.Scale);
+                    ParsedCache.WriteString(writer, obj.DefName);
+                }
+
+                writer.Write(m_sceneObjectArrays.Count);
+                foreach (SceneObjectArrayData dat in m_sceneObjectArrays)
+                {
+                    SceneObjectArray arr = dat.Array;
+
+                    ParsedCache.WriteVector3(writer, arr.Translation);
+                    ParsedCache.WriteQuaternion(writer, arr.Rotation);
+                    ParsedCache.WriteIVector3(writer, arr.Count);
+                    ParsedCache.WriteVector3(writer, arr.Spacing);
+                    ParsedCache.WriteString(writer, arr.DefName);
+                }
+
+                List<DefData> defs = new List<DefData>(m_defNames.Count);
+                foreach (string defName in m_defNames)
+                {
+                    DefData data;
+                    if (EditorDefLibrary.GetSceneDefData(defName, out data))
+                    {
+                        defs.Add(data);
+                    }
+                }
+
+                writer.Write(defs.Count);
+                foreach (DefData data in defs)
+                {
+                    ParsedCache.WriteDefData(writer, data);
+                }
+
+                writer.Flush();
+
+                return stream.ToArray();
+            }
+        }
+
+        // Everything gets read out before anything is added so a bad entry does not leave half a scene behind
+        static EditorScene LoadCache(byte[] a_data, string a_path)
+        {
+            List<SceneObject> objects;
+            List<SceneObjectArray> arrays;
+            List<DefData> defs;
+
+            using (MemoryStream stream = new MemoryStream(a_data, false))
+            using (BinaryReader reader = new BinaryReader(stream))
             {
-                foreach (XmlNode node in root.ChildNodes)
+                try
                 {
-                    if (node is XmlElement element)
+                    if (!ParsedCache.ReadHeader(reader))
+                    {
+                        return null;
+                    }
+
+                    int objectCount = reader.ReadInt32();
+                    objects = new List<SceneObject>(objectCount);
+                    for (int i = 0; i < objectCount; ++i)
+                    {
+                        SceneObject obj = new SceneObject();
+                        obj.Translation = ParsedCache.ReadVector3(reader);
+                        obj.Rotation = ParsedCache.ReadQuaternion(reader);
+                        obj.Scale = ParsedCache.ReadVector3(reader);
+                        obj.DefName = ParsedCache.ReadString(reader);
+
+                        objects.Add(obj);
+                    }
+
+                    int arrayCount = reader.ReadInt32();
+                    arrays = new List<SceneObjectArray>(arrayCount);
+                    for (int i = 0; i < arrayCount; ++i)
                     {
-                        switch (element.Name)
-                        {
-                        case "Objects":
-                        {
-                            scene.LoadObjects(element);
-
-                            break;
-                        }
-                        case "Defs":
-                        {
-                            scene.LoadDefs(element);
-
-                            break;
-                        }
-                        default:
-                        {
-                            Logger.Error($"IcarianEditorCS: Invalid scene element {element.Name}");
-
-                            break;
-                        }
-                        }
+                        SceneObjectArray arr = new SceneObjectArray();
+                        arr.Translation = ParsedCache.ReadVector3(reader);
+                        arr.Rotation = ParsedCache.ReadQuaternion(reader);
+                        arr.Count = ParsedCache.ReadIVector3(reader);
+                        arr.Spacing = ParsedCache.ReadVector3(reader);
+                        arr.DefName = ParsedCache.ReadString(reader);
+
+                        arrays.Add(arr);
                     }
+
+                    int defCount = reader.ReadInt32();
+                    defs = new List<DefData>(defCount);
+                    for (int i = 0; i < defCount; ++i)
+                    {
+                        defs.Add(ParsedCache.ReadDefData(reader));
+                    }
+                }
+                catch (EndOfStreamException)
+                {
+                    return null;
+                }
+
+                if (stream.Position != stream.Length)
+                {
+                    return null;
                 }
             }
 
+            EditorScene scene = new EditorScene(a_path);
+
+            foreach (SceneObject obj in objects)
+            {
+                scene.AddSceneObjectData(new SceneObjectData()
+                {
+                    Visible = true,
+                    ID = Workspace.NewID(),
+                    Object = obj
+                });
+            }
+            foreach (SceneObjectArray arr in arrays)
+            {
+                scene.AddSceneObjectArrayData(new SceneObjectArrayData()
+                {
+                    Visible = true,
+                    ID = Workspace.NewID(),
+                    Array = arr
+                });
+            }
+
+            scene.m_defNames.AddRange(EditorDefLibrary.LoadSceneDefs(defs));
+
             s_scenes.Add(a_path, scene);
 
             return scene;
         }
 
-        static void LoadScenes(byte[][] a_data, string[] a_paths)
+        static void LoadScenes(byte[][] a_data, string[] a_paths, byte[][] a_cache)
         {
             uint count = (uint)a_paths.LongLength;   
 
             for (uint i = 0; i < count; ++i)
             {
                 string path = a_paths[i];
+                byte[] cache = a_cache[i];
 
-                MemoryStream stream = new MemoryStream(a_data[i]);
+                if (cache != null && LoadCache(cache, path) != null)
+                {
+                    continue;
+                }
 
-                XmlDocument doc = new XmlDocument();
-                doc.Load(stream);
+                using (XmlReader reader = XmlStream.CreateReader(a_data[i]))
+                {
+                    EditorScene scene = Load(reader, path);
 
-                Load(doc, path);
+                    EditorSceneInterop.WriteSceneCache(path, scene.WriteCache());
+                }
             }
         }
+        static void WriteElement(XmlWriter a_writer, XmlElement a_element)
+        {
+            if (a_element != null)
+            {
+                a_element.WriteTo(a_writer);
+            }
+        }
+
         static void Serialize()
         {
-            EditorScene scene = Workspace.GetScene();
-            if (scene == null)
+            foreach (EditorScene scene in s_scenes.Values)
             {
-                return;
+                if (scene.m_dirty)
+                {
+                    scene.WriteScene();
+
+                    scene.m_dirty = false;
+                }
             }
+        }
 
+        void WriteScene()
+        {
+            // Maths types only know how to turn themselves into elements so use a scratch document for those and write them straight out
             XmlDocument doc = new XmlDocument();
-            doc.AppendChild(doc.CreateXmlDeclaration("1.0", "UTF-8", null));
 
-            XmlElement root = doc.CreateElement("Scene");
-            doc.AppendChild(root);
+            MemoryStream stream = new MemoryStream();
+            XmlTextWriter writer = XmlStream.CreateWriter(stream);
+
+            writer.WriteStartElement("Scene");
+            writer.WriteStartElement("Objects");
 
-            XmlElement objects = doc.CreateElement("Objects");
-            root.AppendChild(objects);
+            bool emptyObjects = true;
 
-            foreach (SceneObjectData dat in scene.m_sceneObjects)
+            foreach (SceneObjectData dat in m_sceneObjects)
             {
                 SceneObject obj = dat.Object;
 
-                XmlElement element = doc.CreateElement("GameObject");
-                objects.AppendChild(element);
+                writer.WriteStartElement("GameObject");
 
-                XmlElement translation = obj.Translation.ToXml(doc, "Translation");
-                if (translation != null)
-                {
-                    element.AppendChild(translation);
-                }
-                XmlElement rotation = obj.Rotation.ToXml(doc, "Rotation");
-                if (rotation != null)
-                {
-                    element.AppendChild(rotation);
-                }
-                XmlElement scale = obj.Scale.ToXml(doc, "Scale", Vector3.One);
-                if (scale != null)
-                {
-                    element.AppendChild(scale);
-                }
+                WriteElement(writer, obj.Translation.ToXml(doc, "Translation"));
+                WriteElement(writer, obj.Rotation.ToXml(doc, "Rotation"));
+                WriteElement(writer, obj.Scale.ToXml(doc, "Scale", Vector3.One));
 
-                XmlElement defName = doc.CreateElement("DefName");
-                defName.InnerText = obj.DefName;
-                element.AppendChild(defName);
+                writer.WriteStartElement("DefName");
+                writer.WriteString(obj.DefName);
+                writer.WriteFullEndElement();
+
+                writer.WriteFullEndElement();
+
+                emptyObjects = false;
             }
 
-            foreach (SceneObjectArrayData dat in scene.m_sceneObjectArrays)
+            foreach (SceneObjectArrayData dat in m_sceneObjectArrays)
             {
                 SceneObjectArray arr = dat.Array;
 
-                XmlElement element = doc.CreateElement("GameObjectArray");
-                objects.AppendChild(element);
+                writer.WriteStartElement("GameObjectArray");
 
-                XmlElement translation = arr.Translation.ToXml(doc, "Translation");
-                if (translation != null)
-                {
-                    element.AppendChild(translation);
-                }
-                XmlElement rotation = arr.Rotation.ToXml(doc, "Rotation");
-                if (rotation != null)
-                {
-                    element.AppendChild(rotation);
-                }
-                XmlElement count = arr.Count.ToXml(doc, "Count", IVector3.One);
-                if (count != null)
-                {
-                    element.AppendChild(count);
-                }
-                XmlElement spacing = arr.Spacing.ToXml(doc, "Spacing", Vector3.One);
-                if (spacing != null)
-                {
-                    element.AppendChild(spacing);
-                }
+                WriteElement(writer, arr.Translation.ToXml(doc, "Translation"));
+                WriteElement(writer, arr.Rotation.ToXml(doc, "Rotation"));
+                WriteElement(writer, arr.Count.ToXml(doc, "Count", IVector3.One));
+                WriteElement(writer, arr.Spacing.ToXml(doc, "Spacing", Vector3.One));
 
-                XmlElement defName = doc.CreateElement("DefName");
-                defName.InnerText = arr.DefName;
-                element.AppendChild(defName);
+                writer.WriteStartElement("DefName");
+                writer.WriteString(arr.DefName);
+                writer.WriteFullEndElement();
+
+                writer.WriteFullEndElement();
+
+                emptyObjects = false;
+            }
+
+            // Matches an element with no children closing as <Objects />
+            if (emptyObjects)
+            {
+                writer.WriteEndElement();
+            }
+            else
+            {
+                writer.WriteFullEndElement();
             }
 
-            XmlElement defs = doc.CreateElement("Defs");
-            root.AppendChild(defs);
+            writer.WriteStartElement("Defs");
 
-            foreach (string defName in scene.m_defNames)
+            bool emptyDefs = true;
+            foreach (string defName in m_defNames)
             {
-                XmlElement def = EditorDefLibrary.CreateDef(doc, defName, true);
-                if (def != null)
+                if (EditorDefLibrary.WriteDef(writer, defName, true))
                 {
-                    defs.AppendChild(def);
+                    emptyDefs = false;
                 }
             }
 
-            MemoryStream stream = new MemoryStream();
-            XmlTextWriter writer = new XmlTextWriter(stream, System.Text.Encoding.UTF8);
-            writer.Formatting = Formatting.Indented;
+            if (emptyDefs)
+            {
+                writer.WriteEndElement();
+            }
+            else
+            {
+                writer.WriteFullEndElement();
+            }
 
-            doc.WriteContentTo(writer);
+            writer.WriteFullEndElement();
 
             writer.Flush();
-            stream.Flush();
-
-            stream.Position = 0;
 
-            StreamReader reader = new StreamReader(stream);
-            byte[] data = Encoding.UTF8.GetBytes(reader.ReadToEnd());
+            byte[] data = stream.ToArray();
 
-            EditorSceneInterop.WriteScene(scene.m_path, data);
+            EditorSceneInterop.WriteScene(m_path, data);
         }
     }
 }
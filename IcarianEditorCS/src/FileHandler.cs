@@ -2,20 +2,6 @@
 // 
 // License at end of file.
 
-using IcarianEngine;
-using IcarianEngine.Rendering;
-using System;
-using System.IO;
-using System.Reflection;
-using System.Runtime.CompilerServices;
-using System.Runtime.InteropServices;
-
-#include "InteropBinding.h"
-#include "EditorFileHandlerInterop.h"
-#include "EditorFileHandlerInteropStructures.h"
-
-FILEHANDLER_EXPORT_TABLE(IOP_BIND_FUNCTION);
-
 namespace IcarianEditor
 {
     public static class FileHandler
@@ -29,34 +15,6 @@ namespace IcarianEditor
         {
 
         }
-
-        static void GetFileHandle(string a_file)
-        {
-            FileTextureHandle handle = new FileTextureHandle();
-            handle.Addr = uint.MaxValue;
-            handle.Mode = FileTextureMode.Null;
-
-            switch (Path.GetExtension(a_file))
-            {
-            case ".png":
-            case ".ktx2":
-            {
-                Texture tex = AssetLibrary.LoadTexture(a_file);
-                if (tex != null)
-                {
-                    Type type = typeof(Texture);
-                    FieldInfo info = type.GetField("m_bufferAddr", BindingFlags.NonPublic | BindingFlags.Instance);
-
-                    handle.Addr = (uint)info.GetValue(tex);
-                    handle.Mode = FileTextureMode.Texture;
-                }
-
-                break;
-            }
-            }
-
-            FileHandlerInterop.SetFileHandle(handle.Addr, (uint)handle.Mode);
-        }
     }
 }
 
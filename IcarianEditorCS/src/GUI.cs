@@ -83,7 +83,7 @@ namespace IcarianEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         public extern static void PopID();
         [MethodImpl(MethodImplOptions.InternalCall)]
-        extern static string GetCurrentID();
+        extern static uint GetCurrentID();
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         public extern static void Label(string a_str);
@@ -115,6 +115,16 @@ namespace IcarianEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         public extern static void Separator();
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public extern static void BeginListClipper(uint a_count, float a_itemHeight = -1.0f);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        extern static uint GetListClipperStep(out uint a_start, out uint a_end);
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        public extern static void EndListClipper();
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        internal extern static void ExecuteCommands(uint[] a_commands, uint a_commandCount, char[] a_strings, uint a_stringLength, uint[] a_results, uint a_resultCount);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         extern static uint GetShiftModifier();
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -148,6 +158,25 @@ namespace IcarianEditor
             }
         }
 
+        // Gives the range of rows that are on screen, keep stepping until it returns false
+        public static bool ListClipperStep(out int a_start, out int a_end)
+        {
+            uint start;
+            uint end;
+            if (GetListClipperStep(out start, out end) != 0)
+            {
+                a_start = (int)start;
+                a_end = (int)end;
+
+                return true;
+            }
+
+            a_start = 0;
+            a_end = 0;
+
+            return false;
+        }
+
         public static bool BeginChild(string a_label, Vector2 a_size)
         {
             return GetBeginChild(a_label, a_size) != 0;
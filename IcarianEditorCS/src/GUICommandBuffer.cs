@@ -0,0 +1,254 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+using IcarianEngine;
+using System;
+using System.Collections.Generic;
+
+#include "EditorGUIInteropStructures.h"
+
+namespace IcarianEditor
+{
+    // Records read mostly widgets and plays them back natively in one call instead of one call per widget
+    // Results are only filled in by Execute so anything that has to act on its result straight away has to go through GUI
+    // Meant to be kept around and reused every frame so the buffers only grow once
+    public class GUICommandBuffer
+    {
+        uint[]     m_commands;
+        uint       m_commandCount;
+
+        char[]     m_strings;
+        uint       m_stringLength;
+
+        uint[]     m_results;
+        uint       m_resultCount;
+
+        // Indices of the skip argument for open tree nodes and tables
+        Stack<int> m_scopes;
+
+        public GUICommandBuffer()
+        {
+            m_commands = new uint[256];
+            m_commandCount = 0;
+
+            m_strings = new char[1024];
+            m_stringLength = 0;
+
+            m_results = new uint[64];
+            m_resultCount = 0;
+
+            m_scopes = new Stack<int>();
+        }
+
+        void WriteCommand(GUICommand a_command, uint a_argCount)
+        {
+            uint size = m_commandCount + a_argCount + 1;
+            if (size > m_commands.Length)
+            {
+                Array.Resize(ref m_commands, Math.Max(m_commands.Length * 2, (int)size));
+            }
+
+            m_commands[m_commandCount++] = (uint)a_command;
+        }
+        void WriteArg(uint a_value)
+        {
+            m_commands[m_commandCount++] = a_value;
+        }
+        void WriteString(string a_str)
+        {
+            if (a_str == null)
+            {
+                a_str = string.Empty;
+            }
+
+            uint size = m_stringLength + (uint)a_str.Length;
+            if (size > m_strings.Length)
+            {
+                Array.Resize(ref m_strings, Math.Max(m_strings.Length * 2, (int)size));
+            }
+
+            a_str.CopyTo(0, m_strings, (int)m_stringLength, a_str.Length);
+
+            WriteArg(m_stringLength);
+            WriteArg((uint)a_str.Length);
+
+            m_stringLength = size;
+        }
+        int WriteResult()
+        {
+            if (m_resultCount >= m_results.Length)
+            {
+                Array.Resize(ref m_results, m_results.Length * 2);
+            }
+
+            int index = (int)m_resultCount++;
+            m_results[index] = 0;
+
+            WriteArg((uint)index);
+
+            return index;
+        }
+        void PushScope()
+        {
+            m_scopes.Push((int)m_commandCount);
+
+            WriteArg(0);
+        }
+        void PopScope()
+        {
+            if (m_scopes.Count <= 0)
+            {
+                Logger.Error("IcarianEditorCS: GUICommandBuffer scope popped without being pushed");
+
+                return;
+            }
+
+            m_commands[m_scopes.Pop()] = m_commandCount;
+        }
+
+        public void Clear()
+        {
+            m_commandCount = 0;
+            m_stringLength = 0;
+            m_resultCount = 0;
+
+            m_scopes.Clear();
+        }
+
+        public void Label(string a_str)
+        {
+            WriteCommand(GUICommand.Label, 2);
+            WriteString(a_str);
+        }
+        public void SameLine()
+        {
+            WriteCommand(GUICommand.SameLine, 0);
+        }
+        public void Separator()
+        {
+            WriteCommand(GUICommand.Separator, 0);
+        }
+        public void Indent()
+        {
+            WriteCommand(GUICommand.Indent, 0);
+        }
+        public void Unindent()
+        {
+            WriteCommand(GUICommand.Unindent, 0);
+        }
+
+        public void PushID(string a_id)
+        {
+            WriteCommand(GUICommand.PushID, 2);
+            WriteString(a_id);
+        }
+        public void PopID()
+        {
+            WriteCommand(GUICommand.PopID, 0);
+        }
+
+        // Returns the index to check with GetResult after Execute
+        public int Button(string a_label)
+        {
+            WriteCommand(GUICommand.Button, 3);
+            WriteString(a_label);
+
+            return WriteResult();
+        }
+        public int Selectable(string a_label, bool a_selected = false)
+        {
+            WriteCommand(GUICommand.Selectable, 4);
+            WriteString(a_label);
+            WriteArg(a_selected ? 1U : 0U);
+
+            return WriteResult();
+        }
+
+        // Children are always recorded, native skips them when the node is closed
+        public int BeginTreeNode(string a_label)
+        {
+            WriteCommand(GUICommand.TreeNode, 4);
+            WriteString(a_label);
+            int result = WriteResult();
+            PushScope();
+
+            return result;
+        }
+        public void EndTreeNode()
+        {
+            WriteCommand(GUICommand.TreePop, 0);
+            PopScope();
+        }
+
+        public void BeginTable(string a_id, uint a_columns)
+        {
+            WriteCommand(GUICommand.BeginTable, 4);
+            WriteString(a_id);
+            WriteArg(a_columns);
+            PushScope();
+        }
+        public void TableNextRow()
+        {
+            WriteCommand(GUICommand.TableNextRow, 0);
+        }
+        public void TableNextColumn()
+        {
+            WriteCommand(GUICommand.TableNextColumn, 0);
+        }
+        public void EndTable()
+        {
+            WriteCommand(GUICommand.EndTable, 0);
+            PopScope();
+        }
+
+        public void Execute()
+        {
+            if (m_scopes.Count > 0)
+            {
+                Logger.Error("IcarianEditorCS: GUICommandBuffer executed with open scopes");
+
+                return;
+            }
+
+            if (m_commandCount <= 0)
+            {
+                return;
+            }
+
+            GUI.ExecuteCommands(m_commands, m_commandCount, m_strings, m_stringLength, m_results, m_resultCount);
+        }
+
+        public bool GetResult(int a_index)
+        {
+            if (a_index < 0 || a_index >= m_resultCount)
+            {
+                return false;
+            }
+
+            return m_results[a_index] != 0;
+        }
+    }
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
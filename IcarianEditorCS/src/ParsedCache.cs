@@ -0,0 +1,215 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+using IcarianEngine.Definitions;
+using IcarianEngine.Maths;
+using System.Collections.Generic;
+using System.IO;
+
+namespace IcarianEditor
+{
+    // Binary form of parsed defs and scenes that gets kept in the project cache
+    // Native side checks it against the source xml and the checksum, this only has to agree with itself
+    internal static class ParsedCache
+    {
+        // Bump whenever what gets written here changes, old entries just get parsed from xml again
+        public const int Version = 1;
+
+        public static void WriteHeader(BinaryWriter a_writer)
+        {
+            a_writer.Write(Version);
+        }
+        public static bool ReadHeader(BinaryReader a_reader)
+        {
+            return a_reader.ReadInt32() == Version;
+        }
+
+        public static void WriteString(BinaryWriter a_writer, string a_str)
+        {
+            a_writer.Write(a_str != null);
+            if (a_str != null)
+            {
+                a_writer.Write(a_str);
+            }
+        }
+        public static string ReadString(BinaryReader a_reader)
+        {
+            if (a_reader.ReadBoolean())
+            {
+                return a_reader.ReadString();
+            }
+
+            return null;
+        }
+
+        public static void WriteVector3(BinaryWriter a_writer, Vector3 a_value)
+        {
+            a_writer.Write(a_value.X);
+            a_writer.Write(a_value.Y);
+            a_writer.Write(a_value.Z);
+        }
+        public static Vector3 ReadVector3(BinaryReader a_reader)
+        {
+            float x = a_reader.ReadSingle();
+            float y = a_reader.ReadSingle();
+            float z = a_reader.ReadSingle();
+
+            return new Vector3(x, y, z);
+        }
+
+        public static void WriteIVector3(BinaryWriter a_writer, IVector3 a_value)
+        {
+            a_writer.Write(a_value.X);
+            a_writer.Write(a_value.Y);
+            a_writer.Write(a_value.Z);
+        }
+        public static IVector3 ReadIVector3(BinaryReader a_reader)
+        {
+            int x = a_reader.ReadInt32();
+            int y = a_reader.ReadInt32();
+            int z = a_reader.ReadInt32();
+
+            return new IVector3(x, y, z);
+        }
+
+        public static void WriteQuaternion(BinaryWriter a_writer, Quaternion a_value)
+        {
+            a_writer.Write(a_value.X);
+            a_writer.Write(a_value.Y);
+            a_writer.Write(a_value.Z);
+            a_writer.Write(a_value.W);
+        }
+        public static Quaternion ReadQuaternion(BinaryReader a_reader)
+        {
+            float x = a_reader.ReadSingle();
+            float y = a_reader.ReadSingle();
+            float z = a_reader.ReadSingle();
+            float w = a_reader.ReadSingle();
+
+            return new Quaternion(x, y, z, w);
+        }
+
+        // Children can be null or empty coming out of the loader so keep them apart
+        static void WriteDataObjects(BinaryWriter a_writer, List<DefDataObject> a_objects)
+        {
+            if (a_objects == null)
+            {
+                a_writer.Write(-1);
+
+                return;
+            }
+
+            a_writer.Write(a_objects.Count);
+            foreach (DefDataObject obj in a_objects)
+            {
+                WriteString(a_writer, obj.Name);
+                WriteString(a_writer, obj.Text);
+                WriteDataObjects(a_writer, obj.Children);
+            }
+        }
+        static List<DefDataObject> ReadDataObjects(BinaryReader a_reader)
+        {
+            int count = a_reader.ReadInt32();
+            if (count < 0)
+            {
+                return null;
+            }
+
+            List<DefDataObject> objects = new List<DefDataObject>(count);
+            for (int i = 0; i < count; ++i)
+            {
+                DefDataObject obj = new DefDataObject();
+                obj.Name = ReadString(a_reader);
+                obj.Text = ReadString(a_reader);
+                obj.Children = ReadDataObjects(a_reader);
+
+                objects.Add(obj);
+            }
+
+            return objects;
+        }
+
+        public static void WriteDefData(BinaryWriter a_writer, DefData a_data)
+        {
+            a_writer.Write(a_data.Abstract);
+            WriteString(a_writer, a_data.Type);
+            WriteString(a_writer, a_data.Name);
+            WriteString(a_writer, a_data.Parent);
+            WriteString(a_writer, a_data.Path);
+            WriteDataObjects(a_writer, a_data.DefDataObjects);
+        }
+        public static DefData ReadDefData(BinaryReader a_reader)
+        {
+            DefData data = new DefData();
+            data.Abstract = a_reader.ReadBoolean();
+            data.Type = ReadString(a_reader);
+            data.Name = ReadString(a_reader);
+            data.Parent = ReadString(a_reader);
+            data.Path = ReadString(a_reader);
+            data.DefDataObjects = ReadDataObjects(a_reader);
+
+            return data;
+        }
+
+        public static byte[] WriteDef(DefData a_data)
+        {
+            using (MemoryStream stream = new MemoryStream())
+            using (BinaryWriter writer = new BinaryWriter(stream))
+            {
+                WriteHeader(writer);
+                WriteDefData(writer, a_data);
+
+                writer.Flush();
+
+                return stream.ToArray();
+            }
+        }
+        public static bool ReadDef(byte[] a_data, out DefData a_def)
+        {
+            a_def = default(DefData);
+
+            using (MemoryStream stream = new MemoryStream(a_data, false))
+            using (BinaryReader reader = new BinaryReader(stream))
+            {
+                try
+                {
+                    if (!ReadHeader(reader))
+                    {
+                        return false;
+                    }
+
+                    a_def = ReadDefData(reader);
+                }
+                catch (EndOfStreamException)
+                {
+                    return false;
+                }
+
+                return stream.Position == stream.Length;
+            }
+        }
+    }
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file
@@ -50,10 +50,15 @@ namespace IcarianEditor.Properties
                 m_lastObject = obj;
             }
 
+            // Objects are edited in place so the scene needs telling that it has something to save
+            bool changed = false;
+
             Vector3 translation = selectionObject.Translation;
             if (GUI.RVec3Field("Translation", ref translation))
             {
                 selectionObject.Translation = translation;
+
+                changed = true;
             }
 
             switch (m_mode)
@@ -71,6 +76,8 @@ namespace IcarianEditor.Properties
 
                         selectionObject.Rotation = rot;
                         m_axisAngle = rot.ToAxisAngle();
+
+                        changed = true;
                     }
 
                     break;
@@ -82,6 +89,8 @@ namespace IcarianEditor.Properties
 
                     selectionObject.Rotation = rot;
                     m_axisAngle = rot.ToAxisAngle();
+
+                    changed = true;
                 }
 
                 break;
@@ -105,6 +114,8 @@ namespace IcarianEditor.Properties
 
                         selectionObject.Rotation = rot;
                         m_euler = rot.ToEuler();
+
+                        changed = true;
                     }
 
                     break;
@@ -122,6 +133,8 @@ namespace IcarianEditor.Properties
 
                     selectionObject.Rotation = rot;
                     m_euler = rot.ToEuler();
+
+                    changed = true;
                 }
 
                 break;
@@ -134,6 +147,8 @@ namespace IcarianEditor.Properties
                     m_euler = quat.ToEuler();
                     m_axisAngle = quat.ToAxisAngle();
                     selectionObject.Rotation = quat;
+
+                    changed = true;
                 }
 
                 break;
@@ -144,7 +159,7 @@ namespace IcarianEditor.Properties
             {
             case SelectionObjectMode.SceneObject:
             {
-                GUI.RVec3Field("Scale", ref selectionObject.SceneObject.Scale, Vector3.One);
+                changed |= GUI.RVec3Field("Scale", ref selectionObject.SceneObject.Scale, Vector3.One);
 
                 break;
             }
@@ -155,22 +170,37 @@ namespace IcarianEditor.Properties
                 if (GUI.RIntField("X", ref count.X, 1))
                 {
                     selectionObject.SceneObjectArray.Count.X = Mathf.Max(1, count.X);
+
+                    changed = true;
                 }
                 if (GUI.RIntField("Y", ref count.Y, 1))
                 {
                     selectionObject.SceneObjectArray.Count.Y = Mathf.Max(1, count.Y);
+
+                    changed = true;
                 }
                 if (GUI.RIntField("Z", ref count.Z, 1))
                 {
                     selectionObject.SceneObjectArray.Count.Z = Mathf.Max(1, count.Z);
+
+                    changed = true;
                 }
 
-                GUI.RVec3Field("Spacing", ref selectionObject.SceneObjectArray.Spacing, Vector3.One);
+                changed |= GUI.RVec3Field("Spacing", ref selectionObject.SceneObjectArray.Spacing, Vector3.One);
 
                 break;
             }
             }
 
+            if (changed)
+            {
+                EditorScene scene = Workspace.GetScene();
+                if (scene != null)
+                {
+                    scene.MarkDirty();
+                }
+            }
+
             a_object = selectionObject;
         }
     }
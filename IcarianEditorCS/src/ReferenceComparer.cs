@@ -2,22 +2,29 @@
 // 
 // License at end of file.
 
-#pragma once 
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
 
-#include "InteropTypes.h"
+namespace IcarianEditor
+{
+    // Hashes by identity so engine types that override Equals can still be used as keys
+    internal class ReferenceComparer<T> : IEqualityComparer<T> where T : class
+    {
+        public bool Equals(T a_lhs, T a_rhs)
+        {
+            return object.ReferenceEquals(a_lhs, a_rhs);
+        }
 
-#define FILEHANDLER_EXPORT_TABLE(F) \
-    F(void, IcarianEditor, FileHandlerInterop, SetFileHandle, \
-    { \
-        FileTextureHandle handle; \
-        handle.Addr = a_addr; \
-        handle.Mode = (e_FileTextureMode)a_mode; \
-        Instance->SetFileHandle(handle); \
-    }, IOP_UINT32 a_addr, IOP_UINT32 a_mode) \
+        public int GetHashCode(T a_obj)
+        {
+            return RuntimeHelpers.GetHashCode(a_obj);
+        }
+    }
+}
 
 // MIT License
 // 
-// Copyright (c) 2024 River Govers
+// Copyright (c) 2025 River Govers
 // 
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -74,7 +74,7 @@ namespace IcarianEditor.Windows
         {
             foreach (ComponentDef c in a_def.Components)
             {
-                ComponentDef component = EditorDefLibrary.GenerateDef<ComponentDef>(c.DefName);
+                ComponentDef component = EditorDefLibrary.GetDef<ComponentDef>(c.DefName);
 
                 Type t = component.ComponentType;
                 if (s_componentLookup.ContainsKey(t))
@@ -82,6 +82,7 @@ namespace IcarianEditor.Windows
                     EditorDisplay disp = s_componentLookup[t];
                     if (disp != null)
                     {
+                        // Displays that edit the shared def return true and the rebuild drops it from the cache
                         if (disp.Render(a_selected, component, a_transform, a_view, a_proj, a_screenWidth, a_screenHeight))
                         {
                             EditorDefLibrary.RebuildDefData(component);
@@ -103,7 +104,7 @@ namespace IcarianEditor.Windows
 
             foreach (GameObjectDef c in a_gameObjectDef.Children)
             {
-                GameObjectDef gameObject = EditorDefLibrary.GenerateDef<GameObjectDef>(c.DefName);
+                GameObjectDef gameObject = EditorDefLibrary.GetDef<GameObjectDef>(c.DefName);
                 if (gameObject == null)
                 {
                     continue;
@@ -114,7 +115,7 @@ namespace IcarianEditor.Windows
         }
         static void RenderArray(SceneObjectArray a_array, Matrix4 a_view, Matrix4 a_proj, uint a_screenWidth, uint a_screenHeight)
         {
-            GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(a_array.DefName);
+            GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(a_array.DefName);
             if (def == null)
             {
                 return;
@@ -156,7 +157,7 @@ namespace IcarianEditor.Windows
                 }
 
                 SceneObject obj = objData.Object;
-                GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(obj.DefName);
+                GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(obj.DefName);
                 if (def != null)
                 {
                     bool selected = Workspace.SelectionContains(obj);
@@ -180,7 +181,7 @@ namespace IcarianEditor.Windows
 
         static void PeekDefPath(string a_path, Vector3 a_editorPos, Matrix4 a_view, Matrix4 a_proj, uint a_screenWidth, uint a_screenHeight)
         {
-            GameObjectDef def = EditorDefLibrary.GeneratePathDef<GameObjectDef>(a_path);
+            GameObjectDef def = EditorDefLibrary.GetPathDef<GameObjectDef>(a_path);
             if (def != null)
             {
                 Matrix4 transform = new Matrix4(Vector4.UnitX, Vector4.UnitY, Vector4.UnitZ, new Vector4(a_editorPos, 1.0f));
@@ -198,7 +199,7 @@ namespace IcarianEditor.Windows
                 return;
             }
 
-            GameObjectDef def = EditorDefLibrary.GeneratePathDef<GameObjectDef>(a_path);
+            GameObjectDef def = EditorDefLibrary.GetPathDef<GameObjectDef>(a_path);
             if (def != null)
             {
                 scene.AddSceneObject(def.DefName, a_editorPos, Quaternion.Identity, Vector3.One);
@@ -231,23 +232,17 @@ namespace IcarianEditor.Windows
                         }
 
                         SceneObject obj = objData.Object;
-                        GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(obj.DefName);
+                        GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(obj.DefName);
                         if (def == null)
                         {
                             continue;
                         }
 
-                        bool selected = false;
-                        foreach (SelectionObject selectionObj in selection)
+                        bool selected = Workspace.SelectionContains(obj);
+                        if (selected)
                         {
-                            if (selectionObj.SelectionMode == SelectionObjectMode.SceneObject && selectionObj.SceneObject == obj)
-                            {
-                                selected = true;
-                                mid += obj.Translation;
-                                ++count;
-
-                                break;
-                            }
+                            mid += obj.Translation;
+                            ++count;
                         }
 
                         Matrix4 mat = Matrix4.FromTransform(obj.Translation, obj.Rotation, obj.Scale);
@@ -264,21 +259,16 @@ namespace IcarianEditor.Windows
                         }
 
                         SceneObjectArray arr = arrData.Array;
-                        GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(arr.DefName);
+                        GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(arr.DefName);
                         if (def == null)
                         {
                             continue;
                         }
 
-                        foreach (SelectionObject selectionObj in selection)
+                        if (Workspace.SelectionContains(arr))
                         {
-                            if (selectionObj.SelectionMode == SelectionObjectMode.SceneObjectArray && selectionObj.SceneObjectArray == arr)
-                            {
-                                mid += arr.Translation;
-                                ++count;
-
-                                break;
-                            }
+                            mid += arr.Translation;
+                            ++count;
                         }
 
                         RenderArray(arr, a_view, a_proj, a_screenWidth, a_screenHeight);
@@ -335,6 +325,8 @@ namespace IcarianEditor.Windows
                         sel.Rotation = dat.StartRotation * s_rotation;
                         sel.Scale = dat.StartScale + deltaScale;
                     }
+
+                    scene.MarkDirty();
                 }
             }
             else
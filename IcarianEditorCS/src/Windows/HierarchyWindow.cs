@@ -13,80 +13,144 @@ namespace IcarianEditor.Windows
 {
     public static class HierarchyWindow
     {
-        static ulong s_startID = uint.MaxValue;
+        struct HierarchyRow
+        {
+            public SelectionObject Selection;
+            public bool            Visible;
+            // Built once with the row so drawing does not format strings every frame
+            public string          VisibleLabel;
+            public string          Label;
+        }
+
+        // Objects then arrays, shift selection works off indices into this
+        static List<HierarchyRow>     s_rows = new List<HierarchyRow>();
+        static Dictionary<ulong, int> s_rowLookup = new Dictionary<ulong, int>();
+        static int                    s_objectRowCount = 0;
+
+        // Rows only get rebuilt when the scene or defs they were built from change
+        static EditorScene            s_rowScene = null;
+        static uint                   s_rowSceneVersion = uint.MaxValue;
+        static uint                   s_rowDefVersion = uint.MaxValue;
 
-        static void Select(ulong a_id, List<SelectionObject> a_selections)
+        static ulong                  s_anchorID = ulong.MaxValue;
+
+        static void RebuildRows(EditorScene a_scene)
         {
-            List<SelectionObject> selection = new List<SelectionObject>();
+            s_rows.Clear();
+            s_rowLookup.Clear();
 
-            if (GUI.CtrlModifier)
+            foreach (SceneObjectData objectData in a_scene.SceneObjects)
             {
-                selection.AddRange(Workspace.Selection);
+                SceneObject obj = objectData.Object;
+
+                string name = obj.DefName;
+
+                GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(name);
+                if (def == null)
+                {
+                    continue;
+                }
+
+                ulong id = objectData.ID;
+                string idStr = $"##[{id}]{name}";
+
+                s_rowLookup.Add(id, s_rows.Count);
+                s_rows.Add(new HierarchyRow()
+                {
+                    Selection = new SelectionObject()
+                    {
+                        ID = id,
+                        SelectionMode = SelectionObjectMode.SceneObject,
+                        SceneObject = obj
+                    },
+                    Visible = objectData.Visible,
+                    VisibleLabel = $"Visible{idStr}",
+                    Label = $"{name}{idStr}"
+                });
             }
 
-            int index = 0;
-            int sIndex = int.MaxValue;
-            for (int i = 0; i < a_selections.Count; ++i)
+            s_objectRowCount = s_rows.Count;
+
+            foreach (SceneObjectArrayData arrayData in a_scene.SceneObjectArrays)
             {
-                SelectionObject obj = a_selections[i];
+                SceneObjectArray arr = arrayData.Array;
 
-                ulong id = obj.ID;
+                string name = arr.DefName;
 
-                if (id == s_startID)
+                GameObjectDef def = EditorDefLibrary.GetDef<GameObjectDef>(name);
+                if (def == null)
                 {
-                    sIndex = i;
+                    continue;
                 }
 
-                if (id == a_id)
+                ulong id = arrayData.ID;
+                string idStr = $"##A[{id}]{name}";
+
+                s_rowLookup.Add(id, s_rows.Count);
+                s_rows.Add(new HierarchyRow()
                 {
-                    if (!selection.Contains(obj))
+                    Selection = new SelectionObject()
                     {
-                        selection.Add(obj);
-                    }
+                        ID = id,
+                        SelectionMode = SelectionObjectMode.SceneObjectArray,
+                        SceneObjectArray = arr
+                    },
+                    Visible = arrayData.Visible,
+                    VisibleLabel = $"Visible{idStr}",
+                    Label = $"{name}{idStr}"
+                });
+            }
 
-                    index = i;
+            s_rowScene = a_scene;
+            s_rowSceneVersion = a_scene.Version;
+            s_rowDefVersion = EditorDefLibrary.Version;
+        }
 
-                    break;
-                }
-            }
+        static void Select(int a_row)
+        {
+            List<SelectionObject> selection = new List<SelectionObject>();
+            HashSet<ulong> selectionIDs = new HashSet<ulong>();
 
-            if (GUI.ShiftModifier)
+            if (GUI.CtrlModifier)
             {
-                if (index < sIndex)
+                foreach (SelectionObject obj in Workspace.Selection)
                 {
-                    for (int i = index + 1; i < a_selections.Count; ++i)
+                    if (selectionIDs.Add(obj.ID))
                     {
-                        SelectionObject obj = a_selections[i];
-
-                        if (!selection.Contains(obj))
-                        {
-                            selection.Add(obj);
-                        }
-
-                        if (obj.ID == s_startID)
-                        {
-                            break;
-                        }
+                        selection.Add(obj);
                     }
                 }
-                else
+            }
+
+            int anchor;
+            if (GUI.ShiftModifier && s_rowLookup.TryGetValue(s_anchorID, out anchor))
+            {
+                int min = anchor < a_row ? anchor : a_row;
+                int max = anchor < a_row ? a_row : anchor;
+
+                for (int i = min; i <= max; ++i)
                 {
-                    for (int i = index - 1; i >= sIndex; --i)
+                    SelectionObject obj = s_rows[i].Selection;
+                    if (selectionIDs.Add(obj.ID))
                     {
-                        SelectionObject obj = a_selections[i];
-
-                        if (!selection.Contains(obj))
-                        {
-                            selection.Add(obj);
-                        }
+                        selection.Add(obj);
                     }
                 }
             }
+            else
+            {
+                SelectionObject obj = s_rows[a_row].Selection;
+                if (selectionIDs.Add(obj.ID))
+                {
+                    selection.Add(obj);
+                }
+
+                // Anchor stays put while shift is held so the range can be grown or shrunk
+                s_anchorID = obj.ID;
+            }
 
             Workspace.ClearSelection();
             Workspace.AddSelection(selection);
-
-            s_startID = a_id;
         }
 
         static void CreateMenuItem()
@@ -142,123 +206,96 @@ namespace IcarianEditor.Windows
                 return;
             }
 
-            // Probably not the best way of doing this but it works
-            List<SelectionObject> selectionList = new List<SelectionObject>();
-            ulong selectionID = ulong.MaxValue;
-
-            bool context = false;
-
-            IEnumerable<SceneObjectData> sceneObjects = scene.SceneObjects;
-            foreach (SceneObjectData objectData in sceneObjects)
+            if (scene != s_rowScene || scene.Version != s_rowSceneVersion || EditorDefLibrary.Version != s_rowDefVersion)
             {
-                SceneObject obj = objectData.Object;
-
-                string name = obj.DefName;
+                RebuildRows(scene);
+            }
 
-                GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(name);
-                if (def == null)
-                {
-                    continue;
-                }
+            int selectedRow = -1;
+            bool context = false;
 
-                ulong id = objectData.ID;
-                string idStr = $"##[{id}]{obj.DefName}";
+            // Only rows in view get submitted, big scenes would otherwise cost the whole list every frame
+            int start;
+            int end;
 
-                selectionList.Add(new SelectionObject()
+            GUI.BeginListClipper((uint)s_objectRowCount);
+            while (GUI.ListClipperStep(out start, out end))
+            {
+                for (int i = start; i < end; ++i)
                 {
-                    ID = id,
-                    SelectionMode = SelectionObjectMode.SceneObject,
-                    SceneObject = obj
-                });
+                    HierarchyRow row = s_rows[i];
+                    ulong id = row.Selection.ID;
 
-                bool visible = objectData.Visible;
-                if (GUI.ToggleButton($"Visible{idStr}", "Textures/Icons/Hierarchy_Visible.png", "Textures/Icons/Hierarchy_Hidden.png", ref visible, new Vector2(12.0f), false))
-                {
-                    scene.SetVisible(id, visible);
-
-                    // Have to break as C# does not allow modifying the value while iterating cause C# is a "good" language
-                    // Fuck C# and this fucky hack
-                    // Why the fuck C# iterates by value instead of by reference who tf knows
-                    // Newer versions have ref loops but incompatible with the editor specifically
-                    // Should do properly but it works
-                    break;
-                }
-                GUI.Tooltip("Visibility", "Toggles the visibility of the Scene Object");
+                    bool visible = row.Visible;
+                    if (GUI.ToggleButton(row.VisibleLabel, "Textures/Icons/Hierarchy_Visible.png", "Textures/Icons/Hierarchy_Hidden.png", ref visible, new Vector2(12.0f), false))
+                    {
+                        // Rows are rebuilt off the version bump next frame
+                        scene.SetVisible(id, visible);
+                    }
+                    GUI.Tooltip("Visibility", "Toggles the visibility of the Scene Object");
 
-                GUI.SameLine();
+                    GUI.SameLine();
 
-                GUI.Texture("Textures/Icons/Hierarchy_SceneGameObject.png", new Vector2(16.0f));
+                    GUI.Texture("Textures/Icons/Hierarchy_SceneGameObject.png", new Vector2(16.0f));
 
-                GUI.SameLine();
+                    GUI.SameLine();
 
-                if (GUI.Selectable($"{name}{idStr}"))
-                {
-                    selectionID = id;
-                }
+                    if (GUI.Selectable(row.Label))
+                    {
+                        selectedRow = i;
+                    }
 
-                if (!context && GUI.BeginContextPopup())
-                {
-                    context = true;
+                    if (!context && GUI.BeginContextPopup())
+                    {
+                        context = true;
 
-                    CreateMenuItem();
-                    ObjectOptionsMenu(id);
+                        CreateMenuItem();
+                        ObjectOptionsMenu(id);
 
-                    GUI.EndPopup();
+                        GUI.EndPopup();
+                    }
                 }
             }
+            GUI.EndListClipper();
 
             GUI.Separator();
 
-            IEnumerable<SceneObjectArrayData> sceneObjectArrays = scene.SceneObjectArrays;
-            foreach (SceneObjectArrayData arrayData in sceneObjectArrays)
+            GUI.BeginListClipper((uint)(s_rows.Count - s_objectRowCount));
+            while (GUI.ListClipperStep(out start, out end))
             {
-                SceneObjectArray arr = arrayData.Array;
-
-                string name = arr.DefName;
-                GameObjectDef def = EditorDefLibrary.GenerateDef<GameObjectDef>(name);
-                if (def == null)
+                for (int i = start + s_objectRowCount; i < end + s_objectRowCount; ++i)
                 {
-                    continue;
-                }
-
-                ulong id = arrayData.ID;
-                string idStr = $"##A[{id}]{arr.DefName}";
-
-                selectionList.Add(new SelectionObject()
-                {
-                    ID = id,
-                    SelectionMode = SelectionObjectMode.SceneObjectArray,
-                    SceneObjectArray = arr
-                });
+                    HierarchyRow row = s_rows[i];
+                    ulong id = row.Selection.ID;
 
-                bool visible = arrayData.Visible;
-                if (GUI.ToggleButton($"Visible{idStr}", "Textures/Icons/Hierarchy_Visible.png", "Textures/Icons/Hierarchy_Hidden.png", ref visible, new Vector2(12.0f), false))
-                {
-                    scene.SetVisible(id, visible);
-
-                    break;
-                }
+                    bool visible = row.Visible;
+                    if (GUI.ToggleButton(row.VisibleLabel, "Textures/Icons/Hierarchy_Visible.png", "Textures/Icons/Hierarchy_Hidden.png", ref visible, new Vector2(12.0f), false))
+                    {
+                        scene.SetVisible(id, visible);
+                    }
 
-                GUI.SameLine();
+                    GUI.SameLine();
 
-                if (GUI.Selectable($"{name}{idStr}"))
-                {
-                    selectionID = id;
-                }
+                    if (GUI.Selectable(row.Label))
+                    {
+                        selectedRow = i;
+                    }
 
-                if (!context && GUI.BeginContextPopup())
-                {
-                    context = true;
+                    if (!context && GUI.BeginContextPopup())
+                    {
+                        context = true;
 
-                    CreateMenuItem();
+                        CreateMenuItem();
 
-                    GUI.EndPopup();
+                        GUI.EndPopup();
+                    }
                 }
             }
+            GUI.EndListClipper();
 
-            if (selectionID != ulong.MaxValue)
+            if (selectedRow >= 0)
             {
-                Select(selectionID, selectionList);
+                Select(selectedRow);
             }
 
             if (!context && GUI.BeginContextPopupWindow())
@@ -15,7 +15,18 @@ namespace IcarianEditor.Windows
 {
     public static class SceneDefsWindow
     {
-        static string s_searchString = string.Empty;
+        struct DefRow
+        {
+            public string Name;
+            public int    DeleteResult;
+            public int    SelectResult;
+        }
+
+        static string           s_searchString = string.Empty;
+
+        // Rows are plain buttons and selectables so they go through in one call instead of five per def
+        static GUICommandBuffer s_commands = new GUICommandBuffer();
+        static List<DefRow>     s_rows = new List<DefRow>();
 
         static void OnGUI()
         {
@@ -38,6 +49,9 @@ namespace IcarianEditor.Windows
             {
                 IEnumerable<string> defNames = scene.DefNames;
 
+                s_commands.Clear();
+                s_rows.Clear();
+
                 foreach (string defName in defNames)
                 {
                     if (!string.IsNullOrWhiteSpace(s_searchString) && !defName.Contains(s_searchString))
@@ -45,9 +59,27 @@ namespace IcarianEditor.Windows
                         continue;
                     }
 
-                    GUI.PushID(defName);
+                    DefRow row = new DefRow()
+                    {
+                        Name = defName
+                    };
+
+                    s_commands.PushID(defName);
+                    row.DeleteResult = s_commands.Button("-");
+                    s_commands.SameLine();
+                    row.SelectResult = s_commands.Selectable(defName);
+                    s_commands.PopID();
 
-                    if (GUI.Button("-"))
+                    s_rows.Add(row);
+                }
+
+                s_commands.Execute();
+
+                foreach (DefRow row in s_rows)
+                {
+                    string defName = row.Name;
+
+                    if (s_commands.GetResult(row.DeleteResult))
                     {
                         new ConfirmModal($"Delete {defName}?", () =>
                         {
@@ -57,21 +89,15 @@ namespace IcarianEditor.Windows
                             Workspace.ClearSelection();
                         });
 
-                        GUI.PopID();
-
                         break;
                     }
 
-                    GUI.SameLine();
-
-                    if (GUI.Selectable(defName))
+                    if (s_commands.GetResult(row.SelectResult))
                     {
                         Workspace.ClearSelection();
 
                         Workspace.AddDefSelection(defName);
                     }
-
-                    GUI.PopID();
                 }
 
                 GUI.EndChild();
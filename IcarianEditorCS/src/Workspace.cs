@@ -166,7 +166,10 @@ namespace IcarianEditor
     {
         static ulong                 s_id = 0;
 
+        // List keeps the order things were selected in and the sets are for lookups
         static List<SelectionObject> s_selection = new List<SelectionObject>();
+        static HashSet<ulong>        s_selectionIDs = new HashSet<ulong>();
+        static HashSet<object>       s_selectionObjects = new HashSet<object>(new ReferenceComparer<object>());
         static List<string>          s_selectedDefs = new List<string>();
         
         public static IEnumerable<SelectionObject> Selection
@@ -219,13 +222,35 @@ namespace IcarianEditor
             }
         }
 
+        public static int SelectionCount
+        {
+            get
+            {
+                return s_selection.Count;
+            }
+        }
+
         public static void AddSelection(SelectionObject a_object)
         {
+            if (!s_selectionIDs.Add(a_object.ID))
+            {
+                return;
+            }
+
             s_selection.Add(a_object);
+
+            object obj = a_object.Object;
+            if (obj != null)
+            {
+                s_selectionObjects.Add(obj);
+            }
         }
         public static void AddSelection(IEnumerable<SelectionObject> a_objects)
         {
-            s_selection.AddRange(a_objects);
+            foreach (SelectionObject obj in a_objects)
+            {
+                AddSelection(obj);
+            }
         }
         public static void AddDefSelection(string a_name)
         {
@@ -239,32 +264,32 @@ namespace IcarianEditor
         public static void ClearSelection()
         {
             s_selection.Clear();
+            s_selectionIDs.Clear();
+            s_selectionObjects.Clear();
             s_selectedDefs.Clear();
         }
 
+        public static bool SelectionContains(ulong a_id)
+        {
+            return s_selectionIDs.Contains(a_id);
+        }
         public static bool SelectionContains(SceneObject a_obj)
         {
-            foreach (SelectionObject obj in s_selection)
+            if (a_obj == null)
             {
-                if (obj.SceneObject == a_obj)
-                {
-                    return true;
-                }
+                return false;
             }
 
-            return false;
+            return s_selectionObjects.Contains(a_obj);
         }
         public static bool SelectionContains(SceneObjectArray a_arr)
         {
-            foreach (SelectionObject obj in s_selection)
+            if (a_arr == null)
             {
-                if (obj.SceneObjectArray == a_arr)
-                {
-                    return true;
-                }
+                return false;
             }
 
-            return false;
+            return s_selectionObjects.Contains(a_arr);
         }
 
         public static ulong NewID()
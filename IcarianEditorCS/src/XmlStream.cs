@@ -0,0 +1,104 @@
+// Icarian Editor - Editor for the Icarian Game Engine
+// 
+// License at end of file.
+
+using System.IO;
+using System.Text;
+using System.Xml;
+
+namespace IcarianEditor
+{
+    // Forward only xml for scenes and defs so big files do not get built into a full document
+    // Writer matches what an indented XmlDocument used to write out byte for byte
+    internal static class XmlStream
+    {
+        public static XmlReader CreateReader(byte[] a_data)
+        {
+            XmlReaderSettings settings = new XmlReaderSettings()
+            {
+                IgnoreWhitespace = true,
+                IgnoreProcessingInstructions = true,
+                CloseInput = true
+            };
+
+            return XmlReader.Create(new MemoryStream(a_data, false), settings);
+        }
+
+        public static XmlTextWriter CreateWriter(Stream a_stream)
+        {
+            // No BOM as files have always been written without one
+            XmlTextWriter writer = new XmlTextWriter(a_stream, new UTF8Encoding(false));
+            writer.Formatting = Formatting.Indented;
+
+            writer.WriteProcessingInstruction("xml", "version=\"1.0\" encoding=\"UTF-8\"");
+
+            return writer;
+        }
+
+        // Skips to the next child element of the current element, returns false once the parent has been closed
+        public static bool NextElement(XmlReader a_reader)
+        {
+            while (!a_reader.EOF)
+            {
+                switch (a_reader.MoveToContent())
+                {
+                case XmlNodeType.Element:
+                {
+                    return true;
+                }
+                case XmlNodeType.EndElement:
+                {
+                    a_reader.ReadEndElement();
+
+                    return false;
+                }
+                default:
+                {
+                    a_reader.Skip();
+
+                    break;
+                }
+                }
+            }
+
+            return false;
+        }
+
+        // Moves inside the current element, returns false if there is nothing to read
+        public static bool EnterElement(XmlReader a_reader)
+        {
+            if (a_reader.IsEmptyElement)
+            {
+                a_reader.Read();
+
+                return false;
+            }
+
+            a_reader.ReadStartElement();
+
+            return true;
+        }
+    }
+}
+
+// MIT License
+// 
+// Copyright (c) 2025 River Govers
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
\ No newline at end of file